@@ -7,8 +7,17 @@
 //
 
 #import "ASLBatchEncoder.h"
+#import "ASLBatchEncoder_Internal.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 #include "seal/batchencoder.h"
+#include "seal/memorymanager.h"
+#include "seal/valcheck.h"
+#include "seal/util/common.h"
+#include "seal/util/ntt.h"
+#include "seal/util/uintcore.h"
 
 #import "ASLEncryptionParameters.h"
 #import "ASLSealContextData.h"
@@ -17,11 +26,162 @@
 #import "ASLEncryptionParameters_Internal.h"
 #import "ASLPlainText_Internal.h"
 #import "ASLMemoryPoolHandle_Internal.h"
+#import "ASLEvaluator_Internal.h"
 #import "NSError+CXXAdditions.h"
 
+#pragma mark - Buffer Helpers
+
+/// Returns the coefficient that each slot occupies before the inverse NTT, computed as
+/// seal::BatchEncoder does: the first row of the matrix, then the second.
+static std::vector<size_t> ASLMatrixRepsIndexMap(size_t slotCount) {
+    int const logn = seal::util::get_power_of_two(slotCount);
+    size_t const rowSize = slotCount >> 1;
+    std::uint64_t const m = static_cast<std::uint64_t>(slotCount) << 1;
+    std::uint64_t const generator = 3;
+    std::uint64_t position = 1;
+    std::vector<size_t> indexMap(slotCount);
+    for (size_t i = 0; i < rowSize; ++i) {
+        std::uint64_t const index1 = (position - 1) >> 1;
+        std::uint64_t const index2 = (m - position - 1) >> 1;
+        indexMap[i] = static_cast<size_t>(seal::util::reverse_bits(index1, logn));
+        indexMap[rowSize | i] = static_cast<size_t>(seal::util::reverse_bits(index2, logn));
+        position = (position * generator) & (m - 1);
+    }
+    return indexMap;
+}
+
+/// Returns value modulo modulus with the Barrett ratio precomputed by seal::Modulus. The
+/// estimated quotient is at most one too small, so a single select finishes the reduction.
+static inline std::uint64_t ASLBarrettReduce(std::uint64_t value, std::uint64_t modulus, std::uint64_t const *ratio) {
+    std::uint64_t const carry = static_cast<std::uint64_t>((static_cast<unsigned __int128>(value) * ratio[0]) >> 64);
+    std::uint64_t const quotient = static_cast<std::uint64_t>((static_cast<unsigned __int128>(value) * ratio[1] + carry) >> 64);
+    std::uint64_t const remainder = value - quotient * modulus;
+    return remainder >= modulus ? remainder - modulus : remainder;
+}
+
+/// Returns a function reducing unsigned values modulo plainModulus.
+static auto ASLUnsignedReducer(seal::Modulus const &plainModulus) {
+    std::uint64_t const modulus = plainModulus.value();
+    std::uint64_t const * const ratio = plainModulus.const_ratio().data();
+    return [=](std::uint64_t value) {
+        return ASLBarrettReduce(value, modulus, ratio);
+    };
+}
+
+/// Returns a function mapping signed values to their residues modulo plainModulus.
+static auto ASLSignedReducer(seal::Modulus const &plainModulus) {
+    std::uint64_t const modulus = plainModulus.value();
+    std::uint64_t const * const ratio = plainModulus.const_ratio().data();
+    return [=](std::int64_t value) {
+        // Negating through unsigned arithmetic keeps INT64_MIN well defined.
+        std::uint64_t const magnitude = value < 0 ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+        std::uint64_t const reduced = ASLBarrettReduce(magnitude, modulus, ratio);
+        return value < 0 && reduced != 0 ? modulus - reduced : reduced;
+    };
+}
+
+/// Overwrites destination with slotCount zero coefficients, writes reduce(values[i]) to the
+/// coefficient of slot i and transforms it back to coefficients. The allocation of destination
+/// is reused when it is large enough.
+template <typename Value, typename Reduce>
+static void ASLEncodeBufferInto(Value const *values,
+                                size_t count,
+                                std::vector<size_t> const &indexMap,
+                                seal::SEALContext::ContextData const &contextData,
+                                Reduce reduce,
+                                seal::Plaintext &destination) {
+    size_t const slotCount = indexMap.size();
+    if (count > slotCount) {
+        throw std::invalid_argument("count is larger than slot count");
+    }
+    destination.parms_id() = seal::parms_id_zero;
+    destination.resize(slotCount);
+    destination.set_zero();
+    std::uint64_t * const coefficients = destination.data();
+    size_t const * const slots = indexMap.data();
+    for (size_t i = 0; i < count; ++i) {
+        coefficients[slots[i]] = reduce(values[i]);
+    }
+    seal::util::inverse_ntt_negacyclic_harvey(coefficients, *contextData.plain_ntt_tables());
+}
+
+/// Encodes values as ASLEncodeBufferInto does into a new plaintext.
+template <typename Value, typename Reduce>
+static seal::Plaintext ASLEncodeBuffer(Value const *values,
+                                       size_t count,
+                                       std::vector<size_t> const &indexMap,
+                                       seal::SEALContext::ContextData const &contextData,
+                                       Reduce reduce) {
+    seal::Plaintext destination;
+    ASLEncodeBufferInto(values, count, indexMap, contextData, reduce, destination);
+    return destination;
+}
+
+/// Encodes values as consecutive chunks of slotCount slots, the last one zero-padded, on up to
+/// workerCount workers. The plaintexts are returned to the caller, so they are all allocated up
+/// front on the calling thread from the global pool at full size, and the workers encode into
+/// them without allocating.
+template <typename Value, typename Reduce>
+static NSArray<ASLPlainText *> *ASLEncodeBufferBatch(Value const *values,
+                                                     size_t count,
+                                                     std::vector<size_t> const &indexMap,
+                                                     seal::SEALContext::ContextData const &contextData,
+                                                     size_t workerCount,
+                                                     Reduce reduce) {
+    size_t const slotCount = indexMap.size();
+    size_t const chunkCount = (count + slotCount - 1) / slotCount;
+    std::vector<seal::Plaintext> destinations;
+    destinations.reserve(chunkCount);
+    seal::MemoryPoolHandle const resultPool = seal::MemoryManager::GetPool();
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        destinations.emplace_back(slotCount, resultPool);
+    }
+    ASLParallelFor(chunkCount, workerCount, [&](size_t chunk, seal::MemoryPoolHandle const &) {
+        size_t const begin = chunk * slotCount;
+        ASLEncodeBufferInto(values + begin, std::min(slotCount, count - begin), indexMap, contextData, reduce, destinations[chunk]);
+    });
+    NSMutableArray<ASLPlainText *> * const result = [NSMutableArray arrayWithCapacity:chunkCount];
+    for (seal::Plaintext &destination : destinations) {
+        [result addObject:[[ASLPlainText alloc] initWithPlainText:std::move(destination)]];
+    }
+    return result;
+}
+
+/// Transforms plain to slots in scratch space from the global pool and writes lift(slot i) to
+/// destination[i] for the first count slots.
+template <typename Value, typename Lift>
+static void ASLDecodeBuffer(seal::Plaintext const &plain,
+                            Value *destination,
+                            size_t count,
+                            std::vector<size_t> const &indexMap,
+                            std::shared_ptr<seal::SEALContext> const &context,
+                            Lift lift) {
+    size_t const slotCount = indexMap.size();
+    if (!seal::is_valid_for(plain, context)) {
+        throw std::invalid_argument("plain is not valid for encryption parameters");
+    }
+    if (plain.is_ntt_form()) {
+        throw std::invalid_argument("plain cannot be in NTT form");
+    }
+    if (count > slotCount) {
+        throw std::invalid_argument("count is larger than slot count");
+    }
+    seal::util::Pointer<std::uint64_t> scratch = seal::util::allocate_uint(slotCount, seal::MemoryManager::GetPool());
+    size_t const coefficientCount = std::min(plain.coeff_count(), slotCount);
+    std::copy_n(plain.data(), coefficientCount, scratch.get());
+    std::fill(scratch.get() + coefficientCount, scratch.get() + slotCount, 0);
+    seal::util::ntt_negacyclic_harvey(scratch.get(), *context->first_context_data()->plain_ntt_tables());
+    size_t const * const slots = indexMap.data();
+    for (size_t i = 0; i < count; ++i) {
+        destination[i] = lift(scratch[slots[i]]);
+    }
+}
+
 @implementation ASLBatchEncoder {
     
     seal::BatchEncoder* _batchEncoder;
+    std::shared_ptr<seal::SEALContext> _context;
+    std::vector<size_t> _matrixRepsIndexMap;
 }
 
 #pragma mark - Initialization
@@ -31,7 +191,7 @@
     
     try {
         seal::BatchEncoder* batchEncoder = new seal::BatchEncoder(context.sealContext);
-        return [[ASLBatchEncoder alloc] initWithBatchEncoder:batchEncoder];
+        return [[ASLBatchEncoder alloc] initWithBatchEncoder:batchEncoder context:context.sealContext];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -40,12 +200,16 @@
     }
 }
 
-- (instancetype)initWithBatchEncoder:(seal::BatchEncoder *)batchEncoder {
+- (instancetype)initWithBatchEncoder:(seal::BatchEncoder *)batchEncoder
+                             context:(std::shared_ptr<seal::SEALContext>)context {
     self = [super init];
     if (self == nil) {
         return nil;
     }
     _batchEncoder = batchEncoder;
+    _context = std::move(context);
+    _matrixRepsIndexMap = ASLMatrixRepsIndexMap(batchEncoder->slot_count());
+    _batchConcurrency = NSProcessInfo.processInfo.activeProcessorCount;
     
     return self;
 }
@@ -75,8 +239,9 @@
     NSParameterAssert(unsignedValues != nil);
     
     std::vector<std::uint64_t> valuesList;
+    valuesList.reserve(unsignedValues.count);
     for (NSNumber * const value in unsignedValues) {
-        valuesList.push_back(value.intValue);
+        valuesList.push_back(value.unsignedLongLongValue);
     }
     const std::vector<uint64_t> constValuesValues = valuesList;
     
@@ -99,11 +264,12 @@
     
     NSParameterAssert(signedValues != nil);
     
-    std::vector<std::uint64_t> valuesList;
+    std::vector<std::int64_t> valuesList;
+    valuesList.reserve(signedValues.count);
     for (NSNumber * const value in signedValues) {
-        valuesList.push_back(value.intValue);
+        valuesList.push_back(value.longLongValue);
     }
-    const std::vector<uint64_t> constValuesValues = valuesList;
+    const std::vector<std::int64_t> constValuesValues = valuesList;
     
     seal::Plaintext sealPlainText = seal::Plaintext();
     
@@ -180,13 +346,13 @@
                                                    error:(NSError **)error {
     NSParameterAssert(plainText != nil);
     
-    std::vector<std::uint64_t> destinationValuesList;
+    std::vector<std::int64_t> destinationValuesList;
     
     try {
         _batchEncoder->decode(plainText.sealPlainText, destinationValuesList);
         NSMutableArray<NSNumber *> * results = [[NSMutableArray alloc] initWithCapacity:destinationValuesList.size()];
-        for (std::uint64_t & value : destinationValuesList) {
-            [results addObject:[[NSNumber alloc]initWithFloat:value]];
+        for (std::int64_t & value : destinationValuesList) {
+            [results addObject:@(value)];
         }
         return results;
     } catch (std::invalid_argument const &e) {
@@ -237,4 +403,130 @@
     return nil;
 }
 
+#pragma mark - Buffers
+
+- (ASLPlainText *)encodeUInt64Buffer:(const uint64_t *)values
+                               count:(size_t)count
+                               error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    seal::SEALContext::ContextData const &contextData = *_context->first_context_data();
+    try {
+        seal::Plaintext sealPlainText = ASLEncodeBuffer(values, count, _matrixRepsIndexMap, contextData,
+                                                        ASLUnsignedReducer(contextData.parms().plain_modulus()));
+        return [[ASLPlainText alloc] initWithPlainText:std::move(sealPlainText)];
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+}
+
+- (ASLPlainText *)encodeInt64Buffer:(const int64_t *)values
+                              count:(size_t)count
+                              error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    seal::SEALContext::ContextData const &contextData = *_context->first_context_data();
+    try {
+        seal::Plaintext sealPlainText = ASLEncodeBuffer(values, count, _matrixRepsIndexMap, contextData,
+                                                        ASLSignedReducer(contextData.parms().plain_modulus()));
+        return [[ASLPlainText alloc] initWithPlainText:std::move(sealPlainText)];
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+}
+
+- (BOOL)decodePlainText:(ASLPlainText *)plainText
+       intoUInt64Buffer:(uint64_t *)destination
+                  count:(size_t)count
+                  error:(NSError **)error {
+    NSParameterAssert(plainText != nil);
+    NSParameterAssert(destination != NULL || count == 0);
+    
+    try {
+        ASLDecodeBuffer([plainText sealPlainTextReference], destination, count, _matrixRepsIndexMap, _context, [](std::uint64_t value) {
+            return value;
+        });
+        return YES;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    }
+}
+
+- (BOOL)decodePlainText:(ASLPlainText *)plainText
+        intoInt64Buffer:(int64_t *)destination
+                  count:(size_t)count
+                  error:(NSError **)error {
+    NSParameterAssert(plainText != nil);
+    NSParameterAssert(destination != NULL || count == 0);
+    
+    std::uint64_t const modulus = _context->first_context_data()->parms().plain_modulus().value();
+    std::uint64_t const halfModulus = modulus >> 1;
+    try {
+        ASLDecodeBuffer([plainText sealPlainTextReference], destination, count, _matrixRepsIndexMap, _context, [=](std::uint64_t value) {
+            return value > halfModulus ? static_cast<std::int64_t>(value) - static_cast<std::int64_t>(modulus) : static_cast<std::int64_t>(value);
+        });
+        return YES;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    }
+}
+
+#pragma mark - ASLBatchEncoder_Internal
+
+- (void)encodeUInt64Buffer:(const uint64_t *)values
+                     count:(size_t)count
+         intoSealPlainText:(seal::Plaintext &)destination {
+    seal::SEALContext::ContextData const &contextData = *_context->first_context_data();
+    ASLEncodeBufferInto(values, count, _matrixRepsIndexMap, contextData,
+                        ASLUnsignedReducer(contextData.parms().plain_modulus()), destination);
+}
+
+#pragma mark - Batches
+
+- (NSArray<ASLPlainText *> *)encodeBatchUInt64Buffer:(const uint64_t *)values
+                                               count:(size_t)count
+                                               error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    seal::SEALContext::ContextData const &contextData = *_context->first_context_data();
+    try {
+        return ASLEncodeBufferBatch(values, count, _matrixRepsIndexMap, contextData, self.batchConcurrency,
+                                    ASLUnsignedReducer(contextData.parms().plain_modulus()));
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+}
+
+- (NSArray<ASLPlainText *> *)encodeBatchInt64Buffer:(const int64_t *)values
+                                              count:(size_t)count
+                                              error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    seal::SEALContext::ContextData const &contextData = *_context->first_context_data();
+    try {
+        return ASLEncodeBufferBatch(values, count, _matrixRepsIndexMap, contextData, self.batchConcurrency,
+                                    ASLSignedReducer(contextData.parms().plain_modulus()));
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+}
+
 @end
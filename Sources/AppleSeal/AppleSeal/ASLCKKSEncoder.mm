@@ -7,7 +7,13 @@
 //
 
 #import "ASLCKKSEncoder.h"
+#import "ASLCKKSEncoder_Internal.h"
 
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include "seal/ckks.h"
 
 #import "ASLSealContext_Internal.h"
@@ -15,11 +21,120 @@
 #import "ASLMemoryPoolHandle_Internal.h"
 #import "ASLComplexType_Internal.h"
 #import "ASLComplexType.h"
+#import "ASLEvaluator_Internal.h"
 #import "NSString+CXXAdditions.h"
 #import "NSError+CXXAdditions.h"
 
+#pragma mark - Batch Helpers
+
+/// Encodes values as consecutive chunks of slotCount slots on up to workerCount workers by
+/// calling encode(chunk, destination, pool). The plaintexts are returned to the caller, so they
+/// are all allocated up front on the calling thread from the global pool at the full size of a
+/// plaintext at parmsId; the workers encode into them without resizing and only allocate their
+/// encoding temporaries, from their own pools.
+template <typename Encode>
+static NSArray<ASLPlainText *> *ASLEncodeDoublesBatch(double const *values,
+                                                      size_t count,
+                                                      size_t slotCount,
+                                                      std::shared_ptr<seal::SEALContext> const &context,
+                                                      seal::parms_id_type const &parmsId,
+                                                      size_t workerCount,
+                                                      Encode encode) {
+    std::shared_ptr<const seal::SEALContext::ContextData> const contextData = context->get_context_data(parmsId);
+    if (!contextData) {
+        throw std::invalid_argument("parms_id is not valid for encryption parameters");
+    }
+    seal::EncryptionParameters const &parms = contextData->parms();
+    size_t const plainCoeffCount = parms.poly_modulus_degree() * parms.coeff_modulus().size();
+    size_t const chunkCount = (count + slotCount - 1) / slotCount;
+    std::vector<seal::Plaintext> destinations;
+    destinations.reserve(chunkCount);
+    seal::MemoryPoolHandle const resultPool = seal::MemoryManager::GetPool();
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        destinations.emplace_back(plainCoeffCount, resultPool);
+    }
+    ASLParallelFor(chunkCount, workerCount, [&](size_t chunk, seal::MemoryPoolHandle const &pool) {
+        size_t const begin = chunk * slotCount;
+        size_t const end = std::min(count, begin + slotCount);
+        encode(std::vector<double>(values + begin, values + end), destinations[chunk], pool);
+    });
+    NSMutableArray<ASLPlainText *> * const result = [NSMutableArray arrayWithCapacity:chunkCount];
+    for (seal::Plaintext &destination : destinations) {
+        [result addObject:[[ASLPlainText alloc] initWithPlainText:std::move(destination)]];
+    }
+    return result;
+}
+
+#pragma mark - Prepared Plain Cache Helpers
+
+/// Identifies a prepared plaintext. The content hash only narrows the search; the
+/// cached values are compared on every hit, so a collision is a miss, never a wrong result.
+struct ASLPreparedPlainKey {
+    std::uint64_t contentHash;
+    double scale;
+    seal::parms_id_type parametersId;
+    bool isScalar;
+    
+    bool operator==(ASLPreparedPlainKey const &other) const {
+        return contentHash == other.contentHash
+            && scale == other.scale
+            && parametersId == other.parametersId
+            && isScalar == other.isScalar;
+    }
+};
+
+/// Folds one 64-bit word into an FNV-1a hash.
+static inline std::uint64_t ASLHashWord(std::uint64_t hash, std::uint64_t word) {
+    return (hash ^ word) * 0x100000001b3ULL;
+}
+
+static inline std::uint64_t ASLDoubleBits(double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static std::uint64_t ASLHashDoubles(double const *values, size_t count) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < count; ++i) {
+        hash = ASLHashWord(hash, ASLDoubleBits(values[i]));
+    }
+    return ASLHashWord(hash, count);
+}
+
+struct ASLPreparedPlainKeyHash {
+    size_t operator()(ASLPreparedPlainKey const &key) const {
+        std::uint64_t hash = ASLHashWord(key.contentHash, ASLDoubleBits(key.scale));
+        for (std::uint64_t const word : key.parametersId) {
+            hash = ASLHashWord(hash, word);
+        }
+        return static_cast<size_t>(ASLHashWord(hash, key.isScalar));
+    }
+};
+
+/// A cached plaintext with the values it was encoded from and its mutation count at the
+/// time, so a plaintext modified through the reference handed out can be recognised.
+struct ASLPreparedPlainEntry {
+    ASLPreparedPlainKey key;
+    std::vector<double> values;
+    ASLPlainText *plainText;
+    NSUInteger mutationCount;
+};
+
+typedef std::list<ASLPreparedPlainEntry> ASLPreparedPlainList;
+
+static NSUInteger const ASLDefaultPreparedPlainCacheCapacity = 64;
+
 @implementation ASLCKKSEncoder {
     std::shared_ptr<seal::CKKSEncoder> _ckksEncoder;
+    std::shared_ptr<seal::SEALContext> _context;
+    std::mutex _preparedPlainMutex;
+    /// Most recently used first
+    ASLPreparedPlainList _preparedPlains;
+    std::unordered_map<ASLPreparedPlainKey, ASLPreparedPlainList::iterator, ASLPreparedPlainKeyHash> _preparedPlainIndex;
+    NSUInteger _preparedPlainCacheCapacity;
+    NSUInteger _preparedPlainCacheHitCount;
+    NSUInteger _preparedPlainCacheMissCount;
 }
 
 #pragma mark - Initialization
@@ -28,7 +143,8 @@
     NSParameterAssert(context != nil);
     
     try {
-        return [[ASLCKKSEncoder alloc] initWithCkksEncoder:seal::CKKSEncoder(context.sealContext)];
+        return [[ASLCKKSEncoder alloc] initWithCkksEncoder:seal::CKKSEncoder(context.sealContext)
+                                                   context:context.sealContext];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -40,13 +156,19 @@
     
 }
 
-- (instancetype)initWithCkksEncoder:(seal::CKKSEncoder)ckksEncoder {
+- (instancetype)initWithCkksEncoder:(seal::CKKSEncoder)ckksEncoder
+                            context:(std::shared_ptr<seal::SEALContext>)context {
     self = [super init];
     if (self == nil) {
         return nil;
     }
     
     _ckksEncoder = std::make_shared<seal::CKKSEncoder>(std::move(ckksEncoder));
+    _context = std::move(context);
+    _preparedPlainCacheCapacity = ASLDefaultPreparedPlainCacheCapacity;
+    _preparedPlainCacheHitCount = 0;
+    _preparedPlainCacheMissCount = 0;
+    _batchConcurrency = NSProcessInfo.processInfo.activeProcessorCount;
     
     return self;
 }
@@ -57,6 +179,32 @@
     return _ckksEncoder->slot_count();
 }
 
+- (NSUInteger)preparedPlainCacheCapacity {
+    std::lock_guard<std::mutex> lock(_preparedPlainMutex);
+    return _preparedPlainCacheCapacity;
+}
+
+- (void)setPreparedPlainCacheCapacity:(NSUInteger)preparedPlainCacheCapacity {
+    std::lock_guard<std::mutex> lock(_preparedPlainMutex);
+    _preparedPlainCacheCapacity = preparedPlainCacheCapacity;
+    [self evictPreparedPlainsLocked];
+}
+
+- (NSUInteger)preparedPlainCacheCount {
+    std::lock_guard<std::mutex> lock(_preparedPlainMutex);
+    return _preparedPlains.size();
+}
+
+- (NSUInteger)preparedPlainCacheHitCount {
+    std::lock_guard<std::mutex> lock(_preparedPlainMutex);
+    return _preparedPlainCacheHitCount;
+}
+
+- (NSUInteger)preparedPlainCacheMissCount {
+    std::lock_guard<std::mutex> lock(_preparedPlainMutex);
+    return _preparedPlainCacheMissCount;
+}
+
 #pragma mark - Public Methods
 
 - (ASLPlainText *)encodeWithDoubleValues:(NSArray<NSNumber *> *)values
@@ -594,4 +742,331 @@
         return nil;
     }
 }
+
+#pragma mark - Buffers
+
+- (ASLPlainText *)encodeDoubles:(const double *)values
+                          count:(size_t)count
+                          scale:(double)scale
+                   parametersId:(ASLParametersIdType)parametersId
+                          error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    // SEAL only accepts a std::vector, so the buffer is copied once in bulk.
+    std::vector<double> const doubleValues(values, values + count);
+    
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Plaintext destination = seal::Plaintext();
+    
+    try {
+        _ckksEncoder->encode(doubleValues, sealParametersId, scale, destination);
+        return [[ASLPlainText alloc] initWithPlainText:std::move(destination)];
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+}
+
+- (ASLPlainText *)encodeDoubles:(const double *)values
+                          count:(size_t)count
+                          scale:(double)scale
+                          error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    std::vector<double> const doubleValues(values, values + count);
+    seal::Plaintext destination = seal::Plaintext();
+    
+    try {
+        _ckksEncoder->encode(doubleValues, scale, destination);
+        return [[ASLPlainText alloc] initWithPlainText:std::move(destination)];
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+}
+
+- (ASLPlainText *)encodeComplexDoubles:(const double *)values
+                                 count:(size_t)count
+                                 scale:(double)scale
+                          parametersId:(ASLParametersIdType)parametersId
+                                 error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    // std::complex<double> is layout compatible with double[2], so the interleaved
+    // buffer can be read as complex values directly.
+    std::complex<double> const * const complexValues = reinterpret_cast<std::complex<double> const *>(values);
+    std::vector<std::complex<double>> const complexValuesList(complexValues, complexValues + count);
+    
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Plaintext destination = seal::Plaintext();
+    
+    try {
+        _ckksEncoder->encode(complexValuesList, sealParametersId, scale, destination);
+        return [[ASLPlainText alloc] initWithPlainText:std::move(destination)];
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+}
+
+- (ASLPlainText *)encodeComplexDoubles:(const double *)values
+                                 count:(size_t)count
+                                 scale:(double)scale
+                                 error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    std::complex<double> const * const complexValues = reinterpret_cast<std::complex<double> const *>(values);
+    std::vector<std::complex<double>> const complexValuesList(complexValues, complexValues + count);
+    seal::Plaintext destination = seal::Plaintext();
+    
+    try {
+        _ckksEncoder->encode(complexValuesList, scale, destination);
+        return [[ASLPlainText alloc] initWithPlainText:std::move(destination)];
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+}
+
+- (BOOL)decodeDoubles:(ASLPlainText *)plainText
+                 into:(double *)destination
+             capacity:(size_t)capacity
+                error:(NSError **)error {
+    NSParameterAssert(plainText != nil);
+    NSParameterAssert(destination != NULL || capacity == 0);
+    
+    std::vector<double> doubleValues = {};
+    try {
+        _ckksEncoder->decode([plainText sealPlainTextReference], doubleValues);
+        std::copy_n(doubleValues.begin(), std::min(capacity, doubleValues.size()), destination);
+        return YES;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    }
+}
+
+- (BOOL)decodeComplexDoubles:(ASLPlainText *)plainText
+                        into:(double *)destination
+                    capacity:(size_t)capacity
+                       error:(NSError **)error {
+    NSParameterAssert(plainText != nil);
+    NSParameterAssert(destination != NULL || capacity == 0);
+    
+    std::vector<std::complex<double>> complexValues = {};
+    try {
+        _ckksEncoder->decode([plainText sealPlainTextReference], complexValues);
+        std::copy_n(complexValues.begin(),
+                    std::min(capacity, complexValues.size()),
+                    reinterpret_cast<std::complex<double> *>(destination));
+        return YES;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    }
+}
+
+#pragma mark - Batches
+
+- (NSArray<ASLPlainText *> *)encodeBatchDoubles:(const double *)values
+                                          count:(size_t)count
+                                          scale:(double)scale
+                                   parametersId:(ASLParametersIdType)parametersId
+                                          error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::CKKSEncoder * const ckksEncoder = _ckksEncoder.get();
+    try {
+        return ASLEncodeDoublesBatch(values, count, ckksEncoder->slot_count(), _context, sealParametersId, self.batchConcurrency,
+                                     [&](std::vector<double> const &chunk, seal::Plaintext &destination, seal::MemoryPoolHandle const &pool) {
+            ckksEncoder->encode(chunk, sealParametersId, scale, destination, pool);
+        });
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+}
+
+- (NSArray<ASLPlainText *> *)encodeBatchDoubles:(const double *)values
+                                          count:(size_t)count
+                                          scale:(double)scale
+                                          error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    seal::CKKSEncoder * const ckksEncoder = _ckksEncoder.get();
+    try {
+        return ASLEncodeDoublesBatch(values, count, ckksEncoder->slot_count(), _context, _context->first_parms_id(), self.batchConcurrency,
+                                     [&](std::vector<double> const &chunk, seal::Plaintext &destination, seal::MemoryPoolHandle const &pool) {
+            ckksEncoder->encode(chunk, scale, destination, pool);
+        });
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+}
+
+#pragma mark - Prepared Plaintexts
+
+- (ASLPlainText *)preparedPlainForValue:(double)value
+                                  scale:(double)scale
+                           parametersId:(ASLParametersIdType)parametersId
+                                  error:(NSError **)error {
+    return [self preparedPlainForValues:&value
+                                  count:1
+                               isScalar:true
+                                  scale:scale
+                           parametersId:parametersId
+                                  error:error];
+}
+
+- (ASLPlainText *)preparedPlainForValues:(NSArray<NSNumber *> *)values
+                                   scale:(double)scale
+                            parametersId:(ASLParametersIdType)parametersId
+                                   error:(NSError **)error {
+    NSParameterAssert(values != nil);
+    
+    std::vector<double> doubleValues;
+    doubleValues.reserve(values.count);
+    for (NSNumber * const value in values) {
+        doubleValues.push_back(value.doubleValue);
+    }
+    return [self preparedPlainForValues:doubleValues.data()
+                                  count:doubleValues.size()
+                               isScalar:false
+                                  scale:scale
+                           parametersId:parametersId
+                                  error:error];
+}
+
+- (ASLPlainText *)preparedPlainForDoubles:(const double *)values
+                                    count:(size_t)count
+                                    scale:(double)scale
+                             parametersId:(ASLParametersIdType)parametersId
+                                    error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    
+    return [self preparedPlainForValues:values
+                                  count:count
+                               isScalar:false
+                                  scale:scale
+                           parametersId:parametersId
+                                  error:error];
+}
+
+- (void)removeAllPreparedPlains {
+    std::lock_guard<std::mutex> lock(_preparedPlainMutex);
+    _preparedPlainIndex.clear();
+    _preparedPlains.clear();
+}
+
+#pragma mark - ASLCKKSEncoder_Internal
+
+- (void)encodeDoubles:(const double *)values
+                count:(size_t)count
+                scale:(double)scale
+    intoSealPlainText:(seal::Plaintext &)destination {
+    _ckksEncoder->encode(std::vector<double>(values, values + count), scale, destination);
+}
+
+#pragma mark - Private Methods
+
+/// Returns the cached plaintext for the values, or encodes and caches it. Encoding happens
+/// outside the lock so concurrent misses for different values do not serialize.
+- (ASLPlainText *)preparedPlainForValues:(double const *)values
+                                   count:(size_t)count
+                                isScalar:(bool)isScalar
+                                   scale:(double)scale
+                            parametersId:(ASLParametersIdType)parametersId
+                                   error:(NSError **)error {
+    ASLPreparedPlainKey key = {};
+    key.contentHash = ASLHashDoubles(values, count);
+    key.scale = scale;
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              key.parametersId.begin());
+    key.isScalar = isScalar;
+    
+    {
+        std::lock_guard<std::mutex> lock(_preparedPlainMutex);
+        auto const cached = _preparedPlainIndex.find(key);
+        if (cached != _preparedPlainIndex.end()) {
+            ASLPreparedPlainEntry const &entry = *cached->second;
+            if (entry.plainText.mutationCount == entry.mutationCount
+                && entry.values.size() == count
+                && std::equal(entry.values.begin(), entry.values.end(), values)) {
+                _preparedPlains.splice(_preparedPlains.begin(), _preparedPlains, cached->second);
+                _preparedPlainCacheHitCount += 1;
+                return entry.plainText;
+            }
+            _preparedPlains.erase(cached->second);
+            _preparedPlainIndex.erase(cached);
+        }
+        _preparedPlainCacheMissCount += 1;
+    }
+    
+    seal::Plaintext destination = seal::Plaintext();
+    try {
+        if (isScalar) {
+            _ckksEncoder->encode(values[0], key.parametersId, scale, destination);
+        } else {
+            _ckksEncoder->encode(std::vector<double>(values, values + count), key.parametersId, scale, destination);
+        }
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+    ASLPlainText * const plainText = [[ASLPlainText alloc] initWithPlainText:std::move(destination)];
+    
+    std::lock_guard<std::mutex> lock(_preparedPlainMutex);
+    if (_preparedPlainCacheCapacity == 0) {
+        return plainText;
+    }
+    auto const raced = _preparedPlainIndex.find(key);
+    if (raced != _preparedPlainIndex.end()) {
+        _preparedPlains.erase(raced->second);
+        _preparedPlainIndex.erase(raced);
+    }
+    _preparedPlains.push_front({key, std::vector<double>(values, values + count), plainText, plainText.mutationCount});
+    _preparedPlainIndex[key] = _preparedPlains.begin();
+    [self evictPreparedPlainsLocked];
+    return plainText;
+}
+
+- (void)evictPreparedPlainsLocked {
+    while (_preparedPlains.size() > _preparedPlainCacheCapacity) {
+        _preparedPlainIndex.erase(_preparedPlains.back().key);
+        _preparedPlains.pop_back();
+    }
+}
 @end
@@ -22,6 +22,7 @@
 
 @implementation ASLCipherText {
     seal::Ciphertext _cipherText;
+    NSUInteger _mutationCount;
 }
 
 + (instancetype _Nullable)cipherTextWithCipherText:(ASLCipherText *)cipherText
@@ -176,6 +177,19 @@
     return _cipherText;
 }
 
+- (seal::Ciphertext const &)sealCipherTextReference {
+    return _cipherText;
+}
+
+- (seal::Ciphertext &)mutableSealCipherText {
+    _mutationCount += 1;
+    return _cipherText;
+}
+
+- (NSUInteger)mutationCount {
+    return _mutationCount;
+}
+
 - (instancetype)initWithCipherText:(seal::Ciphertext)cipherText {
     self = [super init];
     if (self == nil) {
@@ -300,6 +314,7 @@
 
 -(void)setScale:(NSNumber*)scale{
     _cipherText.scale() = scale.doubleValue;
+    _mutationCount += 1;
 }
 
 - (ASLMemoryPoolHandle *)pool {
@@ -322,6 +337,7 @@
                   sealParametersId.begin());
         
         _cipherText.reserve(context.sealContext, sealParametersId, sizeCapacity);
+        _mutationCount += 1;
         return YES;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -338,6 +354,7 @@
     NSParameterAssert(context != nil);
     try {
         _cipherText.reserve(context.sealContext, sizeCapacity);
+        _mutationCount += 1;
         return YES;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -352,20 +369,19 @@
           error:(NSError **)error {
     try {
         _cipherText.reserve(sizeCapacity);
+        _mutationCount += 1;
         return YES;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
         }
         return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
     }
-} catch (std::logic_error const &e) {
-    if (error != nil) {
-        *error = [NSError ASL_SealLogicError:e];
-    }
-    return NO;
-    
-    return NO;
 }
 
 - (BOOL)resize:(ASLSealContext *)context
@@ -379,6 +395,7 @@
               sealParametersId.begin());
     try {
         _cipherText.resize(context.sealContext, sealParametersId, size);
+        _mutationCount += 1;
         return YES;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -396,6 +413,7 @@
     NSParameterAssert(context != nil);
     try {
         _cipherText.resize(context.sealContext, size);
+        _mutationCount += 1;
         return YES;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -411,6 +429,7 @@
          error:(NSError **)error {
     try {
         _cipherText.resize(size);
+        _mutationCount += 1;
         return YES;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -423,6 +442,7 @@
 
 -(void)returnMemoryToPool {
     _cipherText.release();
+    _mutationCount += 1;
 }
 
 - (NSNumber *)polynomialCoefficientAtIndex:(size_t)index
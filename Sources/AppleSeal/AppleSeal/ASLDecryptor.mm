@@ -19,6 +19,7 @@
 #import "ASLCipherText_Internal.h"
 #import "ASLPlainText.h"
 #import "ASLPlainText_Internal.h"
+#import "ASLInstrumentation_Internal.h"
 #import "NSString+CXXAdditions.h"
 #import "NSError+CXXAdditions.h"
 
@@ -61,10 +62,11 @@
 
 - (ASLPlainText *)decrypt:(ASLCipherText *)encrypted
           error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::Plaintext sealPlainText = seal::Plaintext();
     try {
         _decryptor->decrypt(encrypted.sealCipherText, sealPlainText);
-        return [[ASLPlainText alloc] initWithPlainText:sealPlainText];
+        return scope.complete([[ASLPlainText alloc] initWithPlainText:sealPlainText]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -76,8 +78,11 @@
 
 - (NSNumber *)invariantNoiseBudget:(ASLCipherText *)cipherText
                              error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, cipherText);
     try {
-        return [[NSNumber alloc]initWithInt:_decryptor->invariant_noise_budget(cipherText.sealCipherText)];
+        NSNumber *budget = [[NSNumber alloc]initWithInt:_decryptor->invariant_noise_budget(cipherText.sealCipherText)];
+        scope.complete();
+        return budget;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
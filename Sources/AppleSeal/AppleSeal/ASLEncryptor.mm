@@ -8,6 +8,7 @@
 
 #import "ASLEncryptor.h"
 
+#include <mutex>
 #include "seal/encryptor.h"
 
 #import "ASLSealContext_Internal.h"
@@ -16,11 +17,39 @@
 #import "ASLPlainText_Internal.h"
 #import "ASLCipherText_Internal.h"
 #import "ASLMemoryPoolHandle_Internal.h"
+#import "ASLInstrumentation_Internal.h"
+#import "ASLBatchEncoder_Internal.h"
+#import "ASLCKKSEncoder_Internal.h"
 #import "NSString+CXXAdditions.h"
 #import "NSError+CXXAdditions.h"
 
+#pragma mark - Buffer Helpers
+
+/// Calls encode(plain) and encrypts plain into destination, with the secret key if symmetric.
+/// plain is scratch, reused across calls so its allocation is made once; a call that finds
+/// scratch in use by another thread encodes into a temporary instead of waiting.
+template <typename Encode>
+static void ASLEncodeAndEncrypt(seal::Encryptor &encryptor,
+                                std::mutex &scratchMutex,
+                                seal::Plaintext &scratch,
+                                bool symmetric,
+                                seal::Ciphertext &destination,
+                                Encode encode) {
+    std::unique_lock<std::mutex> lock(scratchMutex, std::try_to_lock);
+    seal::Plaintext temporary;
+    seal::Plaintext &plain = lock.owns_lock() ? scratch : temporary;
+    encode(plain);
+    if (symmetric) {
+        encryptor.encrypt_symmetric(plain, destination);
+    } else {
+        encryptor.encrypt(plain, destination);
+    }
+}
+
 @implementation ASLEncryptor {
     seal::Encryptor* _encryptor;
+    std::mutex _scratchMutex;
+    seal::Plaintext _scratchPlainText;
 }
 
 #pragma mark - Initialization
@@ -98,12 +127,13 @@
 - (ASLCipherText *)encryptWithPlainText:(ASLPlainText *)plainText
                                   error:(NSError **)error {
     NSParameterAssert(plainText != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plainText);
     
     seal::Ciphertext destination = seal::Ciphertext();
     
     try {
         _encryptor->encrypt(plainText.sealPlainText, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -123,11 +153,12 @@
                                   error:(NSError **)error {
     NSParameterAssert(plainText != nil);
     NSParameterAssert(pool != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plainText);
     
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _encryptor->encrypt(plainText.sealPlainText, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
         
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -146,11 +177,12 @@
 -(ASLCipherText *)encryptZeroWithCipherText:(ASLCipherText *)cipherText
                                       error:(NSError **)error {
     NSParameterAssert(cipherText != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, cipherText);
     
     seal::Ciphertext sealCipherText = cipherText.sealCipherText;
     try {
         _encryptor->encrypt_zero(sealCipherText);
-        return [[ASLCipherText alloc]initWithCipherText:sealCipherText];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:sealCipherText]);
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
@@ -165,11 +197,12 @@
                                       error:(NSError **)error {
     NSParameterAssert(cipherText != nil);
     NSParameterAssert(pool != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, cipherText);
     
     seal::Ciphertext sealCipherText = cipherText.sealCipherText;
     try {
         _encryptor->encrypt_zero(sealCipherText, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc]initWithCipherText:sealCipherText];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:sealCipherText]);
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
@@ -181,6 +214,7 @@
 
 -(ASLCipherText *)encryptZeroWithParametersId:(ASLParametersIdType)parametersId
                                         error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, (ASLCipherText *)nil);
     
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
@@ -191,7 +225,7 @@
     
     try {
         _encryptor->encrypt_zero(sealParametersId, sealCipherText);
-        return [[ASLCipherText alloc]initWithCipherText:sealCipherText];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:sealCipherText]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -210,6 +244,7 @@
                                          pool:(ASLMemoryPoolHandle *)pool
                                         error:(NSError **)error {
     NSParameterAssert(pool != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, (ASLCipherText *)nil);
     
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
@@ -219,7 +254,7 @@
     
     try {
         _encryptor->encrypt_zero(sealParametersId, sealCipherText, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc]initWithCipherText:sealCipherText];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:sealCipherText]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -237,12 +272,13 @@
 -(ASLCipherText *)encryptSymmetricWithPlainText:(ASLPlainText *)plainText
                                           error:(NSError **)error {
     NSParameterAssert(plainText != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plainText);
     
     seal::Ciphertext sealCipherText = seal::Ciphertext();
     
     try {
         _encryptor->encrypt_symmetric(plainText.sealPlainText, sealCipherText);
-        return [[ASLCipherText alloc]initWithCipherText:sealCipherText];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:sealCipherText]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -261,12 +297,13 @@
                                            pool:(ASLMemoryPoolHandle *)pool
                                           error:(NSError **)error {
     NSParameterAssert(plainText != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plainText);
     
     seal::Ciphertext sealCipherText = seal::Ciphertext();
     
     try {
         _encryptor->encrypt_symmetric(plainText.sealPlainText, sealCipherText, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc]initWithCipherText:sealCipherText];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:sealCipherText]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -284,12 +321,13 @@
 -(ASLCipherText *)encryptZeroSymmetricWithCipherText:(ASLCipherText *)cipherText
                                                error:(NSError **)error {
     NSParameterAssert(cipherText != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, cipherText);
     
     seal::Ciphertext sealCipherText = cipherText.sealCipherText;
     
     try {
         _encryptor->encrypt_zero_symmetric(sealCipherText);
-        return [[ASLCipherText alloc]initWithCipherText:sealCipherText];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:sealCipherText]);
     }  catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
@@ -304,12 +342,13 @@
                                                error:(NSError **)error {
     NSParameterAssert(cipherText != nil);
     NSParameterAssert(pool != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, cipherText);
     
     seal::Ciphertext sealCipherText = cipherText.sealCipherText;
     
     try {
         _encryptor->encrypt_zero_symmetric(sealCipherText, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc]initWithCipherText:sealCipherText];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:sealCipherText]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -326,6 +365,7 @@
 
 -(ASLCipherText *)encryptZeroSymmetricWithParametersId:(ASLParametersIdType)parametersId
                                                  error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, (ASLCipherText *)nil);
     
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
@@ -336,7 +376,7 @@
     
     try {
         _encryptor->encrypt_zero_symmetric(sealParametersId, sealCipherText);
-        return [[ASLCipherText alloc]initWithCipherText:sealCipherText];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:sealCipherText]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -355,6 +395,7 @@
                                                   pool:(ASLMemoryPoolHandle *)pool
                                                  error:(NSError **)error {
     NSParameterAssert(pool != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, (ASLCipherText *)nil);
     
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
@@ -364,7 +405,7 @@
     
     try {
         _encryptor->encrypt_zero_symmetric(sealParametersId, sealCipherText, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc]initWithCipherText:sealCipherText];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:sealCipherText]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -382,9 +423,12 @@
 - (ASLSerializableCipherText *)encryptSerializableSymmetricWithPlain:(ASLPlainText *)plain
                                                                 pool:(ASLMemoryPoolHandle *)pool
                                                                error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
+    
     const seal::Plaintext sealPlainText = plain.sealPlainText;
     try {
         seal::Serializable<seal::Ciphertext> serializableText = _encryptor->encrypt_symmetric(sealPlainText, pool.memoryPoolHandle);
+        scope.complete();
         return [[ASLSerializableCipherText alloc] initWithSerializableCipherText:serializableText];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -402,9 +446,12 @@
 
 - (ASLSerializableCipherText *)encryptSerializableSymmetricWithPlain:(ASLPlainText *)plain
                                                                error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
+    
     const seal::Plaintext sealPlainText = plain.sealPlainText;
     try {
         seal::Serializable<seal::Ciphertext> serializableText = _encryptor->encrypt_symmetric(sealPlainText);
+        scope.complete();
         return [[ASLSerializableCipherText alloc] initWithSerializableCipherText:serializableText];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -423,12 +470,15 @@
 - (ASLSerializableCipherText *)encryptSerializableZeroSymmetricWithParametersId:(ASLParametersIdType)parametersId
                                                                            pool:(ASLMemoryPoolHandle *)pool
                                                                           error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, (ASLCipherText *)nil);
+    
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
               std::end(parametersId.block),
               sealParametersId.begin());
     try {
         seal::Serializable<seal::Ciphertext> serializableText = _encryptor->encrypt_zero_symmetric(sealParametersId, pool.memoryPoolHandle);
+        scope.complete();
         return [[ASLSerializableCipherText alloc] initWithSerializableCipherText:serializableText];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -446,12 +496,15 @@
 
 - (ASLSerializableCipherText *)encryptSerializableZeroSymmetricWithParametersId:(ASLParametersIdType)parametersId
                                                                           error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, (ASLCipherText *)nil);
+    
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
               std::end(parametersId.block),
               sealParametersId.begin());
     try {
         seal::Serializable<seal::Ciphertext> serializableText = _encryptor->encrypt_zero_symmetric(sealParametersId);
+        scope.complete();
         return [[ASLSerializableCipherText alloc] initWithSerializableCipherText:serializableText];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -469,8 +522,11 @@
 
 -(ASLSerializableCipherText *)encryptSerializableZeroSymmetricWithPool:(ASLMemoryPoolHandle *)pool
                                                                  error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, (ASLCipherText *)nil);
+    
     try {
         seal::Serializable<seal::Ciphertext> serializableText = _encryptor->encrypt_zero_symmetric(pool.memoryPoolHandle);
+        scope.complete();
         return [[ASLSerializableCipherText alloc] initWithSerializableCipherText:serializableText];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -487,8 +543,11 @@
 }
 
 - (ASLSerializableCipherText *)encryptSerializableZeroSymmetricWithError:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, (ASLCipherText *)nil);
+    
     try {
         seal::Serializable<seal::Ciphertext> serializableText = _encryptor->encrypt_zero_symmetric();
+        scope.complete();
         return [[ASLSerializableCipherText alloc] initWithSerializableCipherText:serializableText];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -507,6 +566,7 @@
 - (ASLCipherText *)encryptZeroSymmetricWithPool:(ASLParametersIdType)parametersId
                                            pool:(ASLMemoryPoolHandle *)pool
                                           error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, (ASLCipherText *)nil);
     
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
@@ -516,7 +576,7 @@
     
     try {
         _encryptor->encrypt_zero_symmetric(sealParametersId, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc]initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -531,6 +591,42 @@
     return nil;
 }
 
+#pragma mark - Buffers
+
+- (BOOL)encryptUInt64Buffer:(const uint64_t *)values
+                      count:(size_t)count
+                    encoder:(ASLBatchEncoder *)encoder
+                       into:(ASLCipherText *)destination
+                      error:(NSError **)error {
+    return [self encryptUInt64Buffer:values count:count encoder:encoder symmetric:false into:destination operation:_cmd error:error];
+}
+
+- (BOOL)encryptSymmetricUInt64Buffer:(const uint64_t *)values
+                               count:(size_t)count
+                             encoder:(ASLBatchEncoder *)encoder
+                                into:(ASLCipherText *)destination
+                               error:(NSError **)error {
+    return [self encryptUInt64Buffer:values count:count encoder:encoder symmetric:true into:destination operation:_cmd error:error];
+}
+
+- (BOOL)encryptDoubles:(const double *)values
+                 count:(size_t)count
+                 scale:(double)scale
+               encoder:(ASLCKKSEncoder *)encoder
+                  into:(ASLCipherText *)destination
+                 error:(NSError **)error {
+    return [self encryptDoubles:values count:count scale:scale encoder:encoder symmetric:false into:destination operation:_cmd error:error];
+}
+
+- (BOOL)encryptSymmetricDoubles:(const double *)values
+                          count:(size_t)count
+                          scale:(double)scale
+                        encoder:(ASLCKKSEncoder *)encoder
+                           into:(ASLCipherText *)destination
+                          error:(NSError **)error {
+    return [self encryptDoubles:values count:count scale:scale encoder:encoder symmetric:true into:destination operation:_cmd error:error];
+}
+
 - (BOOL)setPublicKey:(ASLPublicKey *)publicKey
                error:(NSError **)error {
     NSParameterAssert(publicKey != nil);
@@ -561,4 +657,69 @@
     }
 }
 
+#pragma mark - Private Methods
+
+- (BOOL)encryptUInt64Buffer:(const uint64_t *)values
+                      count:(size_t)count
+                    encoder:(ASLBatchEncoder *)encoder
+                  symmetric:(bool)symmetric
+                       into:(ASLCipherText *)destination
+                  operation:(SEL)operation
+                      error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    NSParameterAssert(encoder != nil);
+    NSParameterAssert(destination != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, operation, (ASLCipherText *)nil);
+    
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        ASLEncodeAndEncrypt(*_encryptor, _scratchMutex, _scratchPlainText, symmetric, sealDestination, [&](seal::Plaintext &plain) {
+            [encoder encodeUInt64Buffer:values count:count intoSealPlainText:plain];
+        });
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+- (BOOL)encryptDoubles:(const double *)values
+                 count:(size_t)count
+                 scale:(double)scale
+               encoder:(ASLCKKSEncoder *)encoder
+             symmetric:(bool)symmetric
+                  into:(ASLCipherText *)destination
+             operation:(SEL)operation
+                 error:(NSError **)error {
+    NSParameterAssert(values != NULL || count == 0);
+    NSParameterAssert(encoder != nil);
+    NSParameterAssert(destination != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, operation, (ASLCipherText *)nil);
+    
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        ASLEncodeAndEncrypt(*_encryptor, _scratchMutex, _scratchPlainText, symmetric, sealDestination, [&](seal::Plaintext &plain) {
+            [encoder encodeDoubles:values count:count scale:scale intoSealPlainText:plain];
+        });
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 @end
@@ -0,0 +1,533 @@
+//
+//  ASLEvaluationGraph.mm
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLEvaluationGraph.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "seal/evaluator.h"
+
+#import "ASLEvaluator_Internal.h"
+#import "ASLCipherText_Internal.h"
+#import "ASLPlainText_Internal.h"
+#import "ASLRelinearizationKeys_Internal.h"
+#import "ASLGaloisKeys_Internal.h"
+#import "ASLInstrumentation_Internal.h"
+#import "NSError+CXXAdditions.h"
+
+namespace {
+
+enum class ASLGraphOperation {
+    Input,
+    Negate,
+    Add,
+    Sub,
+    Multiply,
+    Square,
+    AddPlain,
+    MultiplyPlain,
+    Relinearize,
+    RescaleToNext,
+    ModSwitchToNext,
+    RotateRows,
+    RotateVector,
+};
+
+struct ASLGraphNode {
+    ASLGraphOperation operation;
+    std::vector<size_t> operands;
+    /// The index into the graph's inputs for Input nodes, or into its plaintexts for plain nodes
+    size_t payload = 0;
+    int steps = 0;
+};
+
+/// A copy of the recorded nodes rewritten and scheduled for one evaluation.
+struct ASLGraphPlan {
+    std::vector<ASLGraphNode> nodes;
+    std::vector<bool> live;
+    std::vector<bool> output;
+    std::vector<size_t> consumers;
+    std::vector<std::vector<size_t>> waves;
+
+    /// Whether the node's value is used exactly once and not requested, so it may be
+    /// moved into its consumer or rewritten.
+    bool isSole(size_t node) const {
+        return consumers[node] == 1 && !output[node];
+    }
+};
+
+void ASLMarkLiveNodes(ASLGraphPlan &plan, std::vector<size_t> const &outputs) {
+    plan.live.assign(plan.nodes.size(), false);
+    plan.output.assign(plan.nodes.size(), false);
+    std::vector<size_t> pending(outputs);
+    for (size_t const output : outputs) {
+        plan.output[output] = true;
+    }
+    while (!pending.empty()) {
+        size_t const node = pending.back();
+        pending.pop_back();
+        if (plan.live[node]) {
+            continue;
+        }
+        plan.live[node] = true;
+        for (size_t const operand : plan.nodes[node].operands) {
+            pending.push_back(operand);
+        }
+    }
+}
+
+void ASLCountConsumers(ASLGraphPlan &plan) {
+    plan.consumers.assign(plan.nodes.size(), 0);
+    for (size_t node = 0; node < plan.nodes.size(); ++node) {
+        if (!plan.live[node]) {
+            continue;
+        }
+        for (size_t const operand : plan.nodes[node].operands) {
+            plan.consumers[operand] += 1;
+        }
+    }
+}
+
+/// Rewrites op(wrap(x), wrap(y)) into wrap(op(x, y)) for additive op and wrap one of
+/// relinearize or rescale, and wrap(relinearize(x)) into relinearize(wrap(x)) for wrap
+/// one of rescale or modulus switch. Returns whether anything was rewritten.
+bool ASLHoistWrappers(ASLGraphPlan &plan) {
+    bool changed = false;
+    size_t const count = plan.nodes.size();
+    for (size_t node = 0; node < count; ++node) {
+        if (!plan.live[node]) {
+            continue;
+        }
+        ASLGraphOperation const operation = plan.nodes[node].operation;
+        if (operation == ASLGraphOperation::Add || operation == ASLGraphOperation::Sub) {
+            size_t const first = plan.nodes[node].operands[0];
+            size_t const second = plan.nodes[node].operands[1];
+            ASLGraphOperation const wrapper = plan.nodes[first].operation;
+            if (first == second || plan.nodes[second].operation != wrapper ||
+                (wrapper != ASLGraphOperation::Relinearize && wrapper != ASLGraphOperation::RescaleToNext) ||
+                !plan.isSole(first) || !plan.isSole(second)) {
+                continue;
+            }
+
+            size_t const combined = plan.nodes.size();
+            ASLGraphNode inner;
+            inner.operation = operation;
+            inner.operands = {plan.nodes[first].operands[0], plan.nodes[second].operands[0]};
+            plan.nodes.push_back(inner);
+            plan.live.push_back(true);
+            plan.output.push_back(false);
+            plan.consumers.push_back(1);
+
+            plan.nodes[node].operation = wrapper;
+            plan.nodes[node].operands = {combined};
+            plan.live[first] = false;
+            plan.live[second] = false;
+            plan.consumers[first] = 0;
+            plan.consumers[second] = 0;
+            changed = true;
+        } else if (operation == ASLGraphOperation::RescaleToNext || operation == ASLGraphOperation::ModSwitchToNext) {
+            size_t const operand = plan.nodes[node].operands[0];
+            if (plan.nodes[operand].operation != ASLGraphOperation::Relinearize || !plan.isSole(operand)) {
+                continue;
+            }
+            plan.nodes[operand].operation = operation;
+            plan.nodes[node].operation = ASLGraphOperation::Relinearize;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+/// Groups the live nodes into waves so that every node only depends on nodes of earlier waves.
+void ASLScheduleWaves(ASLGraphPlan &plan) {
+    size_t const unscheduled = SIZE_MAX;
+    std::vector<size_t> depth(plan.nodes.size(), unscheduled);
+    std::vector<size_t> pending;
+    for (size_t root = 0; root < plan.nodes.size(); ++root) {
+        if (!plan.live[root] || depth[root] != unscheduled) {
+            continue;
+        }
+        pending.push_back(root);
+        while (!pending.empty()) {
+            size_t const node = pending.back();
+            size_t nodeDepth = 0;
+            bool ready = true;
+            for (size_t const operand : plan.nodes[node].operands) {
+                if (depth[operand] == unscheduled) {
+                    pending.push_back(operand);
+                    ready = false;
+                } else {
+                    nodeDepth = std::max(nodeDepth, depth[operand] + 1);
+                }
+            }
+            if (ready) {
+                pending.pop_back();
+                if (depth[node] == unscheduled) {
+                    depth[node] = nodeDepth;
+                    if (plan.waves.size() <= nodeDepth) {
+                        plan.waves.resize(nodeDepth + 1);
+                    }
+                    plan.waves[nodeDepth].push_back(node);
+                }
+            }
+        }
+    }
+}
+
+}
+
+@interface ASLEvaluationNode ()
+
+@property (nonatomic, readonly, weak) ASLEvaluationGraph *graph;
+
+- (instancetype)initWithGraph:(ASLEvaluationGraph *)graph
+                        index:(NSUInteger)index;
+
+@end
+
+@implementation ASLEvaluationNode
+
+- (instancetype)initWithGraph:(ASLEvaluationGraph *)graph
+                        index:(NSUInteger)index {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+    _graph = graph;
+    _index = index;
+
+    return self;
+}
+
+@end
+
+@implementation ASLEvaluationGraph {
+    ASLEvaluator *_evaluator;
+    std::vector<ASLGraphNode> _nodes;
+    NSMutableArray<ASLCipherText *> *_inputs;
+    NSMutableArray<ASLPlainText *> *_plains;
+}
+
+#pragma mark - Initialization
+
++ (instancetype)graphWithEvaluator:(ASLEvaluator *)evaluator {
+    NSParameterAssert(evaluator != nil);
+    return [[ASLEvaluationGraph alloc] initWithEvaluator:evaluator];
+}
+
+- (instancetype)initWithEvaluator:(ASLEvaluator *)evaluator {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+    _evaluator = evaluator;
+    _inputs = [NSMutableArray array];
+    _plains = [NSMutableArray array];
+    _optimizationEnabled = YES;
+
+    return self;
+}
+
+#pragma mark - Properties
+
+- (NSUInteger)nodeCount {
+    return _nodes.size();
+}
+
+#pragma mark - Recording
+
+- (ASLEvaluationNode *)input:(ASLCipherText *)encrypted {
+    NSParameterAssert(encrypted != nil);
+
+    ASLGraphNode node;
+    node.operation = ASLGraphOperation::Input;
+    node.payload = _inputs.count;
+    [_inputs addObject:encrypted];
+    return [self recordNode:node];
+}
+
+- (ASLEvaluationNode *)negate:(ASLEvaluationNode *)encrypted {
+    return [self recordOperation:ASLGraphOperation::Negate operand:encrypted];
+}
+
+- (ASLEvaluationNode *)add:(ASLEvaluationNode *)encrypted1
+                encrypted2:(ASLEvaluationNode *)encrypted2 {
+    return [self recordOperation:ASLGraphOperation::Add operand:encrypted1 operand:encrypted2];
+}
+
+- (ASLEvaluationNode *)sub:(ASLEvaluationNode *)encrypted1
+                encrypted2:(ASLEvaluationNode *)encrypted2 {
+    return [self recordOperation:ASLGraphOperation::Sub operand:encrypted1 operand:encrypted2];
+}
+
+- (ASLEvaluationNode *)multiply:(ASLEvaluationNode *)encrypted1
+                     encrypted2:(ASLEvaluationNode *)encrypted2 {
+    return [self recordOperation:ASLGraphOperation::Multiply operand:encrypted1 operand:encrypted2];
+}
+
+- (ASLEvaluationNode *)square:(ASLEvaluationNode *)encrypted {
+    return [self recordOperation:ASLGraphOperation::Square operand:encrypted];
+}
+
+- (ASLEvaluationNode *)addPlain:(ASLEvaluationNode *)encrypted
+                          plain:(ASLPlainText *)plain {
+    return [self recordOperation:ASLGraphOperation::AddPlain operand:encrypted plain:plain];
+}
+
+- (ASLEvaluationNode *)multiplyPlain:(ASLEvaluationNode *)encrypted
+                               plain:(ASLPlainText *)plain {
+    return [self recordOperation:ASLGraphOperation::MultiplyPlain operand:encrypted plain:plain];
+}
+
+- (ASLEvaluationNode *)relinearize:(ASLEvaluationNode *)encrypted {
+    return [self recordOperation:ASLGraphOperation::Relinearize operand:encrypted];
+}
+
+- (ASLEvaluationNode *)rescaleToNext:(ASLEvaluationNode *)encrypted {
+    return [self recordOperation:ASLGraphOperation::RescaleToNext operand:encrypted];
+}
+
+- (ASLEvaluationNode *)modSwitchToNext:(ASLEvaluationNode *)encrypted {
+    return [self recordOperation:ASLGraphOperation::ModSwitchToNext operand:encrypted];
+}
+
+- (ASLEvaluationNode *)rotateRows:(ASLEvaluationNode *)encrypted
+                            steps:(int)steps {
+    return [self recordOperation:ASLGraphOperation::RotateRows operand:encrypted steps:steps];
+}
+
+- (ASLEvaluationNode *)rotateVector:(ASLEvaluationNode *)encrypted
+                              steps:(int)steps {
+    return [self recordOperation:ASLGraphOperation::RotateVector operand:encrypted steps:steps];
+}
+
+#pragma mark - Evaluation
+
+- (ASLCipherText *)evaluate:(ASLEvaluationNode *)output
+                      error:(NSError **)error {
+    NSParameterAssert(output != nil);
+    return [self evaluateOutputs:@[output] error:error].firstObject;
+}
+
+- (NSArray<ASLCipherText *> *)evaluateOutputs:(NSArray<ASLEvaluationNode *> *)outputs
+                                        error:(NSError **)error {
+    NSParameterAssert(outputs != nil);
+
+    ASLInstrumentationScope scope(_evaluator.instrumentation, self, _cmd, _inputs);
+    std::vector<size_t> outputIndices;
+    for (ASLEvaluationNode * const output in outputs) {
+        NSParameterAssert(output.graph == self);
+        outputIndices.push_back(output.index);
+    }
+
+    ASLGraphPlan plan;
+    plan.nodes = _nodes;
+    ASLMarkLiveNodes(plan, outputIndices);
+    ASLCountConsumers(plan);
+    if (self.isOptimizationEnabled) {
+        while (ASLHoistWrappers(plan)) {}
+    }
+    ASLScheduleWaves(plan);
+
+    std::vector<seal::Ciphertext const *> inputs;
+    for (ASLCipherText * const input in _inputs) {
+        inputs.push_back(&[input sealCipherTextReference]);
+    }
+    std::vector<seal::Plaintext const *> plains;
+    for (ASLPlainText * const plain in _plains) {
+        plains.push_back(&[plain sealPlainTextReference]);
+    }
+    seal::RelinKeys const *relinKeys = self.relinearizationKeys != nil ? &[self.relinearizationKeys sealRelinKeysReference] : nullptr;
+    seal::GaloisKeys const *galoisKeys = self.galoisKeys != nil ? &[self.galoisKeys sealGaloisKeysReference] : nullptr;
+    seal::Evaluator &evaluator = [_evaluator sealEvaluatorReference];
+    std::vector<seal::Ciphertext> results(plan.nodes.size());
+    seal::MemoryPoolHandle const resultPool = seal::MemoryManager::GetPool();
+
+    auto value = [&](size_t node) -> seal::Ciphertext const & {
+        if (plan.nodes[node].operation == ASLGraphOperation::Input) {
+            return *inputs[plan.nodes[node].payload];
+        }
+        return results[node];
+    };
+
+    // Loads an operand into the destination, moving it when nothing else reads it.
+    auto load = [&](seal::Ciphertext &destination, size_t operand) {
+        if (plan.nodes[operand].operation != ASLGraphOperation::Input && plan.isSole(operand)) {
+            destination = std::move(results[operand]);
+        } else {
+            destination = value(operand);
+        }
+    };
+
+    auto execute = [&](size_t node, seal::MemoryPoolHandle const &pool) {
+        ASLGraphNode const &graphNode = plan.nodes[node];
+        if (graphNode.operation == ASLGraphOperation::Input) {
+            return;
+        }
+
+        // Results may be returned as outputs, so only the temporaries of the operation use
+        // the worker pool.
+        seal::Ciphertext &destination = results[node];
+        destination = seal::Ciphertext(resultPool);
+        size_t first = graphNode.operands[0];
+        size_t second = graphNode.operands.size() > 1 ? graphNode.operands[1] : first;
+        bool const commutative = graphNode.operation == ASLGraphOperation::Add || graphNode.operation == ASLGraphOperation::Multiply;
+        if (commutative && first != second && plan.isSole(second) && plan.nodes[second].operation != ASLGraphOperation::Input) {
+            std::swap(first, second);
+        }
+        load(destination, first);
+
+        switch (graphNode.operation) {
+            case ASLGraphOperation::Input:
+                break;
+            case ASLGraphOperation::Negate:
+                evaluator.negate_inplace(destination);
+                break;
+            case ASLGraphOperation::Add:
+                evaluator.add_inplace(destination, value(second));
+                break;
+            case ASLGraphOperation::Sub:
+                evaluator.sub_inplace(destination, value(second));
+                break;
+            case ASLGraphOperation::Multiply:
+                if (first == second) {
+                    evaluator.square_inplace(destination, pool);
+                } else {
+                    evaluator.multiply_inplace(destination, value(second), pool);
+                }
+                break;
+            case ASLGraphOperation::Square:
+                evaluator.square_inplace(destination, pool);
+                break;
+            case ASLGraphOperation::AddPlain:
+                evaluator.add_plain_inplace(destination, *plains[graphNode.payload]);
+                break;
+            case ASLGraphOperation::MultiplyPlain:
+                evaluator.multiply_plain_inplace(destination, *plains[graphNode.payload], pool);
+                break;
+            case ASLGraphOperation::Relinearize:
+                if (destination.size() > 2) {
+                    if (relinKeys == nullptr) {
+                        throw std::invalid_argument("relinearizationKeys must be set to relinearize");
+                    }
+                    evaluator.relinearize_inplace(destination, *relinKeys, pool);
+                }
+                break;
+            case ASLGraphOperation::RescaleToNext:
+                evaluator.rescale_to_next_inplace(destination, pool);
+                break;
+            case ASLGraphOperation::ModSwitchToNext:
+                evaluator.mod_switch_to_next_inplace(destination, pool);
+                break;
+            case ASLGraphOperation::RotateRows:
+            case ASLGraphOperation::RotateVector:
+                if (galoisKeys == nullptr) {
+                    throw std::invalid_argument("galoisKeys must be set to rotate");
+                }
+                if (graphNode.operation == ASLGraphOperation::RotateRows) {
+                    evaluator.rotate_rows_inplace(destination, graphNode.steps, *galoisKeys, pool);
+                } else {
+                    evaluator.rotate_vector_inplace(destination, graphNode.steps, *galoisKeys, pool);
+                }
+                break;
+        }
+    };
+
+    try {
+        size_t const concurrency = _evaluator.batchConcurrency;
+        for (std::vector<size_t> const &wave : plan.waves) {
+            ASLParallelFor(wave.size(), concurrency, [&](size_t index, seal::MemoryPoolHandle const &pool) {
+                execute(wave[index], pool);
+            });
+        }
+
+        NSMutableArray<ASLCipherText *> * const result = [NSMutableArray arrayWithCapacity:outputIndices.size()];
+        NSMutableDictionary<NSNumber *, ASLCipherText *> * const computed = [NSMutableDictionary dictionary];
+        for (size_t const output : outputIndices) {
+            ASLCipherText *cipherText = computed[@(output)];
+            if (cipherText != nil) {
+                cipherText = [cipherText copy];
+            } else if (plan.nodes[output].operation == ASLGraphOperation::Input) {
+                cipherText = [[ASLCipherText alloc] initWithCipherText:value(output)];
+            } else {
+                cipherText = [[ASLCipherText alloc] initWithCipherText:std::move(results[output])];
+            }
+            computed[@(output)] = cipherText;
+            [result addObject:cipherText];
+        }
+        return scope.complete(result);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+#pragma mark - Private Methods
+
+- (ASLEvaluationNode *)recordNode:(ASLGraphNode)node {
+    _nodes.push_back(std::move(node));
+    return [[ASLEvaluationNode alloc] initWithGraph:self index:_nodes.size() - 1];
+}
+
+- (ASLEvaluationNode *)recordOperation:(ASLGraphOperation)operation
+                               operand:(ASLEvaluationNode *)operand {
+    NSParameterAssert(operand != nil && operand.graph == self);
+
+    ASLGraphNode node;
+    node.operation = operation;
+    node.operands = {operand.index};
+    return [self recordNode:node];
+}
+
+- (ASLEvaluationNode *)recordOperation:(ASLGraphOperation)operation
+                               operand:(ASLEvaluationNode *)operand1
+                               operand:(ASLEvaluationNode *)operand2 {
+    NSParameterAssert(operand1 != nil && operand1.graph == self);
+    NSParameterAssert(operand2 != nil && operand2.graph == self);
+
+    ASLGraphNode node;
+    node.operation = operation;
+    node.operands = {operand1.index, operand2.index};
+    return [self recordNode:node];
+}
+
+- (ASLEvaluationNode *)recordOperation:(ASLGraphOperation)operation
+                               operand:(ASLEvaluationNode *)operand
+                                 plain:(ASLPlainText *)plain {
+    NSParameterAssert(operand != nil && operand.graph == self);
+    NSParameterAssert(plain != nil);
+
+    ASLGraphNode node;
+    node.operation = operation;
+    node.operands = {operand.index};
+    node.payload = _plains.count;
+    [_plains addObject:plain];
+    return [self recordNode:node];
+}
+
+- (ASLEvaluationNode *)recordOperation:(ASLGraphOperation)operation
+                               operand:(ASLEvaluationNode *)operand
+                                 steps:(int)steps {
+    NSParameterAssert(operand != nil && operand.graph == self);
+
+    ASLGraphNode node;
+    node.operation = operation;
+    node.operands = {operand.index};
+    node.steps = steps;
+    return [self recordNode:node];
+}
+
+@end
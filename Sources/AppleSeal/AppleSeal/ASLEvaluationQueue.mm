@@ -0,0 +1,278 @@
+//
+//  ASLEvaluationQueue.mm
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLEvaluationQueue.h"
+#import "ASLEvaluationQueue_Internal.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+NSString * const ASLEvaluationQueueErrorDomain = @"ASLEvaluationQueueErrorDomain";
+
+NSError *ASLEvaluationCancelledError(void) {
+    return [[NSError alloc] initWithDomain:ASLEvaluationQueueErrorDomain
+                                      code:ASLEvaluationQueueErrorCodeCancelled
+                                  userInfo:@{NSDebugDescriptionErrorKey : @"the task was cancelled"}];
+}
+
+/// The life cycle of a task. A task leaves ASLTaskStateWaiting or ASLTaskStateRunning exactly
+/// once, by a compare-and-swap, so whichever of the worker and a canceller wins owns the
+/// remaining blocks of the task.
+typedef NS_ENUM(NSInteger, ASLTaskState) {
+    ASLTaskStateWaiting = 0,
+    ASLTaskStateRunning,
+    ASLTaskStateFinished,
+    ASLTaskStateCancelled,
+};
+
+static constexpr size_t ASLEvaluationPriorityCount = ASLEvaluationPriorityHigh + 1;
+
+@interface ASLEvaluationQueue ()
+
+- (void)removeWaitingTask:(ASLEvaluationTask *)task;
+
+@end
+
+#pragma mark - ASLEvaluationTask
+
+@implementation ASLEvaluationTask {
+    std::atomic<NSInteger> _state;
+    void (^_block)(ASLEvaluationTask *);
+    void (^_cancellationHandler)(void);
+    __weak ASLEvaluationQueue *_queue;
+}
+
+- (instancetype)initWithPriority:(ASLEvaluationPriority)priority
+                           block:(void (^)(ASLEvaluationTask *))block
+             cancellationHandler:(void (^)(void))cancellationHandler
+                           queue:(ASLEvaluationQueue *)queue {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+    _priority = priority;
+    _state.store(ASLTaskStateWaiting);
+    _block = [block copy];
+    _cancellationHandler = [cancellationHandler copy];
+    _queue = queue;
+    return self;
+}
+
+- (BOOL)isCancelled {
+    return _state.load() == ASLTaskStateCancelled;
+}
+
+- (BOOL)isFinished {
+    return _state.load() == ASLTaskStateFinished;
+}
+
+- (BOOL)cancel {
+    NSInteger state = ASLTaskStateWaiting;
+    if (_state.compare_exchange_strong(state, ASLTaskStateCancelled)) {
+        _block = nil;
+        [_queue removeWaitingTask:self];
+    } else if (state != ASLTaskStateRunning || !_state.compare_exchange_strong(state, ASLTaskStateCancelled)) {
+        return NO;
+    }
+    void (^const cancellationHandler)(void) = _cancellationHandler;
+    _cancellationHandler = nil;
+    if (cancellationHandler != nil) {
+        cancellationHandler();
+    }
+    return YES;
+}
+
+- (BOOL)markFinished {
+    NSInteger state = ASLTaskStateRunning;
+    if (!_state.compare_exchange_strong(state, ASLTaskStateFinished)) {
+        return NO;
+    }
+    _cancellationHandler = nil;
+    return YES;
+}
+
+- (void)run {
+    NSInteger state = ASLTaskStateWaiting;
+    if (!_state.compare_exchange_strong(state, ASLTaskStateRunning)) {
+        return;
+    }
+    void (^const block)(ASLEvaluationTask *) = _block;
+    _block = nil;
+    block(self);
+    [self markFinished];
+}
+
+@end
+
+#pragma mark - ASLEvaluationQueue
+
+@implementation ASLEvaluationQueue {
+    std::mutex _mutex;
+    std::condition_variable _idle;
+    std::array<std::deque<ASLEvaluationTask *>, ASLEvaluationPriorityCount> _waitingTasks;
+    std::vector<ASLEvaluationTask *> _runningTasks;
+    NSUInteger _workerCount;
+}
+
++ (instancetype)queueWithMaximumConcurrentTasks:(NSUInteger)maximumConcurrentTasks
+                                       capacity:(NSUInteger)capacity {
+    NSParameterAssert(maximumConcurrentTasks > 0);
+    NSParameterAssert(capacity > 0);
+
+    return [[ASLEvaluationQueue alloc] initWithMaximumConcurrentTasks:maximumConcurrentTasks capacity:capacity];
+}
+
++ (ASLEvaluationQueue *)defaultQueue {
+    static ASLEvaluationQueue *defaultQueue = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        defaultQueue = [ASLEvaluationQueue queueWithMaximumConcurrentTasks:NSProcessInfo.processInfo.activeProcessorCount
+                                                                  capacity:1024];
+    });
+    return defaultQueue;
+}
+
+- (instancetype)initWithMaximumConcurrentTasks:(NSUInteger)maximumConcurrentTasks
+                                      capacity:(NSUInteger)capacity {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+    _maximumConcurrentTasks = maximumConcurrentTasks;
+    _capacity = capacity;
+    _workerCount = 0;
+    return self;
+}
+
+#pragma mark - Properties
+
+- (NSUInteger)waitingTaskCount {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return [self waitingTaskCountLocked];
+}
+
+- (NSUInteger)runningTaskCount {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _runningTasks.size();
+}
+
+#pragma mark - Public Methods
+
+- (ASLEvaluationTask *)submitWithPriority:(ASLEvaluationPriority)priority
+                                    block:(void (^)(ASLEvaluationTask *task))block
+                      cancellationHandler:(void (^)(void))cancellationHandler
+                                    error:(NSError **)error {
+    NSParameterAssert(priority >= ASLEvaluationPriorityLow && priority <= ASLEvaluationPriorityHigh);
+    NSParameterAssert(block != nil);
+
+    ASLEvaluationTask * const task = [[ASLEvaluationTask alloc] initWithPriority:priority
+                                                                           block:block
+                                                             cancellationHandler:cancellationHandler
+                                                                           queue:self];
+    bool startsWorker = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if ([self waitingTaskCountLocked] >= _capacity) {
+            if (error != nil) {
+                *error = [[NSError alloc] initWithDomain:ASLEvaluationQueueErrorDomain
+                                                    code:ASLEvaluationQueueErrorCodeFull
+                                                userInfo:@{NSDebugDescriptionErrorKey : @"the queue is full"}];
+            }
+            return nil;
+        }
+        _waitingTasks[priority].push_back(task);
+        if (_workerCount < _maximumConcurrentTasks) {
+            ++_workerCount;
+            startsWorker = true;
+        }
+    }
+    if (startsWorker) {
+        dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+            [self drain];
+        });
+    }
+    return task;
+}
+
+- (void)cancelAllTasks {
+    std::vector<ASLEvaluationTask *> tasks;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto waitingTasks = _waitingTasks.rbegin(); waitingTasks != _waitingTasks.rend(); ++waitingTasks) {
+            tasks.insert(tasks.end(), waitingTasks->begin(), waitingTasks->end());
+            waitingTasks->clear();
+        }
+        tasks.insert(tasks.end(), _runningTasks.begin(), _runningTasks.end());
+    }
+    for (ASLEvaluationTask * const task : tasks) {
+        [task cancel];
+    }
+}
+
+- (void)waitUntilAllTasksAreFinished {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [self] { return _workerCount == 0; });
+}
+
+#pragma mark - Private Methods
+
+- (NSUInteger)waitingTaskCountLocked {
+    NSUInteger count = 0;
+    for (std::deque<ASLEvaluationTask *> const &waitingTasks : _waitingTasks) {
+        count += waitingTasks.size();
+    }
+    return count;
+}
+
+- (void)removeWaitingTask:(ASLEvaluationTask *)task {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::deque<ASLEvaluationTask *> &waitingTasks = _waitingTasks[task.priority];
+    auto const position = std::find(waitingTasks.begin(), waitingTasks.end(), task);
+    if (position != waitingTasks.end()) {
+        waitingTasks.erase(position);
+    }
+}
+
+/// Runs waiting tasks, highest priority first, until none are left. A worker only exits
+/// with no task waiting, so every submitted task is eventually started by some worker.
+- (void)drain {
+    while (true) {
+        ASLEvaluationTask *task = nil;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto waitingTasks = _waitingTasks.rbegin(); waitingTasks != _waitingTasks.rend(); ++waitingTasks) {
+                if (!waitingTasks->empty()) {
+                    task = waitingTasks->front();
+                    waitingTasks->pop_front();
+                    break;
+                }
+            }
+            if (task == nil) {
+                if (--_workerCount == 0) {
+                    _idle.notify_all();
+                }
+                return;
+            }
+            _runningTasks.push_back(task);
+        }
+        @autoreleasepool {
+            [task run];
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _runningTasks.erase(std::find(_runningTasks.begin(), _runningTasks.end(), task));
+        }
+    }
+}
+
+@end
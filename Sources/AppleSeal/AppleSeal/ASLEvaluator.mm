@@ -7,8 +7,23 @@
 //
 
 #import "ASLEvaluator.h"
+#import "ASLEvaluator_Internal.h"
 
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "seal/ckks.h"
 #include "seal/evaluator.h"
+#include "seal/valcheck.h"
 
 #import "ASLSealContextData_Internal.h"
 #import "ASLSealContext_Internal.h"
@@ -17,12 +32,1023 @@
 #import "ASLRelinearizationKeys_Internal.h"
 #import "ASLPlainText_Internal.h"
 #import "ASLGaloisKeys_Internal.h"
+#import "ASLPlainMatrix_Internal.h"
+#import "ASLPreparedPlainText_Internal.h"
+#import "ASLSlotPermutation_Internal.h"
+#import "ASLSignApproximation_Internal.h"
+#import "ASLInstrumentation_Internal.h"
+#import "ASLEvaluationQueue_Internal.h"
 #import "ASLMemoryPoolHandle_Internal.h"
 #import "NSString+CXXAdditions.h"
 #import "NSError+CXXAdditions.h"
 
+#pragma mark - Batch Helpers
+
+static std::vector<seal::Ciphertext const *> ASLCipherTextReferences(NSArray<ASLCipherText *> *cipherTexts) {
+    std::vector<seal::Ciphertext const *> references;
+    references.reserve(cipherTexts.count);
+    for (ASLCipherText * const cipherText in cipherTexts) {
+        references.push_back(&[cipherText sealCipherTextReference]);
+    }
+    return references;
+}
+
+static NSArray<ASLCipherText *> *ASLCipherTextArray(std::vector<seal::Ciphertext> &cipherTexts) {
+    NSMutableArray<ASLCipherText *> * const result = [NSMutableArray arrayWithCapacity:cipherTexts.size()];
+    for (seal::Ciphertext &cipherText : cipherTexts) {
+        [result addObject:[[ASLCipherText alloc] initWithCipherText:std::move(cipherText)]];
+    }
+    return result;
+}
+
+#pragma mark - Rotation Helpers
+
+/// Returns the number of non-zero digits in the non-adjacent form of value, which is the
+/// number of key switches SEAL performs to rotate by value with power-of-two Galois keys.
+static size_t ASLNafWeight(int64_t value) {
+    size_t weight = 0;
+    value = std::abs(value);
+    while (value != 0) {
+        if (value & 1) {
+            weight += 1;
+            value += (value & 2) ? 1 : -1;
+        }
+        value >>= 1;
+    }
+    return weight;
+}
+
+/// Returns the Galois element of a rotation by step in [1, N/2), matching the element
+/// SEAL uses for rotateRows and rotateVector.
+static uint32_t ASLGaloisElementFromStep(size_t polyModulusDegree, uint64_t step) {
+    uint64_t const mask = (static_cast<uint64_t>(polyModulusDegree) << 1) - 1;
+    uint64_t element = 1;
+    uint64_t power = 3;
+    for (; step != 0; step >>= 1) {
+        if (step & 1) {
+            element = (element * power) & mask;
+        }
+        power = (power * power) & mask;
+    }
+    return static_cast<uint32_t>(element);
+}
+
+/// Rotates encrypted by every step in steps. Rotations are computed in waves: each pending
+/// step is rotated from the input or from an already rotated result, whichever needs the
+/// fewest key switches, and the cheapest rotations of a wave run concurrently. A step with
+/// its own Galois key, or within one keyed step of an earlier result, costs one key switch.
+/// The rotated ciphertexts are returned, so they are allocated from the global pool and the
+/// worker pools only hold key-switching temporaries.
+static std::vector<seal::Ciphertext> ASLRotateBySteps(seal::Evaluator &evaluator,
+                                                      seal::Ciphertext const &encrypted,
+                                                      std::vector<int> const &steps,
+                                                      seal::GaloisKeys const &galoisKeys,
+                                                      bool rotateRows,
+                                                      size_t concurrency) {
+    size_t const polyModulusDegree = encrypted.poly_modulus_degree();
+    int64_t const half = static_cast<int64_t>(polyModulusDegree >> 1);
+    auto normalize = [half](int64_t step) {
+        return ((step % half) + half) % half;
+    };
+    
+    // Returns the key switches needed to rotate by a normalized distance and the signed step to pass to SEAL.
+    auto plan = [&](int64_t distance, int &signedStep) -> size_t {
+        if (galoisKeys.has_key(ASLGaloisElementFromStep(polyModulusDegree, distance))) {
+            signedStep = static_cast<int>(distance);
+            return 1;
+        }
+        size_t const forward = ASLNafWeight(distance);
+        size_t const backward = ASLNafWeight(distance - half);
+        signedStep = static_cast<int>(forward <= backward ? distance : distance - half);
+        return std::min(forward, backward);
+    };
+    
+    std::map<int64_t, size_t> uses;
+    for (int const step : steps) {
+        if (std::abs(static_cast<int64_t>(step)) >= half) {
+            throw std::invalid_argument("step count too large");
+        }
+        uses[normalize(step)] += 1;
+    }
+    std::vector<int64_t> pending;
+    for (auto const &use : uses) {
+        if (use.first != 0) {
+            pending.push_back(use.first);
+        }
+    }
+    
+    struct ASLRotation {
+        int64_t step;
+        int64_t base;
+        int signedStep;
+        size_t cost;
+    };
+    std::map<int64_t, seal::Ciphertext> rotated;
+    while (!pending.empty()) {
+        std::vector<ASLRotation> candidates;
+        size_t minimumCost = SIZE_MAX;
+        for (int64_t const step : pending) {
+            ASLRotation best = {step, 0, 0, 0};
+            best.cost = plan(step, best.signedStep);
+            for (auto const &entry : rotated) {
+                if (best.cost <= 1) {
+                    break;
+                }
+                int signedStep = 0;
+                size_t const cost = plan(normalize(step - entry.first), signedStep);
+                if (cost < best.cost) {
+                    best = {step, entry.first, signedStep, cost};
+                }
+            }
+            minimumCost = std::min(minimumCost, best.cost);
+            candidates.push_back(best);
+        }
+        
+        std::vector<ASLRotation> wave;
+        std::vector<int64_t> deferred;
+        for (ASLRotation const &candidate : candidates) {
+            if (candidate.cost == minimumCost) {
+                wave.push_back(candidate);
+            } else {
+                deferred.push_back(candidate.step);
+            }
+        }
+        
+        std::vector<seal::Ciphertext> waveResults(wave.size());
+        ASLParallelFor(wave.size(), concurrency, [&](size_t index, seal::MemoryPoolHandle const &pool) {
+            ASLRotation const &rotation = wave[index];
+            seal::Ciphertext const &base = rotation.base == 0 ? encrypted : rotated.at(rotation.base);
+            waveResults[index] = seal::Ciphertext(seal::MemoryManager::GetPool());
+            if (rotateRows) {
+                evaluator.rotate_rows(base, rotation.signedStep, galoisKeys, waveResults[index], pool);
+            } else {
+                evaluator.rotate_vector(base, rotation.signedStep, galoisKeys, waveResults[index], pool);
+            }
+        });
+        for (size_t index = 0; index < wave.size(); ++index) {
+            rotated.emplace(wave[index].step, std::move(waveResults[index]));
+        }
+        pending = std::move(deferred);
+    }
+    
+    std::vector<seal::Ciphertext> results;
+    results.reserve(steps.size());
+    for (int const step : steps) {
+        int64_t const normalized = normalize(step);
+        if (normalized == 0) {
+            results.push_back(encrypted);
+        } else if (--uses[normalized] == 0) {
+            results.push_back(std::move(rotated.at(normalized)));
+        } else {
+            results.push_back(rotated.at(normalized));
+        }
+    }
+    return results;
+}
+
+#pragma mark - Slot Reduction Helpers
+
+/// Returns the rotation steps that ASLSumWindowInplace performs for a window of length slots.
+static std::vector<int> ASLSumWindowSteps(uint64_t length) {
+    std::vector<int> steps;
+    uint64_t offset = 0;
+    for (uint64_t width = 1; width <= length; width <<= 1) {
+        if ((length & width) != 0) {
+            if (offset != 0) {
+                steps.push_back(static_cast<int>(offset));
+            }
+            offset += width;
+        }
+        if ((width << 1) <= length) {
+            steps.push_back(static_cast<int>(width));
+        }
+    }
+    std::sort(steps.begin(), steps.end());
+    steps.erase(std::unique(steps.begin(), steps.end()), steps.end());
+    return steps;
+}
+
+/// Replaces every slot i of encrypted with the sum of slots i to i + length - 1, wrapping
+/// around within a row. Uses one rotation per bit of length plus one per additional set bit,
+/// and reuses a single rotation temporary throughout.
+static void ASLSumWindowInplace(seal::Evaluator &evaluator,
+                                seal::Ciphertext &encrypted,
+                                uint64_t length,
+                                bool rotateRows,
+                                seal::GaloisKeys const &galoisKeys,
+                                seal::MemoryPoolHandle const &pool) {
+    seal::Ciphertext rotated(pool);
+    auto rotate = [&](seal::Ciphertext const &source, int steps) {
+        if (rotateRows) {
+            evaluator.rotate_rows(source, steps, galoisKeys, rotated, pool);
+        } else {
+            evaluator.rotate_vector(source, steps, galoisKeys, rotated, pool);
+        }
+    };
+    
+    // encrypted holds windows of the current width; sum accumulates the windows of the set bits of length.
+    seal::Ciphertext sum(pool);
+    bool hasSum = false;
+    uint64_t offset = 0;
+    for (uint64_t width = 1; width <= length; width <<= 1) {
+        bool const isLastBit = (width << 1) > length;
+        if ((length & width) != 0) {
+            if (offset == 0) {
+                if (!isLastBit) {
+                    sum = encrypted;
+                    hasSum = true;
+                }
+            } else {
+                rotate(encrypted, static_cast<int>(offset));
+                evaluator.add_inplace(sum, rotated);
+            }
+            offset += width;
+        }
+        if (!isLastBit) {
+            rotate(encrypted, static_cast<int>(width));
+            evaluator.add_inplace(encrypted, rotated);
+        }
+    }
+    if (hasSum) {
+        encrypted = std::move(sum);
+    }
+}
+
+#pragma mark - Tree Reduction Helpers
+
+/// Reduces encrypteds into destination with combine(a, b, result, pool), which may alias
+/// result with a. Inputs are read by reference: runs of leafWidth consecutive inputs are
+/// folded into one node per leaf, and the nodes are then combined pairwise as a balanced
+/// tree, one level at a time across concurrency workers. Nodes are moved between levels and
+/// the final combination is written straight into destination. When pool is initialized it
+/// is used for every allocation; otherwise each worker allocates from its own pool.
+template <typename Combine>
+static void ASLReduceTree(std::vector<seal::Ciphertext const *> const &encrypteds,
+                          size_t leafWidth,
+                          size_t concurrency,
+                          seal::MemoryPoolHandle const &pool,
+                          seal::Ciphertext &destination,
+                          Combine combine) {
+    if (encrypteds.empty()) {
+        throw std::invalid_argument("encrypteds cannot be empty");
+    }
+    if (std::find(encrypteds.begin(), encrypteds.end(), &destination) != encrypteds.end()) {
+        throw std::invalid_argument("destination cannot be one of encrypteds");
+    }
+    size_t const count = encrypteds.size();
+    seal::MemoryPoolHandle const callerPool = pool ? pool : seal::MemoryManager::GetPool();
+    if (count == 1) {
+        destination = *encrypteds[0];
+        return;
+    }
+    
+    leafWidth = std::max<size_t>(leafWidth, 2);
+    auto foldLeaf = [&](size_t leaf, seal::Ciphertext &node, seal::MemoryPoolHandle const &leafPool) {
+        size_t const begin = leaf * leafWidth;
+        size_t const end = std::min(count, begin + leafWidth);
+        if (end - begin == 1) {
+            node = *encrypteds[begin];
+            return;
+        }
+        combine(*encrypteds[begin], *encrypteds[begin + 1], node, leafPool);
+        for (size_t index = begin + 2; index < end; ++index) {
+            combine(node, *encrypteds[index], node, leafPool);
+        }
+    };
+    
+    size_t const leafCount = (count + leafWidth - 1) / leafWidth;
+    if (leafCount == 1) {
+        foldLeaf(0, destination, callerPool);
+        return;
+    }
+    std::vector<seal::Ciphertext> nodes(leafCount);
+    ASLParallelFor(leafCount, concurrency, [&](size_t leaf, seal::MemoryPoolHandle const &workerPool) {
+        foldLeaf(leaf, nodes[leaf], pool ? pool : workerPool);
+    });
+    while (nodes.size() > 2) {
+        size_t const pairCount = nodes.size() / 2;
+        bool const hasOddNode = (nodes.size() % 2) != 0;
+        ASLParallelFor(pairCount, concurrency, [&](size_t pair, seal::MemoryPoolHandle const &workerPool) {
+            combine(nodes[2 * pair], nodes[2 * pair + 1], nodes[2 * pair], pool ? pool : workerPool);
+        });
+        for (size_t pair = 1; pair < pairCount; ++pair) {
+            nodes[pair] = std::move(nodes[2 * pair]);
+        }
+        if (hasOddNode) {
+            nodes[pairCount] = std::move(nodes[2 * pairCount]);
+        }
+        nodes.resize(pairCount + (hasOddNode ? 1 : 0));
+    }
+    combine(nodes[0], nodes[1], destination, callerPool);
+}
+
+/// Sums encrypteds into destination. Each worker sums one contiguous run of inputs, so only
+/// one intermediate ciphertext is allocated per worker.
+static void ASLAddMany(seal::Evaluator &evaluator,
+                       std::vector<seal::Ciphertext const *> const &encrypteds,
+                       size_t concurrency,
+                       seal::MemoryPoolHandle const &pool,
+                       seal::Ciphertext &destination) {
+    size_t const workerCount = std::max<size_t>(1, concurrency);
+    size_t const leafWidth = (encrypteds.size() + workerCount - 1) / workerCount;
+    ASLReduceTree(encrypteds, leafWidth, concurrency, pool, destination,
+                  [&](seal::Ciphertext const &encrypted1, seal::Ciphertext const &encrypted2, seal::Ciphertext &result, seal::MemoryPoolHandle const &) {
+        evaluator.add(encrypted1, encrypted2, result);
+    });
+}
+
+/// Multiplies encrypteds into destination as a balanced tree. Every product is relinearized
+/// and, for CKKS, rescaled, so the result consumes ceil(log2(count)) levels. Operands at
+/// different levels are switched to the lower level before they are multiplied.
+static void ASLMultiplyMany(seal::Evaluator &evaluator,
+                            std::shared_ptr<seal::SEALContext> const &context,
+                            std::vector<seal::Ciphertext const *> const &encrypteds,
+                            seal::RelinKeys const &relinKeys,
+                            size_t concurrency,
+                            seal::MemoryPoolHandle const &pool,
+                            seal::Ciphertext &destination) {
+    for (seal::Ciphertext const * const encrypted : encrypteds) {
+        if (!seal::is_metadata_valid_for(*encrypted, context)) {
+            throw std::invalid_argument("encrypteds is not valid for encryption parameters");
+        }
+    }
+    bool const rescales = context->key_context_data()->parms().scheme() == seal::scheme_type::CKKS;
+    auto level = [&](seal::Ciphertext const &encrypted) {
+        return context->get_context_data(encrypted.parms_id())->chain_index();
+    };
+    ASLReduceTree(encrypteds, 2, concurrency, pool, destination,
+                  [&](seal::Ciphertext const &encrypted1, seal::Ciphertext const &encrypted2, seal::Ciphertext &result, seal::MemoryPoolHandle const &combinePool) {
+        if (encrypted1.parms_id() == encrypted2.parms_id()) {
+            evaluator.multiply(encrypted1, encrypted2, result, combinePool);
+        } else {
+            bool const firstIsLower = level(encrypted1) < level(encrypted2);
+            seal::Ciphertext aligned(combinePool);
+            evaluator.mod_switch_to(firstIsLower ? encrypted2 : encrypted1,
+                                    firstIsLower ? encrypted1.parms_id() : encrypted2.parms_id(),
+                                    aligned,
+                                    combinePool);
+            evaluator.multiply(firstIsLower ? encrypted1 : encrypted2, aligned, result, combinePool);
+        }
+        evaluator.relinearize_inplace(result, relinKeys, combinePool);
+        if (rescales) {
+            evaluator.rescale_to_next_inplace(result, combinePool);
+        }
+    });
+}
+
+#pragma mark - Polynomial Helpers
+
+/// Evaluates a CKKS polynomial with baby-step giant-step powers. The baby steps x^1 ... x^k
+/// and the giant steps x^(k 2^m) are each computed at minimal depth, and the polynomial is
+/// split recursively as p = q x^(k 2^m) + r until the parts have degree below k. Every part
+/// is evaluated towards a target level and scale chosen so that the parts meet with equal
+/// levels and scales, and the coefficients are encoded at the scale that produces the target
+/// after a single rescale.
+class ASLPolynomialEvaluator {
+public:
+    ASLPolynomialEvaluator(seal::Evaluator &evaluator,
+                           std::shared_ptr<seal::SEALContext> const &context,
+                           seal::CKKSEncoder &encoder,
+                           seal::RelinKeys const &relinKeys,
+                           std::vector<double> const &coefficients,
+                           seal::MemoryPoolHandle const &pool)
+    : _evaluator(evaluator), _context(context), _encoder(encoder), _relinKeys(relinKeys),
+      _coefficients(coefficients), _pool(pool) {
+        for (auto contextData = context->first_context_data(); contextData; contextData = contextData->next_context_data()) {
+            if (_levels.empty()) {
+                _levels.resize(contextData->chain_index() + 1);
+            }
+            _levels[contextData->chain_index()] = contextData;
+        }
+    }
+    
+    seal::Ciphertext evaluate(seal::Ciphertext const &encrypted) {
+        if (!seal::is_metadata_valid_for(encrypted, _context)) {
+            throw std::invalid_argument("encrypted is not valid for encryption parameters");
+        }
+        long const degree = this->degree(0, _coefficients.size());
+        if (degree < 1) {
+            throw std::invalid_argument("polynomial must have degree at least one");
+        }
+        size_t const babyStepCount = size_t(1) << static_cast<size_t>(std::ceil(std::log2(static_cast<double>(degree + 1)) / 2));
+        _babyStepCount = std::max<size_t>(babyStepCount, 2);
+        
+        // _babySteps[i] holds x^i; x^i = x^a x^(i - a) with a the largest power of two below i.
+        _babySteps.assign(std::min<size_t>(_babyStepCount, degree) + 1, seal::Ciphertext(_pool));
+        _babySteps[1] = encrypted;
+        for (size_t i = 2; i < _babySteps.size(); ++i) {
+            size_t a = 1;
+            while ((a << 1) < i) {
+                a <<= 1;
+            }
+            _babySteps[i] = multiply(_babySteps[a], _babySteps[i - a]);
+        }
+        for (size_t power = _babyStepCount; power <= static_cast<size_t>(degree); power <<= 1) {
+            _giantSteps.push_back(_giantSteps.empty() ? _babySteps[_babyStepCount] : multiply(_giantSteps.back(), _giantSteps.back()));
+        }
+        
+        long const targetLevel = feasibleLevel(0, degree);
+        if (targetLevel < 0) {
+            throw std::invalid_argument("polynomial degree exceeds the remaining multiplicative depth");
+        }
+        seal::Ciphertext destination(_pool);
+        evaluate(0, degree, static_cast<size_t>(targetLevel), encrypted.scale(), destination);
+        return destination;
+    }
+    
+private:
+    /// Returns the offset of the highest non-zero coefficient in [begin, begin + count), or -1.
+    long degree(size_t begin, size_t count) const {
+        for (size_t offset = count; offset > 0; --offset) {
+            if (begin + offset - 1 < _coefficients.size() && _coefficients[begin + offset - 1] != 0.0) {
+                return static_cast<long>(offset - 1);
+            }
+        }
+        return -1;
+    }
+    
+    size_t level(seal::Ciphertext const &encrypted) const {
+        return _context->get_context_data(encrypted.parms_id())->chain_index();
+    }
+    
+    /// Returns the index of the largest giant step not exceeding degree.
+    size_t giantStepIndex(long degree) const {
+        size_t index = 0;
+        while ((_babyStepCount << (index + 1)) <= static_cast<size_t>(degree)) {
+            index += 1;
+        }
+        return index;
+    }
+    
+    seal::Ciphertext multiply(seal::Ciphertext const &encrypted1, seal::Ciphertext const &encrypted2) {
+        seal::Ciphertext destination(_pool);
+        if (&encrypted1 == &encrypted2) {
+            _evaluator.square(encrypted1, destination, _pool);
+        } else if (level(encrypted1) == level(encrypted2)) {
+            _evaluator.multiply(encrypted1, encrypted2, destination, _pool);
+        } else {
+            bool const firstIsLower = level(encrypted1) < level(encrypted2);
+            seal::Ciphertext aligned(_pool);
+            _evaluator.mod_switch_to(firstIsLower ? encrypted2 : encrypted1,
+                                     firstIsLower ? encrypted1.parms_id() : encrypted2.parms_id(),
+                                     aligned,
+                                     _pool);
+            _evaluator.multiply(firstIsLower ? encrypted1 : encrypted2, aligned, destination, _pool);
+        }
+        _evaluator.relinearize_inplace(destination, _relinKeys, _pool);
+        _evaluator.rescale_to_next_inplace(destination, _pool);
+        return destination;
+    }
+    
+    /// Returns the highest level at which the polynomial of the given degree starting at begin can be produced.
+    long feasibleLevel(size_t begin, long degree) const {
+        if (static_cast<size_t>(degree) < _babyStepCount) {
+            long result = LONG_MAX;
+            for (long i = 1; i <= degree; ++i) {
+                if (_coefficients[begin + i] != 0.0) {
+                    result = std::min(result, static_cast<long>(level(_babySteps[i])) - 1);
+                }
+            }
+            return result;
+        }
+        size_t const index = giantStepIndex(degree);
+        size_t const power = _babyStepCount << index;
+        long result = static_cast<long>(level(_giantSteps[index])) - 1;
+        long const quotientDegree = degree - static_cast<long>(power);
+        if (quotientDegree >= 1) {
+            result = std::min(result, feasibleLevel(begin + power, quotientDegree) - 1);
+        }
+        long const remainderDegree = this->degree(begin, power);
+        if (remainderDegree >= 1) {
+            result = std::min(result, feasibleLevel(begin, remainderDegree));
+        }
+        return result;
+    }
+    
+    /// Computes the sum of coefficient * power over terms, plus constant, at targetLevel and targetScale.
+    void evaluateLinear(std::vector<std::pair<seal::Ciphertext const *, double>> const &terms,
+                        double constant,
+                        size_t targetLevel,
+                        double targetScale,
+                        seal::Ciphertext &destination) {
+        auto const &contextData = _levels.at(targetLevel + 1);
+        seal::parms_id_type const &parmsId = contextData->parms_id();
+        double const productScale = targetScale * static_cast<double>(contextData->parms().coeff_modulus().back().value());
+        
+        seal::Plaintext plain(_pool);
+        seal::Ciphertext term(_pool);
+        bool hasDestination = false;
+        for (auto const &entry : terms) {
+            if (entry.second == 0.0) {
+                continue;
+            }
+            _evaluator.mod_switch_to(*entry.first, parmsId, term, _pool);
+            _encoder.encode(entry.second, parmsId, productScale / term.scale(), plain, _pool);
+            _evaluator.multiply_plain_inplace(term, plain, _pool);
+            term.scale() = productScale;
+            if (hasDestination) {
+                _evaluator.add_inplace(destination, term);
+            } else {
+                destination = term;
+                hasDestination = true;
+            }
+        }
+        if (constant != 0.0) {
+            _encoder.encode(constant, parmsId, productScale, plain, _pool);
+            _evaluator.add_plain_inplace(destination, plain);
+        }
+        _evaluator.rescale_to_next_inplace(destination, _pool);
+        destination.scale() = targetScale;
+    }
+    
+    void evaluate(size_t begin, long degree, size_t targetLevel, double targetScale, seal::Ciphertext &destination) {
+        if (static_cast<size_t>(degree) < _babyStepCount) {
+            std::vector<std::pair<seal::Ciphertext const *, double>> terms;
+            for (long i = 1; i <= degree; ++i) {
+                terms.emplace_back(&_babySteps[i], _coefficients[begin + i]);
+            }
+            evaluateLinear(terms, _coefficients[begin], targetLevel, targetScale, destination);
+            return;
+        }
+        
+        size_t const index = giantStepIndex(degree);
+        size_t const power = _babyStepCount << index;
+        seal::Ciphertext const &giantStep = _giantSteps[index];
+        long const quotientDegree = degree - static_cast<long>(power);
+        if (quotientDegree == 0) {
+            evaluateLinear({{&giantStep, _coefficients[begin + power]}}, 0.0, targetLevel, targetScale, destination);
+        } else {
+            // The quotient is produced one level up, at the scale that the product rescales to targetScale.
+            auto const &contextData = _levels.at(targetLevel + 1);
+            double const prime = static_cast<double>(contextData->parms().coeff_modulus().back().value());
+            seal::Ciphertext quotient(_pool);
+            evaluate(begin + power, quotientDegree, targetLevel + 1, targetScale * prime / giantStep.scale(), quotient);
+            seal::Ciphertext alignedGiantStep(_pool);
+            _evaluator.mod_switch_to(giantStep, contextData->parms_id(), alignedGiantStep, _pool);
+            _evaluator.multiply(quotient, alignedGiantStep, destination, _pool);
+            _evaluator.relinearize_inplace(destination, _relinKeys, _pool);
+            _evaluator.rescale_to_next_inplace(destination, _pool);
+            destination.scale() = targetScale;
+        }
+        
+        long const remainderDegree = this->degree(begin, power);
+        if (remainderDegree >= 1) {
+            seal::Ciphertext remainder(_pool);
+            evaluate(begin, remainderDegree, targetLevel, targetScale, remainder);
+            _evaluator.add_inplace(destination, remainder);
+        } else if (remainderDegree == 0) {
+            seal::Plaintext plain(_pool);
+            _encoder.encode(_coefficients[begin], destination.parms_id(), targetScale, plain, _pool);
+            _evaluator.add_plain_inplace(destination, plain);
+        }
+    }
+    
+    seal::Evaluator &_evaluator;
+    std::shared_ptr<seal::SEALContext> _context;
+    seal::CKKSEncoder &_encoder;
+    seal::RelinKeys const &_relinKeys;
+    std::vector<double> const &_coefficients;
+    seal::MemoryPoolHandle _pool;
+    std::vector<std::shared_ptr<const seal::SEALContext::ContextData>> _levels;
+    std::vector<seal::Ciphertext> _babySteps;
+    std::vector<seal::Ciphertext> _giantSteps;
+    size_t _babyStepCount = 2;
+};
+
+#pragma mark - Comparison Helpers
+
+/// Evaluates the composite sign approximation on encrypted. The last polynomial is scaled by
+/// factor and shifted by offset, so the result approximates factor * sign(x) + offset at the
+/// scale of encrypted.
+static seal::Ciphertext ASLEvaluateSign(seal::Evaluator &evaluator,
+                                        std::shared_ptr<seal::SEALContext> const &context,
+                                        seal::CKKSEncoder &encoder,
+                                        seal::RelinKeys const &relinKeys,
+                                        seal::Ciphertext const &encrypted,
+                                        std::vector<std::vector<double>> const &polynomials,
+                                        double factor,
+                                        double offset,
+                                        seal::MemoryPoolHandle const &pool) {
+    seal::Ciphertext result = encrypted;
+    for (size_t index = 0; index < polynomials.size(); ++index) {
+        std::vector<double> coefficients = polynomials[index];
+        if (index + 1 == polynomials.size()) {
+            for (double &coefficient : coefficients) {
+                coefficient *= factor;
+            }
+            coefficients[0] += offset;
+        }
+        ASLPolynomialEvaluator polynomialEvaluator(evaluator, context, encoder, relinKeys, coefficients, pool);
+        result = polynomialEvaluator.evaluate(result);
+    }
+    return result;
+}
+
+/// Returns (x + y) / 2 + (x - y) sign(x - y) / 2, the maximum of x and y, or with a negated sign
+/// the minimum. A null encrypted2 stands for zero, which gives relu(x). The half sum is produced
+/// with one plain multiplication that rescales to the level and scale of the product.
+static seal::Ciphertext ASLSelectByComparison(seal::Evaluator &evaluator,
+                                              std::shared_ptr<seal::SEALContext> const &context,
+                                              seal::RelinKeys const &relinKeys,
+                                              seal::Ciphertext const &encrypted1,
+                                              seal::Ciphertext const *encrypted2,
+                                              std::vector<std::vector<double>> const &polynomials,
+                                              bool selectsMaximum,
+                                              seal::MemoryPoolHandle const &pool) {
+    seal::CKKSEncoder encoder(context);
+    seal::Ciphertext difference(pool);
+    seal::Ciphertext sum(pool);
+    if (encrypted2 != nullptr) {
+        evaluator.sub(encrypted1, *encrypted2, difference);
+        evaluator.add(encrypted1, *encrypted2, sum);
+    } else {
+        difference = encrypted1;
+        sum = encrypted1;
+    }
+    
+    seal::Ciphertext const halfSign = ASLEvaluateSign(evaluator, context, encoder, relinKeys, difference, polynomials,
+                                                      selectsMaximum ? 0.5 : -0.5, 0.0, pool);
+    seal::Ciphertext destination(pool);
+    evaluator.mod_switch_to_inplace(difference, halfSign.parms_id(), pool);
+    evaluator.multiply(difference, halfSign, destination, pool);
+    evaluator.relinearize_inplace(destination, relinKeys, pool);
+    evaluator.rescale_to_next_inplace(destination, pool);
+    
+    double const prime = static_cast<double>(context->get_context_data(halfSign.parms_id())->parms().coeff_modulus().back().value());
+    seal::Plaintext half(pool);
+    evaluator.mod_switch_to_inplace(sum, halfSign.parms_id(), pool);
+    encoder.encode(0.5, sum.parms_id(), destination.scale() * prime / sum.scale(), half, pool);
+    evaluator.multiply_plain_inplace(sum, half, pool);
+    evaluator.rescale_to_next_inplace(sum, pool);
+    sum.scale() = destination.scale();
+    evaluator.add_inplace(destination, sum);
+    return destination;
+}
+
+#pragma mark - Exponentiation Helpers
+
+/// Raises encrypted to exponent in place by repeated squaring. The powers selected by the bits
+/// of exponent are multiplied two at a time, always the two shallowest first, which keeps the
+/// depth at ceil(log2(exponent)) with floor(log2(exponent)) squarings and one product per
+/// additional set bit. Every square and product is relinearized before it is used again,
+/// since the relinearization keys only reduce size 3 ciphertexts, so there is one
+/// relinearization per multiplication and callers should exponentiate once rather than once
+/// per operand. encrypted is left unchanged if an exception is thrown.
+static void ASLExponentiateInplace(seal::Evaluator &evaluator,
+                                   std::shared_ptr<seal::SEALContext> const &context,
+                                   seal::Ciphertext &encrypted,
+                                   std::uint64_t exponent,
+                                   seal::RelinKeys const &relinKeys,
+                                   seal::MemoryPoolHandle const &pool) {
+    std::shared_ptr<const seal::SEALContext::ContextData> const contextData = context->get_context_data(encrypted.parms_id());
+    if (!contextData) {
+        throw std::invalid_argument("encrypted is not valid for encryption parameters");
+    }
+    if (contextData->parms().scheme() != seal::scheme_type::BFV) {
+        throw std::logic_error("unsupported scheme");
+    }
+    if (exponent == 0) {
+        throw std::invalid_argument("exponent cannot be 0");
+    }
+    if (exponent == 1) {
+        return;
+    }
+    
+    // Factors keyed by their multiplicative depth, so the front of the map is always the shallowest.
+    std::multimap<int, seal::Ciphertext> factors;
+    seal::Ciphertext power = encrypted;
+    int depth = 0;
+    for (std::uint64_t remaining = exponent; remaining > 1; remaining >>= 1) {
+        if (remaining & 1) {
+            factors.emplace(depth, power);
+        }
+        evaluator.square_inplace(power, pool);
+        evaluator.relinearize_inplace(power, relinKeys, pool);
+        ++depth;
+    }
+    factors.emplace(depth, std::move(power));
+    
+    while (factors.size() > 1) {
+        std::multimap<int, seal::Ciphertext>::iterator first = factors.begin();
+        std::multimap<int, seal::Ciphertext>::iterator second = std::next(first);
+        int const productDepth = std::max(first->first, second->first) + 1;
+        seal::Ciphertext product(pool);
+        evaluator.multiply(first->second, second->second, product, pool);
+        evaluator.relinearize_inplace(product, relinKeys, pool);
+        factors.erase(first, std::next(second));
+        factors.emplace(productDepth, std::move(product));
+    }
+    encrypted = std::move(factors.begin()->second);
+}
+
+/// Returns 1 - (encrypted1 - encrypted2)^(t - 1) for the plain modulus t. By Fermat's little
+/// theorem this is 1 in every slot where the two ciphertexts hold the same value and 0 elsewhere.
+static seal::Ciphertext ASLEqualityIndicator(seal::Evaluator &evaluator,
+                                             std::shared_ptr<seal::SEALContext> const &context,
+                                             seal::Ciphertext const &encrypted1,
+                                             seal::Ciphertext const &encrypted2,
+                                             seal::RelinKeys const &relinKeys,
+                                             seal::MemoryPoolHandle const &pool) {
+    seal::Ciphertext indicator(pool);
+    evaluator.sub(encrypted1, encrypted2, indicator);
+    std::uint64_t const plainModulus = context->first_context_data()->parms().plain_modulus().value();
+    ASLExponentiateInplace(evaluator, context, indicator, plainModulus - 1, relinKeys, pool);
+    evaluator.negate_inplace(indicator);
+    evaluator.add_plain_inplace(indicator, seal::Plaintext("1", pool));
+    return indicator;
+}
+
+#pragma mark - Scalar Helpers
+
+/// Returns the context data of encrypted after checking its metadata and scheme.
+static std::shared_ptr<const seal::SEALContext::ContextData> ASLScalarContextData(std::shared_ptr<seal::SEALContext> const &context,
+                                                                                  seal::Ciphertext const &encrypted,
+                                                                                  seal::scheme_type scheme) {
+    if (!seal::is_metadata_valid_for(encrypted, context)) {
+        throw std::invalid_argument("encrypted is not valid for encryption parameters");
+    }
+    std::shared_ptr<const seal::SEALContext::ContextData> const contextData = context->get_context_data(encrypted.parms_id());
+    if (contextData->parms().scheme() != scheme) {
+        throw std::logic_error("unsupported scheme");
+    }
+    return contextData;
+}
+
+/// Returns value modulo t, then lifted to the primes of coeffModulus the way multiply_plain lifts
+/// plaintext coefficients: residues at or above (t + 1) / 2 stand for negative numbers.
+static std::vector<std::uint64_t> ASLLiftedResidues(std::int64_t value,
+                                                    seal::Modulus const &plainModulus,
+                                                    std::vector<seal::Modulus> const &coeffModulus) {
+    std::uint64_t const t = plainModulus.value();
+    std::uint64_t const magnitude = value < 0 ? static_cast<std::uint64_t>(-(value + 1)) + 1 : static_cast<std::uint64_t>(value);
+    std::uint64_t reduced = magnitude % t;
+    if (value < 0 && reduced != 0) {
+        reduced = t - reduced;
+    }
+    bool const negative = reduced >= (t + 1) / 2;
+    std::uint64_t const lifted = negative ? t - reduced : reduced;
+    
+    std::vector<std::uint64_t> residues;
+    residues.reserve(coeffModulus.size());
+    for (seal::Modulus const &modulus : coeffModulus) {
+        std::uint64_t const residue = lifted % modulus.value();
+        residues.push_back(negative && residue != 0 ? modulus.value() - residue : residue);
+    }
+    return residues;
+}
+
+/// Returns the integer nearest value modulo each prime of coefficient modulus at the level of
+/// contextData. Values beyond 64 bits are reduced from their mantissa and binary exponent, so the
+/// residues are exact at any magnitude the level can hold.
+static std::vector<std::uint64_t> ASLRoundedResidues(double value,
+                                                     seal::SEALContext::ContextData const &contextData) {
+    if (!std::isfinite(value)) {
+        throw std::invalid_argument("value is not finite");
+    }
+    double const rounded = std::round(value);
+    double const magnitude = std::fabs(rounded);
+    if (magnitude != 0 && static_cast<int>(std::log2(magnitude)) + 2 >= contextData.total_coeff_modulus_bit_count()) {
+        throw std::invalid_argument("encoded values are too large");
+    }
+    
+    int exponent = 0;
+    std::uint64_t mantissa = 0;
+    if (magnitude < 0x1p64) {
+        mantissa = static_cast<std::uint64_t>(magnitude);
+    } else {
+        mantissa = static_cast<std::uint64_t>(std::ldexp(std::frexp(magnitude, &exponent), 53));
+        exponent -= 53;
+    }
+    
+    std::vector<std::uint64_t> residues;
+    residues.reserve(contextData.parms().coeff_modulus().size());
+    for (seal::Modulus const &modulus : contextData.parms().coeff_modulus()) {
+        std::uint64_t const q = modulus.value();
+        std::uint64_t residue = mantissa % q;
+        for (int bit = 0; bit < exponent; ++bit) {
+            residue = residue >= q - residue ? residue - (q - residue) : residue + residue;
+        }
+        residues.push_back(rounded < 0 && residue != 0 ? q - residue : residue);
+    }
+    return residues;
+}
+
+/// Multiplies every coefficient of encrypted by residues[i] modulo the i-th prime. A constant is
+/// the same polynomial in coefficient and NTT form, so this matches multiply_plain with a constant
+/// plaintext without encoding or transforming one. Each residue gets a Shoup quotient, which turns
+/// the reduction of every product into a high multiplication and one conditional subtraction.
+static void ASLMultiplyResiduesInplace(seal::Ciphertext &encrypted,
+                                       std::vector<seal::Modulus> const &coeffModulus,
+                                       std::vector<std::uint64_t> const &residues) {
+    size_t const polyModulusDegree = encrypted.poly_modulus_degree();
+    for (size_t limb = 0; limb < coeffModulus.size(); ++limb) {
+        std::uint64_t const q = coeffModulus[limb].value();
+        std::uint64_t const scalar = residues[limb];
+        std::uint64_t const quotient = static_cast<std::uint64_t>((static_cast<unsigned __int128>(scalar) << 64) / q);
+        for (size_t poly = 0; poly < encrypted.size(); ++poly) {
+            std::uint64_t * const coefficients = encrypted.data(poly) + limb * polyModulusDegree;
+            for (size_t index = 0; index < polyModulusDegree; ++index) {
+                std::uint64_t const estimate = static_cast<std::uint64_t>((static_cast<unsigned __int128>(coefficients[index]) * quotient) >> 64);
+                std::uint64_t const product = coefficients[index] * scalar - estimate * q;
+                coefficients[index] = product >= q ? product - q : product;
+            }
+        }
+    }
+}
+
+/// Adds residues[i] modulo the i-th prime to every coefficient of the first polynomial of an
+/// NTT form ciphertext, which adds the constant to every slot.
+static void ASLAddResiduesInplace(seal::Ciphertext &encrypted,
+                                  std::vector<seal::Modulus> const &coeffModulus,
+                                  std::vector<std::uint64_t> const &residues) {
+    size_t const polyModulusDegree = encrypted.poly_modulus_degree();
+    for (size_t limb = 0; limb < coeffModulus.size(); ++limb) {
+        std::uint64_t const q = coeffModulus[limb].value();
+        std::uint64_t const residue = residues[limb];
+        std::uint64_t * const coefficients = encrypted.data(0) + limb * polyModulusDegree;
+        for (size_t index = 0; index < polyModulusDegree; ++index) {
+            std::uint64_t const sum = coefficients[index] + residue;
+            coefficients[index] = sum >= q ? sum - q : sum;
+        }
+    }
+}
+
+/// Multiplies a BFV ciphertext in place by an integer constant modulo the plain modulus.
+static void ASLMultiplyIntegerInplace(std::shared_ptr<seal::SEALContext> const &context,
+                                      seal::Ciphertext &encrypted,
+                                      std::int64_t value) {
+    std::shared_ptr<const seal::SEALContext::ContextData> const contextData = ASLScalarContextData(context, encrypted, seal::scheme_type::BFV);
+    seal::EncryptionParameters const &parms = contextData->parms();
+    if (value % static_cast<std::int64_t>(parms.plain_modulus().value()) == 0) {
+        throw std::logic_error("result ciphertext is transparent");
+    }
+    ASLMultiplyResiduesInplace(encrypted, parms.coeff_modulus(), ASLLiftedResidues(value, parms.plain_modulus(), parms.coeff_modulus()));
+}
+
+/// Adds an integer constant to every slot of a BFV ciphertext in place. The constant is a
+/// plaintext with a single coefficient, so adding it involves no encoding.
+static void ASLAddIntegerInplace(seal::Evaluator &evaluator,
+                                 std::shared_ptr<seal::SEALContext> const &context,
+                                 seal::Ciphertext &encrypted,
+                                 std::int64_t value,
+                                 seal::MemoryPoolHandle const &pool) {
+    std::shared_ptr<const seal::SEALContext::ContextData> const contextData = ASLScalarContextData(context, encrypted, seal::scheme_type::BFV);
+    std::int64_t const t = static_cast<std::int64_t>(contextData->parms().plain_modulus().value());
+    std::int64_t const reduced = ((value % t) + t) % t;
+    if (reduced == 0) {
+        return;
+    }
+    seal::Plaintext constant(1, pool);
+    constant[0] = static_cast<std::uint64_t>(reduced);
+    evaluator.add_plain_inplace(encrypted, constant);
+}
+
+/// Multiplies a CKKS ciphertext in place by value encoded at scale, the constant polynomial
+/// round(value * scale). The scale of the result is the product of the scales.
+static void ASLMultiplyRealInplace(std::shared_ptr<seal::SEALContext> const &context,
+                                   seal::Ciphertext &encrypted,
+                                   double value,
+                                   double scale) {
+    std::shared_ptr<const seal::SEALContext::ContextData> const contextData = ASLScalarContextData(context, encrypted, seal::scheme_type::CKKS);
+    if (!encrypted.is_ntt_form()) {
+        throw std::invalid_argument("CKKS encrypted must be in NTT form");
+    }
+    if (!(scale > 0) || !std::isfinite(scale)) {
+        throw std::invalid_argument("scale must be positive");
+    }
+    double const newScale = encrypted.scale() * scale;
+    if (!std::isfinite(newScale) || static_cast<int>(std::log2(newScale)) >= contextData->total_coeff_modulus_bit_count()) {
+        throw std::invalid_argument("scale out of bounds");
+    }
+    std::vector<std::uint64_t> const residues = ASLRoundedResidues(value * scale, *contextData);
+    if (std::all_of(residues.begin(), residues.end(), [](std::uint64_t residue) { return residue == 0; })) {
+        throw std::logic_error("result ciphertext is transparent");
+    }
+    ASLMultiplyResiduesInplace(encrypted, contextData->parms().coeff_modulus(), residues);
+    encrypted.scale() = newScale;
+}
+
+/// Adds value to every slot of a CKKS ciphertext in place, encoded at the scale of encrypted.
+static void ASLAddRealInplace(std::shared_ptr<seal::SEALContext> const &context,
+                              seal::Ciphertext &encrypted,
+                              double value) {
+    std::shared_ptr<const seal::SEALContext::ContextData> const contextData = ASLScalarContextData(context, encrypted, seal::scheme_type::CKKS);
+    if (!encrypted.is_ntt_form()) {
+        throw std::invalid_argument("CKKS encrypted must be in NTT form");
+    }
+    ASLAddResiduesInplace(encrypted, contextData->parms().coeff_modulus(), ASLRoundedResidues(value * encrypted.scale(), *contextData));
+}
+
+#pragma mark - Prepared Plaintext Helpers
+
+/// Multiplies encrypted in place with the NTT form of plain at its level. A ciphertext that
+/// is not in NTT form (BFV) is transformed around the multiplication and restored on failure.
+static void ASLMultiplyPreparedInplace(seal::Evaluator &evaluator,
+                                       seal::Ciphertext &encrypted,
+                                       ASLPreparedPlainText *plain) {
+    std::shared_ptr<seal::Plaintext const> const nttPlain = [plain nttPlainTextForParametersId:encrypted.parms_id()];
+    if (encrypted.is_ntt_form()) {
+        evaluator.multiply_plain_inplace(encrypted, *nttPlain);
+        return;
+    }
+    evaluator.transform_to_ntt_inplace(encrypted);
+    try {
+        evaluator.multiply_plain_inplace(encrypted, *nttPlain);
+    } catch (...) {
+        evaluator.transform_from_ntt_inplace(encrypted);
+        throw;
+    }
+    evaluator.transform_from_ntt_inplace(encrypted);
+}
+
+/// Adds plain to encrypted in place, using the cached NTT form when encrypted is in NTT form.
+static void ASLAddPreparedInplace(seal::Evaluator &evaluator,
+                                  seal::Ciphertext &encrypted,
+                                  ASLPreparedPlainText *plain) {
+    if (encrypted.is_ntt_form()) {
+        evaluator.add_plain_inplace(encrypted, *[plain nttPlainTextForParametersId:encrypted.parms_id()]);
+    } else {
+        evaluator.add_plain_inplace(encrypted, [plain sealPlainTextReference]);
+    }
+}
+
+#pragma mark - Alignment Helpers
+
+/// The relative difference below which two CKKS scales are treated as equal. Rescaling by a
+/// prime close to the scale leaves differences well below this, which SEAL only accepts once
+/// the scales are made identical.
+static double const ASLScaleTolerance = 1e-6;
+
+static bool ASLScalesAreClose(double scale1, double scale2) {
+    return std::abs(scale1 - scale2) <= ASLScaleTolerance * std::max(scale1, scale2);
+}
+
+typedef NS_ENUM(uint8_t, ASLAlignment) {
+    ASLAlignmentModSwitch,
+    ASLAlignmentRescale,
+    ASLAlignmentMultiplyByOne,
+    ASLAlignmentSetScale,
+};
+
+/// Identifies how an operand is aligned: the transformation and the parms_id and scale it
+/// targets. The operand itself is added by alignedOperandOf:.
+struct ASLAlignmentKey {
+    std::uintptr_t operand;
+    ASLAlignment alignment;
+    seal::parms_id_type parmsId;
+    double scale;
+    
+    ASLAlignmentKey(ASLAlignment alignment, seal::parms_id_type const &parmsId, double scale)
+        : operand(0), alignment(alignment), parmsId(parmsId), scale(scale) {}
+    
+    bool operator==(ASLAlignmentKey const &other) const {
+        return operand == other.operand
+            && alignment == other.alignment
+            && parmsId == other.parmsId
+            && scale == other.scale;
+    }
+};
+
+struct ASLAlignmentKeyHash {
+    size_t operator()(ASLAlignmentKey const &key) const {
+        std::uint64_t hash = 0xcbf29ce484222325ULL;
+        auto fold = [&hash](std::uint64_t word) {
+            hash = (hash ^ word) * 0x100000001b3ULL;
+        };
+        fold(key.operand);
+        fold(key.alignment);
+        for (std::uint64_t const word : key.parmsId) {
+            fold(word);
+        }
+        std::uint64_t scaleBits;
+        std::memcpy(&scaleBits, &key.scale, sizeof(scaleBits));
+        fold(scaleBits);
+        return static_cast<size_t>(hash);
+    }
+};
+
+/// An aligned copy with a weak reference to its operand and the operand's mutation count at
+/// the time. The operand's address is only part of the key, so an entry whose operand has been
+/// deallocated, and whose address may since have been reused, is recognised and never returned.
+struct ASLAlignedOperandEntry {
+    ASLAlignmentKey key;
+    __weak id operand;
+    NSUInteger mutationCount;
+    id aligned;
+};
+
+typedef std::list<ASLAlignedOperandEntry> ASLAlignedOperandList;
+
+static NSUInteger const ASLDefaultAlignedOperandCacheCapacity = 16;
+
 @implementation ASLEvaluator {
     seal::Evaluator* _evaluator;
+    std::shared_ptr<seal::SEALContext> _context;
+    std::mutex _alignedOperandMutex;
+    /// Most recently used first
+    ASLAlignedOperandList _alignedOperands;
+    std::unordered_map<ASLAlignmentKey, ASLAlignedOperandList::iterator, ASLAlignmentKeyHash> _alignedOperandIndex;
+    NSUInteger _alignedOperandCacheCapacity;
 }
 
 #pragma mark - Initialization
@@ -33,7 +1059,8 @@
     
     try {
         seal::Evaluator* encryptor = new seal::Evaluator(context.sealContext);
-        return [[ASLEvaluator alloc] initWithEvaluator:encryptor];
+        return [[ASLEvaluator alloc] initWithEvaluator:encryptor
+                                               context:context.sealContext];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -43,16 +1070,28 @@
     return nil;
 }
 
-- (instancetype)initWithEvaluator:(seal::Evaluator *)evaluator {
+- (instancetype)initWithEvaluator:(seal::Evaluator *)evaluator
+                          context:(std::shared_ptr<seal::SEALContext>)context {
     self = [super init];
     if (self == nil) {
         return nil;
     }
     _evaluator = evaluator;
+    _context = context;
+    _batchConcurrency = NSProcessInfo.processInfo.activeProcessorCount;
+    _alignedOperandCacheCapacity = ASLDefaultAlignedOperandCacheCapacity;
     
     return self;
 }
 
+- (seal::Evaluator &)sealEvaluatorReference {
+    return *_evaluator;
+}
+
+- (std::shared_ptr<seal::SEALContext>)sealContext {
+    return _context;
+}
+
 - (void)dealloc {
     delete _evaluator;
     _evaluator = nullptr;
@@ -64,10 +1103,11 @@
                     error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     try {
         seal::Ciphertext destinationCipherText = seal::Ciphertext();
-        _evaluator->negate(encrypted.sealCipherText, destinationCipherText);
-        return [[ASLCipherText alloc] initWithCipherText:destinationCipherText];
+        _evaluator->negate([encrypted sealCipherTextReference], destinationCipherText);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destinationCipherText)]);
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
@@ -77,15 +1117,40 @@
     return nil;
 }
 
+-(BOOL)negate:(ASLCipherText *)encrypted
+         into:(ASLCipherText *)destination
+        error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->negate([encrypted sealCipherTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText *)negateInplace:(ASLCipherText *)encrypted
                           error:(NSError **)error {
     
     NSParameterAssert(encrypted != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     try {
-        seal::Ciphertext encryptedCipherText = encrypted.sealCipherText;
+        seal::Ciphertext &encryptedCipherText = [encrypted mutableSealCipherText];
         _evaluator->negate_inplace(encryptedCipherText);
-        return [[ASLCipherText alloc] initWithCipherText:encryptedCipherText];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -102,10 +1167,14 @@
     NSParameterAssert(encrypted1 != nil);
     NSParameterAssert(encrypted2 != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
     try {
-        seal::Ciphertext sealEncrypted1 = encrypted1.sealCipherText;
-        _evaluator->add_inplace(sealEncrypted1, encrypted2.sealCipherText);
-        return [[ASLCipherText alloc]initWithCipherText:sealEncrypted1];
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:YES matchScales:YES];
+        }
+        seal::Ciphertext &sealEncrypted1 = [encrypted1 mutableSealCipherText];
+        _evaluator->add_inplace(sealEncrypted1, [encrypted2 sealCipherTextReference]);
+        return scope.complete(encrypted1);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -126,10 +1195,14 @@
     NSParameterAssert(encrypted1 != nil);
     NSParameterAssert(encrypted2 != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
     try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:NO matchScales:YES];
+        }
         seal::Ciphertext destination = seal::Ciphertext();
         _evaluator->add(encrypted1.sealCipherText, encrypted2.sealCipherText, destination);
-        return [[ASLCipherText alloc]initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc]initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -144,20 +1217,47 @@
     return nil;
 }
 
+-(BOOL)add:(ASLCipherText *)encrypted1
+encrypted2:(ASLCipherText *)encrypted2
+      into:(ASLCipherText *)destination
+     error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:NO matchScales:YES];
+        }
+        _evaluator->add([encrypted1 sealCipherTextReference], [encrypted2 sealCipherTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText * _Nullable)addMany:(NSArray<ASLCipherText *> *)encrypteds
                               error:(NSError **)error {
     
     NSParameterAssert(encrypteds != nil);
     
-    std::vector<seal::Ciphertext> vectorEncrypteds;
-    for (ASLCipherText * const value in encrypteds) {
-        vectorEncrypteds.push_back(value.sealCipherText);
-    }
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds);
+    std::vector<seal::Ciphertext const *> const references = ASLCipherTextReferences(encrypteds);
     
     seal::Ciphertext destination = seal::Ciphertext();
     try {
-        _evaluator->add_many(vectorEncrypteds, destination);
-        return [[ASLCipherText alloc]initWithCipherText:destination];
+        ASLAddMany(*_evaluator, references, self.batchConcurrency, seal::MemoryPoolHandle(), destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -172,16 +1272,46 @@
     return nil;
 }
 
+-(BOOL)addMany:(NSArray<ASLCipherText *> *)encrypteds
+          into:(ASLCipherText *)destination
+         error:(NSError **)error {
+    NSParameterAssert(encrypteds != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds);
+    std::vector<seal::Ciphertext const *> const references = ASLCipherTextReferences(encrypteds);
+    
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        ASLAddMany(*_evaluator, references, self.batchConcurrency, seal::MemoryPoolHandle(), sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText *)subInplace:(ASLCipherText *)encrypted1
                   encrypted2:(ASLCipherText *)encrypted2
                        error:(NSError **)error {
     NSParameterAssert(encrypted1 != nil);
     NSParameterAssert(encrypted2 != nil);
     
-    seal::Ciphertext sealEncrypted1 = encrypted1.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
     try {
-        _evaluator->sub_inplace(sealEncrypted1, encrypted2.sealCipherText);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted1];
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:YES matchScales:YES];
+        }
+        seal::Ciphertext &sealEncrypted1 = [encrypted1 mutableSealCipherText];
+        _evaluator->sub_inplace(sealEncrypted1, [encrypted2 sealCipherTextReference]);
+        return scope.complete(encrypted1);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -201,10 +1331,14 @@
     NSParameterAssert(encrypted1 != nil);
     NSParameterAssert(encrypted2 != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
     seal::Ciphertext destination = seal::Ciphertext();
     try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:NO matchScales:YES];
+        }
         _evaluator->sub(encrypted1.sealCipherText, encrypted2.sealCipherText, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -218,16 +1352,49 @@
     }
 }
 
+-(BOOL)sub:(ASLCipherText *)encrypted1
+encrypted2:(ASLCipherText *)encrypted2
+      into:(ASLCipherText *)destination
+     error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:NO matchScales:YES];
+        }
+        _evaluator->sub([encrypted1 sealCipherTextReference], [encrypted2 sealCipherTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText *)multiplyInplace:(ASLCipherText *)encrypted1
                        encrypted2:(ASLCipherText *)encrypted2
                             error:(NSError **)error {
     NSParameterAssert(encrypted1 != nil);
     NSParameterAssert(encrypted2 != nil);
     
-    seal::Ciphertext sealEncrypted1 = encrypted1.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
     try {
-        _evaluator->multiply_inplace(sealEncrypted1, encrypted2.sealCipherText);
-        return [[ASLCipherText alloc]initWithCipherText:sealEncrypted1];
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:YES matchScales:NO];
+        }
+        seal::Ciphertext &sealEncrypted1 = [encrypted1 mutableSealCipherText];
+        _evaluator->multiply_inplace(sealEncrypted1, [encrypted2 sealCipherTextReference]);
+        return scope.complete(encrypted1);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -249,10 +1416,14 @@
     NSParameterAssert(encrypted2 != nil);
     NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted1 = encrypted1.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
     try {
-        _evaluator->multiply_inplace(sealEncrypted1, encrypted2.sealCipherText, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc]initWithCipherText:sealEncrypted1];;
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:YES matchScales:NO];
+        }
+        seal::Ciphertext &sealEncrypted1 = [encrypted1 mutableSealCipherText];
+        _evaluator->multiply_inplace(sealEncrypted1, [encrypted2 sealCipherTextReference], pool.memoryPoolHandle);
+        return scope.complete(encrypted1);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -275,11 +1446,15 @@
     NSParameterAssert(encrypted2 != nil);
     NSParameterAssert(pool != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
     seal::Ciphertext destination = seal::Ciphertext();
     
     try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:NO matchScales:NO];
+        }
         _evaluator->multiply(encrypted1.sealCipherText, encrypted2.sealCipherText, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];;
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -293,6 +1468,37 @@
     }
 }
 
+-(BOOL)multiply:(ASLCipherText *)encrypted1
+     encrypted2:(ASLCipherText *)encrypted2
+           into:(ASLCipherText *)destination
+           pool:(ASLMemoryPoolHandle *)pool
+          error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:NO matchScales:NO];
+        }
+        _evaluator->multiply([encrypted1 sealCipherTextReference], [encrypted2 sealCipherTextReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText * _Nullable)multiply:(ASLCipherText *)encrypted1
                           encrypted2:(ASLCipherText *)encrypted2
 
@@ -300,10 +1506,14 @@
     NSParameterAssert(encrypted1 != nil);
     NSParameterAssert(encrypted2 != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
     seal::Ciphertext destination = seal::Ciphertext();
     try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:NO matchScales:NO];
+        }
         _evaluator->multiply(encrypted1.sealCipherText, encrypted2.sealCipherText, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];;
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -317,14 +1527,44 @@
     }
 }
 
--(ASLCipherText *)squareInplace:(ASLCipherText *)encrypted
-                          error:(NSError **)error {
+-(BOOL)multiply:(ASLCipherText *)encrypted1
+     encrypted2:(ASLCipherText *)encrypted2
+           into:(ASLCipherText *)destination
+          error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted1 cipherText:&encrypted2 inplace:NO matchScales:NO];
+        }
+        _evaluator->multiply([encrypted1 sealCipherTextReference], [encrypted2 sealCipherTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText *)squareInplace:(ASLCipherText *)encrypted
+                          error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
         _evaluator->square_inplace(sealEncrypted);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -344,10 +1584,11 @@
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
         _evaluator->square_inplace(sealEncrypted, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -368,10 +1609,11 @@
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(pool != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->square(encrypted.sealCipherText, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -385,15 +1627,42 @@
     }
 }
 
+-(BOOL)square:(ASLCipherText *)encrypted
+         into:(ASLCipherText *)destination
+         pool:(ASLMemoryPoolHandle *)pool
+        error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->square([encrypted sealCipherTextReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText * _Nullable)square:(ASLCipherText *)encrypted
                              error:(NSError **)error {
     
     NSParameterAssert(encrypted != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->square(encrypted.sealCipherText, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -407,6 +1676,30 @@
     }
 }
 
+-(BOOL)square:(ASLCipherText *)encrypted
+         into:(ASLCipherText *)destination
+        error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->square([encrypted sealCipherTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText *)relinearizeInplace:(ASLCipherText *)encrypted
                  relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
                                error:(NSError **)error {
@@ -414,10 +1707,11 @@
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(relinearizationKeys != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
-        _evaluator->relinearize_inplace(sealEncrypted, relinearizationKeys.sealRelinKeys);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        _evaluator->relinearize_inplace(sealEncrypted, [relinearizationKeys sealRelinKeysReference]);
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -440,11 +1734,12 @@
     NSParameterAssert(relinearizationKeys != nil);
     NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::RelinKeys sealRelinKey = relinearizationKeys.sealRelinKeys;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    seal::RelinKeys const &sealRelinKey = [relinearizationKeys sealRelinKeysReference];
     try {
         _evaluator->relinearize_inplace(sealEncrypted, sealRelinKey, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -465,11 +1760,12 @@
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(relinearizationKeys != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::Ciphertext destination = encrypted.sealCipherText;
     
     try {
-        _evaluator->relinearize(encrypted.sealCipherText, relinearizationKeys.sealRelinKeys, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        _evaluator->relinearize(encrypted.sealCipherText, [relinearizationKeys sealRelinKeysReference], destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -483,6 +1779,32 @@
     }
 }
 
+-(BOOL)relinearize:(ASLCipherText *)encrypted
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+              into:(ASLCipherText *)destination
+             error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->relinearize([encrypted sealCipherTextReference], [relinearizationKeys sealRelinKeysReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText * _Nullable)relinearize:(ASLCipherText *)encrypted
                     relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
 
@@ -492,10 +1814,11 @@
     NSParameterAssert(relinearizationKeys != nil);
     NSParameterAssert(pool != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::Ciphertext destination = seal::Ciphertext();
     try {
-        _evaluator->relinearize(encrypted.sealCipherText, relinearizationKeys.sealRelinKeys, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        _evaluator->relinearize(encrypted.sealCipherText, [relinearizationKeys sealRelinKeysReference], destination, pool.memoryPoolHandle);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -509,16 +1832,45 @@
     }
 }
 
+-(BOOL)relinearize:(ASLCipherText *)encrypted
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+              into:(ASLCipherText *)destination
+              pool:(ASLMemoryPoolHandle *)pool
+             error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->relinearize([encrypted sealCipherTextReference], [relinearizationKeys sealRelinKeysReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText * _Nullable)modSwitchToNext:(ASLCipherText *)encrypted
 
                                       error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->mod_switch_to_next(sealEncrypted, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -532,6 +1884,30 @@
     }
 }
 
+-(BOOL)modSwitchToNext:(ASLCipherText *)encrypted
+                  into:(ASLCipherText *)destination
+                 error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->mod_switch_to_next([encrypted sealCipherTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText * _Nullable)modSwitchToNext:(ASLCipherText *)encrypted
 
                                        pool:(ASLMemoryPoolHandle *)pool
@@ -539,11 +1915,12 @@
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(pool != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->mod_switch_to_next(sealEncrypted, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -557,16 +1934,43 @@
     }
 }
 
+-(BOOL)modSwitchToNext:(ASLCipherText *)encrypted
+                  into:(ASLCipherText *)destination
+                  pool:(ASLMemoryPoolHandle *)pool
+                 error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->mod_switch_to_next([encrypted sealCipherTextReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText *)modSwitchToNextInplace:(ASLCipherText *)encrypted
                                     pool:(ASLMemoryPoolHandle *)pool
                                    error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
         _evaluator->mod_switch_to_next_inplace(sealEncrypted, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -584,10 +1988,11 @@
                                              error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
         _evaluator->mod_switch_to_next_inplace(sealEncrypted);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -605,10 +2010,11 @@
                                               error:(NSError **)error {
     NSParameterAssert(plain != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
     seal::Plaintext sealPlainText = plain.sealPlainText;
     try {
         _evaluator->mod_switch_to_next_inplace(sealPlainText);
-        return [[ASLPlainText alloc] initWithPlainText:sealPlainText];
+        return scope.complete([[ASLPlainText alloc] initWithPlainText:sealPlainText]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -629,15 +2035,16 @@
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(pool != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
               std::end(parametersId.block),
               sealParametersId.begin());
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
         _evaluator->mod_switch_to_inplace(sealEncrypted, sealParametersId, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -656,16 +2063,17 @@
                                error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     
     
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
               std::end(parametersId.block),
               sealParametersId.begin());
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
         _evaluator->mod_switch_to_inplace(sealEncrypted, sealParametersId);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -686,6 +2094,7 @@
                                   error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     NSParameterAssert(pool != nil);
     
     seal::parms_id_type sealParametersId = {};
@@ -696,7 +2105,7 @@
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->mod_switch_to(sealEncrypted, sealParametersId, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -710,6 +2119,38 @@
     }
 }
 
+-(BOOL)modSwitchTo:(ASLCipherText *)encrypted
+      parametersId:(ASLParametersIdType)parametersId
+              into:(ASLCipherText *)destination
+              pool:(ASLMemoryPoolHandle *)pool
+             error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->mod_switch_to([encrypted sealCipherTextReference], sealParametersId, sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText * _Nullable)modSwitchTo:(ASLCipherText *)encrypted
                            parametersId:(ASLParametersIdType)parametersId
 
@@ -717,6 +2158,7 @@
     
     NSParameterAssert(encrypted != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
@@ -726,7 +2168,7 @@
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->mod_switch_to(sealEncrypted, sealParametersId, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -740,21 +2182,52 @@
     }
 }
 
+-(BOOL)modSwitchTo:(ASLCipherText *)encrypted
+      parametersId:(ASLParametersIdType)parametersId
+              into:(ASLCipherText *)destination
+             error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->mod_switch_to([encrypted sealCipherTextReference], sealParametersId, sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLPlainText *)modSwitchToInplaceWithPlain:(ASLPlainText *)plain
                                 parametersId:(ASLParametersIdType)parametersId
                                        error:(NSError **)error {
     NSParameterAssert(plain != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
     
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
               std::end(parametersId.block),
               sealParametersId.begin());
     
-    seal::Plaintext sealPlainText = plain.sealPlainText;
+    seal::Plaintext &sealPlainText = [plain mutableSealPlainText];
     try {
         _evaluator->mod_switch_to_inplace(sealPlainText, sealParametersId);
-        return [[ASLPlainText alloc] initWithPlainText:sealPlainText];
+        return scope.complete(plain);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -773,6 +2246,7 @@
                                           error:(NSError **)error {
     NSParameterAssert(plain != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
               std::end(parametersId.block),
@@ -783,7 +2257,7 @@
     
     try {
         _evaluator->mod_switch_to(sealPlain, sealParametersId, destination);
-        return [[ASLPlainText alloc] initWithPlainText:destination];
+        return scope.complete([[ASLPlainText alloc] initWithPlainText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -797,6 +2271,36 @@
     }
 }
 
+-(BOOL)modSwitchToWithPlain:(ASLPlainText *)plain
+               parametersId:(ASLParametersIdType)parametersId
+                       into:(ASLPlainText *)destination
+                      error:(NSError **)error {
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Plaintext &sealDestination = [destination mutableSealPlainText];
+    try {
+        _evaluator->mod_switch_to([plain sealPlainTextReference], sealParametersId, sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText * _Nullable)rescaleToNext:(ASLCipherText *)encrypted
                                      pool:(ASLMemoryPoolHandle *)pool
                                     error:(NSError **)error {
@@ -804,11 +2308,12 @@
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(pool != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->rescale_to_next(sealEncrypted, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -822,16 +2327,43 @@
     }
 }
 
+-(BOOL)rescaleToNext:(ASLCipherText *)encrypted
+                into:(ASLCipherText *)destination
+                pool:(ASLMemoryPoolHandle *)pool
+               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->rescale_to_next([encrypted sealCipherTextReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText * _Nullable)rescaleToNext:(ASLCipherText *)encrypted
 
                                     error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->rescale_to_next(sealEncrypted, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -845,16 +2377,41 @@
     }
 }
 
+-(BOOL)rescaleToNext:(ASLCipherText *)encrypted
+                into:(ASLCipherText *)destination
+               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->rescale_to_next([encrypted sealCipherTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText *)rescaleToNextInplace:(ASLCipherText *)encrypted
                                   pool:(ASLMemoryPoolHandle *)pool
                                  error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
         _evaluator->rescale_to_next_inplace(sealEncrypted, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -872,10 +2429,11 @@
                                  error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
         _evaluator->rescale_to_next_inplace(sealEncrypted);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -896,15 +2454,16 @@
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(pool != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
               std::end(parametersId.block),
               sealParametersId.begin());
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
         _evaluator->rescale_to_inplace(sealEncrypted, sealParametersId, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -923,15 +2482,16 @@
                              error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
               std::end(parametersId.block),
               sealParametersId.begin());
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
         _evaluator->rescale_to_inplace(sealEncrypted, sealParametersId);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -953,6 +2513,7 @@
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(pool != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
               std::end(parametersId.block),
@@ -962,7 +2523,7 @@
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->rescale_to(sealEncrypted, sealParametersId, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -976,12 +2537,45 @@
     }
 }
 
+-(BOOL)rescaleTo:(ASLCipherText *)encrypted
+    parametersId:(ASLParametersIdType)parametersId
+            into:(ASLCipherText *)destination
+            pool:(ASLMemoryPoolHandle *)pool
+           error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->rescale_to([encrypted sealCipherTextReference], sealParametersId, sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
 -(ASLCipherText * _Nullable)rescaleTo:(ASLCipherText *)encrypted
                          parametersId:(ASLParametersIdType)parametersId
 
                                 error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::parms_id_type sealParametersId = {};
     std::copy(std::begin(parametersId.block),
               std::end(parametersId.block),
@@ -991,7 +2585,7 @@
     seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->rescale_to(sealEncrypted, sealParametersId, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1005,53 +2599,53 @@
     }
 }
 
--(ASLCipherText * _Nullable)multiplyMany:(NSArray<ASLCipherText*>*)encrypteds
-                     relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
-
-                                    pool:(ASLMemoryPoolHandle *)pool
-                                   error:(NSError **)error {
-    NSParameterAssert(encrypteds != nil);
-    NSParameterAssert(relinearizationKeys != nil);
-    NSParameterAssert(pool != nil);
+-(BOOL)rescaleTo:(ASLCipherText *)encrypted
+    parametersId:(ASLParametersIdType)parametersId
+            into:(ASLCipherText *)destination
+           error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
     
-    std::vector<seal::Ciphertext> vectorEncrypteds;
-    for (ASLCipherText * const value in encrypteds) {
-        vectorEncrypteds.push_back(value.sealCipherText);
-    }
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
     
-    seal::Ciphertext destination = seal::Ciphertext();
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
     try {
-        _evaluator->multiply_many(vectorEncrypteds, relinearizationKeys.sealRelinKeys, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        _evaluator->rescale_to([encrypted sealCipherTextReference], sealParametersId, sealDestination);
+        return scope.complete(destination) != nil;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
         }
-        return nil;
+        return NO;
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
         }
-        return nil;
+        return NO;
     }
 }
 
--(ASLCipherText * _Nullable)multiplyMany:(NSArray<ASLCipherText*>*)encrypteds
-                     relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
-
-                                   error:(NSError **)error {
-    NSParameterAssert(encrypteds != nil);
+-(ASLCipherText * _Nullable)multiplyRelinearizeRescale:(ASLCipherText *)encrypted1
+                                            encrypted2:(ASLCipherText *)encrypted2
+                                   relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                                  pool:(ASLMemoryPoolHandle *)pool
+                                                 error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
     NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(pool != nil);
     
-    std::vector<seal::Ciphertext> vectorEncrypteds;
-    for (ASLCipherText * const value in encrypteds) {
-        vectorEncrypteds.push_back(value.sealCipherText);
-    }
-    
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    seal::Ciphertext destination = seal::Ciphertext(pool.memoryPoolHandle);
     try {
-        _evaluator->multiply_many(vectorEncrypteds, relinearizationKeys.sealRelinKeys, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        _evaluator->multiply([encrypted1 sealCipherTextReference], [encrypted2 sealCipherTextReference], destination, pool.memoryPoolHandle);
+        _evaluator->relinearize_inplace(destination, [relinearizationKeys sealRelinKeysReference], pool.memoryPoolHandle);
+        _evaluator->rescale_to_next_inplace(destination, pool.memoryPoolHandle);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1065,43 +2659,53 @@
     }
 }
 
--(ASLCipherText *)exponentiateInplace:(ASLCipherText *)encrypted
-                             exponent:(uint64_t)exponent
-                  relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
-                                 pool:(ASLMemoryPoolHandle *)pool
-                                error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
+-(BOOL)multiplyRelinearizeRescale:(ASLCipherText *)encrypted1
+                       encrypted2:(ASLCipherText *)encrypted2
+              relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                             into:(ASLCipherText *)destination
+                             pool:(ASLMemoryPoolHandle *)pool
+                            error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
     NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(destination != nil);
     NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
     try {
-        _evaluator->exponentiate_inplace(sealEncrypted, exponent, relinearizationKeys.sealRelinKeys, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        _evaluator->multiply([encrypted1 sealCipherTextReference], [encrypted2 sealCipherTextReference], sealDestination, pool.memoryPoolHandle);
+        _evaluator->relinearize_inplace(sealDestination, [relinearizationKeys sealRelinKeysReference], pool.memoryPoolHandle);
+        _evaluator->rescale_to_next_inplace(sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
         }
-        return nil;
+        return NO;
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
         }
-        return nil;
+        return NO;
     }
 }
 
--(ASLCipherText *)exponentiateInplace:(ASLCipherText *)encrypted
-                             exponent:(uint64_t)exponent
-                  relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
-                                error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
+-(ASLCipherText * _Nullable)multiplyRelinearizeRescale:(ASLCipherText *)encrypted1
+                                            encrypted2:(ASLCipherText *)encrypted2
+                                   relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                                 error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
     NSParameterAssert(relinearizationKeys != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    seal::Ciphertext destination = seal::Ciphertext();
     try {
-        _evaluator->exponentiate_inplace(sealEncrypted, exponent, relinearizationKeys.sealRelinKeys);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        _evaluator->multiply([encrypted1 sealCipherTextReference], [encrypted2 sealCipherTextReference], destination);
+        _evaluator->relinearize_inplace(destination, [relinearizationKeys sealRelinKeysReference]);
+        _evaluator->rescale_to_next_inplace(destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1115,47 +2719,50 @@
     }
 }
 
--(ASLCipherText * _Nullable)exponentiate:(ASLCipherText *)encrypted
-                                exponent:(uint64_t)exponent
-                     relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
-
-                                    pool:(ASLMemoryPoolHandle *)pool
-                                   error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
+-(BOOL)multiplyRelinearizeRescale:(ASLCipherText *)encrypted1
+                       encrypted2:(ASLCipherText *)encrypted2
+              relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                             into:(ASLCipherText *)destination
+                            error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
     NSParameterAssert(relinearizationKeys != nil);
-    NSParameterAssert(pool != nil);
+    NSParameterAssert(destination != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
     try {
-        _evaluator->exponentiate(sealEncrypted, exponent, relinearizationKeys.sealRelinKeys, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        _evaluator->multiply([encrypted1 sealCipherTextReference], [encrypted2 sealCipherTextReference], sealDestination);
+        _evaluator->relinearize_inplace(sealDestination, [relinearizationKeys sealRelinKeysReference]);
+        _evaluator->rescale_to_next_inplace(sealDestination);
+        return scope.complete(destination) != nil;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
         }
-        return nil;
+        return NO;
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
         }
-        return nil;
+        return NO;
     }
 }
 
--(ASLCipherText * _Nullable)exponentiate:(ASLCipherText *)encrypted
-                                exponent:(uint64_t)exponent
-                     relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
-
-                                   error:(NSError **)error {
+-(ASLCipherText * _Nullable)multiplyPlainRescale:(ASLCipherText *)encrypted
+                                           plain:(ASLPlainText *)plain
+                                            pool:(ASLMemoryPoolHandle *)pool
+                                           error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = seal::Ciphertext(pool.memoryPoolHandle);
     try {
-        _evaluator->exponentiate(sealEncrypted, exponent, relinearizationKeys.sealRelinKeys, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        _evaluator->multiply_plain([encrypted sealCipherTextReference], [plain sealPlainTextReference], destination, pool.memoryPoolHandle);
+        _evaluator->rescale_to_next_inplace(destination, pool.memoryPoolHandle);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1169,41 +2776,47 @@
     }
 }
 
--(ASLCipherText *)addPlainInplace:(ASLCipherText *)encrypted
-                            plain:(ASLPlainText *)plain
-                            error:(NSError **)error {
+-(BOOL)multiplyPlainRescale:(ASLCipherText *)encrypted
+                      plain:(ASLPlainText *)plain
+                       into:(ASLCipherText *)destination
+                       pool:(ASLMemoryPoolHandle *)pool
+                      error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Plaintext sealPlainText = plain.sealPlainText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
     try {
-        _evaluator->add_plain_inplace(sealEncrypted, sealPlainText);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        _evaluator->multiply_plain([encrypted sealCipherTextReference], [plain sealPlainTextReference], sealDestination, pool.memoryPoolHandle);
+        _evaluator->rescale_to_next_inplace(sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
         }
-        return nil;
+        return NO;
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
         }
-        return nil;
+        return NO;
     }
 }
 
--(ASLCipherText * _Nullable)addPlain:(ASLCipherText *)encrypted
-                               plain:(ASLPlainText *)plain
-                               error:(NSError **)error {
+-(ASLCipherText * _Nullable)multiplyPlainRescale:(ASLCipherText *)encrypted
+                                           plain:(ASLPlainText *)plain
+                                           error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(plain != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     seal::Ciphertext destination = seal::Ciphertext();
     try {
-        _evaluator->add_plain(sealEncrypted, plain.sealPlainText, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        _evaluator->multiply_plain([encrypted sealCipherTextReference], [plain sealPlainTextReference], destination);
+        _evaluator->rescale_to_next_inplace(destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1217,41 +2830,49 @@
     }
 }
 
--(ASLCipherText *)subPlainInplace:(ASLCipherText *)encrypted
-                            plain:(ASLPlainText *)plain
-                            error:(NSError **)error {
+-(BOOL)multiplyPlainRescale:(ASLCipherText *)encrypted
+                      plain:(ASLPlainText *)plain
+                       into:(ASLCipherText *)destination
+                      error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
     NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
     try {
-        _evaluator->sub_plain_inplace(sealEncrypted, plain.sealPlainText);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        _evaluator->multiply_plain([encrypted sealCipherTextReference], [plain sealPlainTextReference], sealDestination);
+        _evaluator->rescale_to_next_inplace(sealDestination);
+        return scope.complete(destination) != nil;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
         }
-        return nil;
+        return NO;
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
         }
-        return nil;
+        return NO;
     }
 }
 
--(ASLCipherText * _Nullable)subPlain:(ASLCipherText *)encrypted
-                               plain:(ASLPlainText *)plain
+-(ASLCipherText * _Nullable)multiplyMany:(NSArray<ASLCipherText*>*)encrypteds
+                     relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
 
-                               error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
-    NSParameterAssert(plain != nil);
+                                    pool:(ASLMemoryPoolHandle *)pool
+                                   error:(NSError **)error {
+    NSParameterAssert(encrypteds != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds);
+    std::vector<seal::Ciphertext const *> const references = ASLCipherTextReferences(encrypteds);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
     seal::Ciphertext destination = seal::Ciphertext();
     try {
-        _evaluator->sub_plain(sealEncrypted, plain.sealPlainText, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        ASLMultiplyMany(*_evaluator, _context, references, [relinearizationKeys sealRelinKeysReference], self.batchConcurrency, pool.memoryPoolHandle, destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1265,41 +2886,50 @@
     }
 }
 
--(ASLCipherText *)multiplyPlainInplace:(ASLCipherText *)encrypted
-                                 plain:(ASLPlainText *)plain
-                                  pool:(ASLMemoryPoolHandle *)pool
-                                 error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
-    NSParameterAssert(plain != nil);
+-(BOOL)multiplyMany:(NSArray<ASLCipherText *> *)encrypteds
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+               into:(ASLCipherText *)destination
+               pool:(ASLMemoryPoolHandle *)pool
+              error:(NSError **)error {
+    NSParameterAssert(encrypteds != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(destination != nil);
     NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds);
+    std::vector<seal::Ciphertext const *> const references = ASLCipherTextReferences(encrypteds);
+    
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
     try {
-        _evaluator->multiply_plain_inplace(sealEncrypted, plain.sealPlainText, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        ASLMultiplyMany(*_evaluator, _context, references, [relinearizationKeys sealRelinKeysReference], self.batchConcurrency, pool.memoryPoolHandle, sealDestination);
+        return scope.complete(destination) != nil;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
         }
-        return nil;
+        return NO;
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
         }
-        return nil;
+        return NO;
     }
 }
 
--(ASLCipherText *)multiplyPlainInplace:(ASLCipherText *)encrypted
-                                 plain:(ASLPlainText *)plain
-                                 error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
-    NSParameterAssert(plain != nil);
+-(ASLCipherText * _Nullable)multiplyMany:(NSArray<ASLCipherText*>*)encrypteds
+                     relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
+
+                                   error:(NSError **)error {
+    NSParameterAssert(encrypteds != nil);
+    NSParameterAssert(relinearizationKeys != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds);
+    std::vector<seal::Ciphertext const *> const references = ASLCipherTextReferences(encrypteds);
+    
+    seal::Ciphertext destination = seal::Ciphertext();
     try {
-        _evaluator->multiply_plain_inplace(sealEncrypted, plain.sealPlainText);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        ASLMultiplyMany(*_evaluator, _context, references, [relinearizationKeys sealRelinKeysReference], self.batchConcurrency, seal::MemoryPoolHandle(), destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1313,46 +2943,48 @@
     }
 }
 
-
--(ASLCipherText * _Nullable)multiplyPlain:(ASLCipherText *)encrypted
-                                    plain:(ASLPlainText *)plain
-
-                                     pool:(ASLMemoryPoolHandle *)pool
-                                    error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
-    NSParameterAssert(plain != nil);
-    NSParameterAssert(pool != nil);
+-(BOOL)multiplyMany:(NSArray<ASLCipherText *> *)encrypteds
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+               into:(ASLCipherText *)destination
+              error:(NSError **)error {
+    NSParameterAssert(encrypteds != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(destination != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds);
+    std::vector<seal::Ciphertext const *> const references = ASLCipherTextReferences(encrypteds);
+    
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
     try {
-        _evaluator->multiply_plain(sealEncrypted, plain.sealPlainText, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        ASLMultiplyMany(*_evaluator, _context, references, [relinearizationKeys sealRelinKeysReference], self.batchConcurrency, seal::MemoryPoolHandle(), sealDestination);
+        return scope.complete(destination) != nil;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
         }
-        return nil;
+        return NO;
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
         }
-        return nil;
+        return NO;
     }
 }
 
--(ASLCipherText * _Nullable)multiplyPlain:(ASLCipherText *)encrypted
-                                    plain:(ASLPlainText *)plain
-
-                                    error:(NSError **)error {
+-(ASLCipherText *)exponentiateInplace:(ASLCipherText *)encrypted
+                             exponent:(uint64_t)exponent
+                  relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
+                                 pool:(ASLMemoryPoolHandle *)pool
+                                error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(plain != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
-        _evaluator->multiply_plain(sealEncrypted, plain.sealPlainText, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        ASLExponentiateInplace(*_evaluator, _context, sealEncrypted, exponent, [relinearizationKeys sealRelinKeysReference], pool.memoryPoolHandle);
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1366,22 +2998,18 @@
     }
 }
 
--(ASLPlainText *)transformToNttInplace:(ASLPlainText *)plain
-                          parametersId:(ASLParametersIdType)parametersId
-                                  pool:(ASLMemoryPoolHandle *)pool
-                                 error:(NSError **)error {
-    NSParameterAssert(plain != nil);
-    NSParameterAssert(pool != nil);
-    
-    seal::parms_id_type sealParametersId = {};
-    std::copy(std::begin(parametersId.block),
-              std::end(parametersId.block),
-              sealParametersId.begin());
+-(ASLCipherText *)exponentiateInplace:(ASLCipherText *)encrypted
+                             exponent:(uint64_t)exponent
+                  relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
+                                error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(relinearizationKeys != nil);
     
-    seal::Plaintext sealPlainText = plain.sealPlainText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
-        _evaluator->transform_to_ntt_inplace(sealPlainText, sealParametersId, pool.memoryPoolHandle);
-        return [[ASLPlainText alloc] initWithPlainText:sealPlainText];
+        ASLExponentiateInplace(*_evaluator, _context, sealEncrypted, exponent, [relinearizationKeys sealRelinKeysReference], seal::MemoryManager::GetPool());
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1395,20 +3023,21 @@
     }
 }
 
--(ASLPlainText *)transformToNttInplace:(ASLPlainText *)plain
-                          parametersId:(ASLParametersIdType)parametersId
-                                 error:(NSError **)error {
-    NSParameterAssert(plain != nil);
-    
-    seal::parms_id_type sealParametersId = {};
-    std::copy(std::begin(parametersId.block),
-              std::end(parametersId.block),
-              sealParametersId.begin());
+-(ASLCipherText * _Nullable)exponentiate:(ASLCipherText *)encrypted
+                                exponent:(uint64_t)exponent
+                     relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
+
+                                    pool:(ASLMemoryPoolHandle *)pool
+                                   error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(pool != nil);
     
-    seal::Plaintext sealPlainText = plain.sealPlainText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = encrypted.sealCipherText;
     try {
-        _evaluator->transform_to_ntt_inplace(sealPlainText, sealParametersId);
-        return [[ASLPlainText alloc] initWithPlainText:sealPlainText];
+        ASLExponentiateInplace(*_evaluator, _context, destination, exponent, [relinearizationKeys sealRelinKeysReference], pool.memoryPoolHandle);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1422,51 +3051,51 @@
     }
 }
 
--(ASLPlainText *)transformToNtt:(ASLPlainText *)plain
-                   parametersId:(ASLParametersIdType)parametersId
-                           pool:(ASLMemoryPoolHandle *)pool
-                          error:(NSError **)error {
-    NSParameterAssert(plain != nil);
+-(BOOL)exponentiate:(ASLCipherText *)encrypted
+           exponent:(uint64_t)exponent
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+               into:(ASLCipherText *)destination
+               pool:(ASLMemoryPoolHandle *)pool
+              error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(destination != nil);
     NSParameterAssert(pool != nil);
     
-    seal::parms_id_type sealParametersId = {};
-    std::copy(std::begin(parametersId.block),
-              std::end(parametersId.block),
-              sealParametersId.begin());
-    
-    seal::Plaintext sealPlainText = plain.sealPlainText;
-    seal::Plaintext sealNttPlainText = seal::Plaintext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
     try {
-        _evaluator->transform_to_ntt(sealPlainText, sealParametersId, sealNttPlainText, pool.memoryPoolHandle);
-        return [[ASLPlainText alloc] initWithPlainText:sealNttPlainText];
+        seal::Ciphertext result = [encrypted sealCipherTextReference];
+        ASLExponentiateInplace(*_evaluator, _context, result, exponent, [relinearizationKeys sealRelinKeysReference], pool.memoryPoolHandle);
+        // Copying rather than moving keeps the existing allocation of destination.
+        sealDestination = result;
+        return scope.complete(destination) != nil;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
         }
-        return nil;
+        return NO;
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
         }
-        return nil;
+        return NO;
     }
 }
 
--(ASLPlainText *)transformToNtt:(ASLPlainText *)plain
-                   parametersId:(ASLParametersIdType)parametersId
-                          error:(NSError **)error {
-    NSParameterAssert(plain != nil);
-    
-    seal::parms_id_type sealParametersId = {};
-    std::copy(std::begin(parametersId.block),
-              std::end(parametersId.block),
-              sealParametersId.begin());
+-(ASLCipherText * _Nullable)exponentiate:(ASLCipherText *)encrypted
+                                exponent:(uint64_t)exponent
+                     relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
+
+                                   error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(relinearizationKeys != nil);
     
-    seal::Plaintext sealPlainText = plain.sealPlainText;
-    seal::Plaintext sealNttPlainText = seal::Plaintext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = encrypted.sealCipherText;
     try {
-        _evaluator->transform_to_ntt(sealPlainText, sealParametersId, sealNttPlainText);
-        return [[ASLPlainText alloc] initWithPlainText:sealNttPlainText];
+        ASLExponentiateInplace(*_evaluator, _context, destination, exponent, [relinearizationKeys sealRelinKeysReference], seal::MemoryManager::GetPool());
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1480,37 +3109,51 @@
     }
 }
 
--(ASLCipherText *)transformToNttInplace:(ASLCipherText *)encrypted
-                                  error:(NSError **)error {
+-(BOOL)exponentiate:(ASLCipherText *)encrypted
+           exponent:(uint64_t)exponent
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+               into:(ASLCipherText *)destination
+              error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(destination != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
     try {
-        _evaluator->transform_to_ntt_inplace(sealEncrypted);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        seal::Ciphertext result = [encrypted sealCipherTextReference];
+        ASLExponentiateInplace(*_evaluator, _context, result, exponent, [relinearizationKeys sealRelinKeysReference], seal::MemoryManager::GetPool());
+        // Copying rather than moving keeps the existing allocation of destination.
+        sealDestination = result;
+        return scope.complete(destination) != nil;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
         }
-        return nil;
+        return NO;
     } catch (std::logic_error const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealLogicError:e];
         }
-        return nil;
+        return NO;
     }
 }
 
--(ASLCipherText *)transformToNtt:(ASLCipherText *)encrypted
-                           error:(NSError **)error {
+-(ASLCipherText *)addPlainInplace:(ASLCipherText *)encrypted
+                            plain:(ASLPlainText *)plain
+                            error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext sealNttCipherText = seal::Ciphertext();
-    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
     try {
-        _evaluator->transform_to_ntt(sealEncrypted, sealNttCipherText);
-        return [[ASLCipherText alloc] initWithCipherText:sealNttCipherText];
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:YES matchScales:YES];
+        }
+        seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+        seal::Plaintext const &sealPlainText = [plain sealPlainTextReference];
+        _evaluator->add_plain_inplace(sealEncrypted, sealPlainText);
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1524,14 +3167,21 @@
     }
 }
 
--(ASLCipherText *)transformFromNttInplace:(ASLCipherText *)encryptedNtt
-                                    error:(NSError **)error {
-    NSParameterAssert(encryptedNtt != nil);
+-(ASLCipherText * _Nullable)addPlain:(ASLCipherText *)encrypted
+                               plain:(ASLPlainText *)plain
+                               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
     
-    seal::Ciphertext sealNttCipherText = encryptedNtt.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = seal::Ciphertext();
     try {
-        _evaluator->transform_from_ntt_inplace(sealNttCipherText);
-        return [[ASLCipherText alloc] initWithCipherText:sealNttCipherText];
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:NO matchScales:YES];
+        }
+        seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+        _evaluator->add_plain(sealEncrypted, plain.sealPlainText, destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1545,15 +3195,1712 @@
     }
 }
 
--(ASLCipherText * _Nullable)transformFromNtt:(ASLCipherText *)encryptedNtt
-
-                                       error:(NSError **)error {
-    NSParameterAssert(encryptedNtt != nil);
+-(BOOL)addPlain:(ASLCipherText *)encrypted
+          plain:(ASLPlainText *)plain
+           into:(ASLCipherText *)destination
+          error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
     
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:NO matchScales:YES];
+        }
+        _evaluator->add_plain([encrypted sealCipherTextReference], [plain sealPlainTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText *)subPlainInplace:(ASLCipherText *)encrypted
+                            plain:(ASLPlainText *)plain
+                            error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:YES matchScales:YES];
+        }
+        seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+        _evaluator->sub_plain_inplace(sealEncrypted, [plain sealPlainTextReference]);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText * _Nullable)subPlain:(ASLCipherText *)encrypted
+                               plain:(ASLPlainText *)plain
+
+                               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:NO matchScales:YES];
+        }
+        seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+        _evaluator->sub_plain(sealEncrypted, plain.sealPlainText, destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)subPlain:(ASLCipherText *)encrypted
+          plain:(ASLPlainText *)plain
+           into:(ASLCipherText *)destination
+          error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:NO matchScales:YES];
+        }
+        _evaluator->sub_plain([encrypted sealCipherTextReference], [plain sealPlainTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText *)multiplyPlainInplace:(ASLCipherText *)encrypted
+                                 plain:(ASLPlainText *)plain
+                                  pool:(ASLMemoryPoolHandle *)pool
+                                 error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:YES matchScales:NO];
+        }
+        seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+        _evaluator->multiply_plain_inplace(sealEncrypted, [plain sealPlainTextReference], pool.memoryPoolHandle);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText *)multiplyPlainInplace:(ASLCipherText *)encrypted
+                                 plain:(ASLPlainText *)plain
+                                 error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:YES matchScales:NO];
+        }
+        seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+        _evaluator->multiply_plain_inplace(sealEncrypted, [plain sealPlainTextReference]);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+
+-(ASLCipherText * _Nullable)multiplyPlain:(ASLCipherText *)encrypted
+                                    plain:(ASLPlainText *)plain
+
+                                     pool:(ASLMemoryPoolHandle *)pool
+                                    error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:NO matchScales:NO];
+        }
+        seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+        _evaluator->multiply_plain(sealEncrypted, plain.sealPlainText, destination, pool.memoryPoolHandle);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)multiplyPlain:(ASLCipherText *)encrypted
+               plain:(ASLPlainText *)plain
+                into:(ASLCipherText *)destination
+                pool:(ASLMemoryPoolHandle *)pool
+               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:NO matchScales:NO];
+        }
+        _evaluator->multiply_plain([encrypted sealCipherTextReference], [plain sealPlainTextReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText * _Nullable)multiplyPlain:(ASLCipherText *)encrypted
+                                    plain:(ASLPlainText *)plain
+
+                                    error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:NO matchScales:NO];
+        }
+        seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+        _evaluator->multiply_plain(sealEncrypted, plain.sealPlainText, destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)multiplyPlain:(ASLCipherText *)encrypted
+               plain:(ASLPlainText *)plain
+                into:(ASLCipherText *)destination
+               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        if (_automaticAlignmentEnabled) {
+            [self alignCipherText:&encrypted plainText:&plain inplace:NO matchScales:NO];
+        }
+        _evaluator->multiply_plain([encrypted sealCipherTextReference], [plain sealPlainTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLPlainText *)transformToNttInplace:(ASLPlainText *)plain
+                          parametersId:(ASLParametersIdType)parametersId
+                                  pool:(ASLMemoryPoolHandle *)pool
+                                 error:(NSError **)error {
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Plaintext &sealPlainText = [plain mutableSealPlainText];
+    try {
+        _evaluator->transform_to_ntt_inplace(sealPlainText, sealParametersId, pool.memoryPoolHandle);
+        return scope.complete(plain);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLPlainText *)transformToNttInplace:(ASLPlainText *)plain
+                          parametersId:(ASLParametersIdType)parametersId
+                                 error:(NSError **)error {
+    NSParameterAssert(plain != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Plaintext &sealPlainText = [plain mutableSealPlainText];
+    try {
+        _evaluator->transform_to_ntt_inplace(sealPlainText, sealParametersId);
+        return scope.complete(plain);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLPlainText *)transformToNtt:(ASLPlainText *)plain
+                   parametersId:(ASLParametersIdType)parametersId
+                           pool:(ASLMemoryPoolHandle *)pool
+                          error:(NSError **)error {
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Plaintext sealPlainText = plain.sealPlainText;
+    seal::Plaintext sealNttPlainText = seal::Plaintext();
+    try {
+        _evaluator->transform_to_ntt(sealPlainText, sealParametersId, sealNttPlainText, pool.memoryPoolHandle);
+        return scope.complete([[ASLPlainText alloc] initWithPlainText:sealNttPlainText]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)transformToNtt:(ASLPlainText *)plain
+         parametersId:(ASLParametersIdType)parametersId
+                 into:(ASLPlainText *)destination
+                 pool:(ASLMemoryPoolHandle *)pool
+                error:(NSError **)error {
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Plaintext &sealDestination = [destination mutableSealPlainText];
+    try {
+        _evaluator->transform_to_ntt([plain sealPlainTextReference], sealParametersId, sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLPlainText *)transformToNtt:(ASLPlainText *)plain
+                   parametersId:(ASLParametersIdType)parametersId
+                          error:(NSError **)error {
+    NSParameterAssert(plain != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Plaintext sealPlainText = plain.sealPlainText;
+    seal::Plaintext sealNttPlainText = seal::Plaintext();
+    try {
+        _evaluator->transform_to_ntt(sealPlainText, sealParametersId, sealNttPlainText);
+        return scope.complete([[ASLPlainText alloc] initWithPlainText:sealNttPlainText]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)transformToNtt:(ASLPlainText *)plain
+         parametersId:(ASLParametersIdType)parametersId
+                 into:(ASLPlainText *)destination
+                error:(NSError **)error {
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, plain);
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block),
+              std::end(parametersId.block),
+              sealParametersId.begin());
+    
+    seal::Plaintext &sealDestination = [destination mutableSealPlainText];
+    try {
+        _evaluator->transform_to_ntt([plain sealPlainTextReference], sealParametersId, sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText *)transformToNttInplace:(ASLCipherText *)encrypted
+                                  error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->transform_to_ntt_inplace(sealEncrypted);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText *)transformToNtt:(ASLCipherText *)encrypted
+                           error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext sealNttCipherText = seal::Ciphertext();
+    
+    try {
+        _evaluator->transform_to_ntt(sealEncrypted, sealNttCipherText);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:sealNttCipherText]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)transformToNtt:(ASLCipherText *)encrypted
+                 into:(ASLCipherText *)destination
+                error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->transform_to_ntt([encrypted sealCipherTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText *)transformFromNttInplace:(ASLCipherText *)encryptedNtt
+                                    error:(NSError **)error {
+    NSParameterAssert(encryptedNtt != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encryptedNtt);
+    seal::Ciphertext &sealNttCipherText = [encryptedNtt mutableSealCipherText];
+    try {
+        _evaluator->transform_from_ntt_inplace(sealNttCipherText);
+        return scope.complete(encryptedNtt);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText * _Nullable)transformFromNtt:(ASLCipherText *)encryptedNtt
+
+                                       error:(NSError **)error {
+    NSParameterAssert(encryptedNtt != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encryptedNtt);
+    seal::Ciphertext destination = seal::Ciphertext();
     try {
         _evaluator->transform_from_ntt(encryptedNtt.sealCipherText, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)transformFromNtt:(ASLCipherText *)encryptedNtt
+                   into:(ASLCipherText *)destination
+                  error:(NSError **)error {
+    NSParameterAssert(encryptedNtt != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encryptedNtt);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->transform_from_ntt([encryptedNtt sealCipherTextReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText *)applyGaloisInplace:(ASLCipherText *)encrypted
+                       galoisElement:(uint64_t)galoisElement
+                           galoisKey:(ASLGaloisKeys *)galoisKey
+                                pool:(ASLMemoryPoolHandle *)pool
+                               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->apply_galois_inplace(sealEncrypted, static_cast<std::uint32_t>(galoisElement), [galoisKey sealGaloisKeysReference], pool.memoryPoolHandle);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText *)applyGaloisInplace:(ASLCipherText *)encrypted
+                       galoisElement:(uint64_t)galoisElement
+                           galoisKey:(ASLGaloisKeys *)galoisKey
+                               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->apply_galois_inplace(sealEncrypted, static_cast<std::uint32_t>(galoisElement), [galoisKey sealGaloisKeysReference]);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText * _Nullable)applyGalois:(ASLCipherText *)encrypted
+                          galoisElement:(uint64_t)galoisElement
+                              galoisKey:(ASLGaloisKeys *)galoisKey
+
+                                   pool:(ASLMemoryPoolHandle *)pool
+                                  error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        _evaluator->apply_galois(sealEncrypted, static_cast<std::uint32_t>(galoisElement), [galoisKey sealGaloisKeysReference], destination, pool.memoryPoolHandle);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)applyGalois:(ASLCipherText *)encrypted
+     galoisElement:(uint64_t)galoisElement
+         galoisKey:(ASLGaloisKeys *)galoisKey
+              into:(ASLCipherText *)destination
+              pool:(ASLMemoryPoolHandle *)pool
+             error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->apply_galois([encrypted sealCipherTextReference], static_cast<std::uint32_t>(galoisElement), [galoisKey sealGaloisKeysReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText * _Nullable)applyGalois:(ASLCipherText *)encrypted
+                          galoisElement:(uint64_t)galoisElement
+                              galoisKey:(ASLGaloisKeys *)galoisKey
+
+                                  error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        _evaluator->apply_galois(sealEncrypted, static_cast<std::uint32_t>(galoisElement), [galoisKey sealGaloisKeysReference], destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)applyGalois:(ASLCipherText *)encrypted
+     galoisElement:(uint64_t)galoisElement
+         galoisKey:(ASLGaloisKeys *)galoisKey
+              into:(ASLCipherText *)destination
+             error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->apply_galois([encrypted sealCipherTextReference], static_cast<std::uint32_t>(galoisElement), [galoisKey sealGaloisKeysReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText *)rotateRowsInplace:(ASLCipherText *)encrypted
+                              steps:(int)steps
+                          galoisKey:(ASLGaloisKeys *)galoisKey
+                               pool:(ASLMemoryPoolHandle *)pool
+                              error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->rotate_rows_inplace(sealEncrypted, steps, [galoisKey sealGaloisKeysReference], pool.memoryPoolHandle);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText *)rotateRowsInplace:(ASLCipherText *)encrypted
+                              steps:(int)steps
+                          galoisKey:(ASLGaloisKeys *)galoisKey
+                              error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->rotate_rows_inplace(sealEncrypted, steps, [galoisKey sealGaloisKeysReference]);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText * _Nullable)rotateRows:(ASLCipherText *)encrypted
+                                 steps:(int)steps
+                             galoisKey:(ASLGaloisKeys *)galoisKey
+
+                                  pool:(ASLMemoryPoolHandle *)pool
+                                 error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        _evaluator->rotate_rows(sealEncrypted, steps, [galoisKey sealGaloisKeysReference], destination, pool.memoryPoolHandle);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)rotateRows:(ASLCipherText *)encrypted
+            steps:(int)steps
+        galoisKey:(ASLGaloisKeys *)galoisKey
+             into:(ASLCipherText *)destination
+             pool:(ASLMemoryPoolHandle *)pool
+            error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->rotate_rows([encrypted sealCipherTextReference], steps, [galoisKey sealGaloisKeysReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText * _Nullable)rotateRows:(ASLCipherText *)encrypted
+                                 steps:(int)steps
+                             galoisKey:(ASLGaloisKeys *)galoisKey
+
+                                 error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        _evaluator->rotate_rows(sealEncrypted, steps, [galoisKey sealGaloisKeysReference], destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)rotateRows:(ASLCipherText *)encrypted
+            steps:(int)steps
+        galoisKey:(ASLGaloisKeys *)galoisKey
+             into:(ASLCipherText *)destination
+            error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->rotate_rows([encrypted sealCipherTextReference], steps, [galoisKey sealGaloisKeysReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText *)rotateColumnsInplace:(ASLCipherText *)encrypted
+                             galoisKey:(ASLGaloisKeys *)galoisKey
+                                  pool:(ASLMemoryPoolHandle *)pool
+                                 error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->rotate_columns_inplace(sealEncrypted, [galoisKey sealGaloisKeysReference], pool.memoryPoolHandle);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText *)rotateColumnsInplace:(ASLCipherText *)encrypted
+                             galoisKey:(ASLGaloisKeys *)galoisKey
+                                 error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->rotate_columns_inplace(sealEncrypted, [galoisKey sealGaloisKeysReference]);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText * _Nullable)rotateColumns:(ASLCipherText *)encrypted
+                                galoisKey:(ASLGaloisKeys *)galoisKey
+
+                                     pool:(ASLMemoryPoolHandle *)pool
+                                    error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        _evaluator->rotate_columns(sealEncrypted, [galoisKey sealGaloisKeysReference], destination, pool.memoryPoolHandle);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)rotateColumns:(ASLCipherText *)encrypted
+           galoisKey:(ASLGaloisKeys *)galoisKey
+                into:(ASLCipherText *)destination
+                pool:(ASLMemoryPoolHandle *)pool
+               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->rotate_columns([encrypted sealCipherTextReference], [galoisKey sealGaloisKeysReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText * _Nullable)rotateColumns:(ASLCipherText *)encrypted
+                                galoisKey:(ASLGaloisKeys *)galoisKey
+
+                                    error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        _evaluator->rotate_columns(sealEncrypted, [galoisKey sealGaloisKeysReference], destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)rotateColumns:(ASLCipherText *)encrypted
+           galoisKey:(ASLGaloisKeys *)galoisKey
+                into:(ASLCipherText *)destination
+               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->rotate_columns([encrypted sealCipherTextReference], [galoisKey sealGaloisKeysReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText *)rotateVectorInplace:(ASLCipherText *)encrypted
+                                steps:(int)steps
+                            galoisKey:(ASLGaloisKeys *)galoisKey
+                                 pool:(ASLMemoryPoolHandle *)pool
+                                error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->rotate_vector_inplace(sealEncrypted, steps, [galoisKey sealGaloisKeysReference], pool.memoryPoolHandle);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText *)rotateVectorInplace:(ASLCipherText *)encrypted
+                                steps:(int)steps
+                            galoisKey:(ASLGaloisKeys *)galoisKey
+                                error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->rotate_vector_inplace(sealEncrypted, steps, [galoisKey sealGaloisKeysReference]);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText * _Nullable)rotateVector:(ASLCipherText *)encrypted
+                                   steps:(int)steps
+                               galoisKey:(ASLGaloisKeys *)galoisKey
+
+                                    pool:(ASLMemoryPoolHandle *)pool
+                                   error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        _evaluator->rotate_vector(sealEncrypted, steps, [galoisKey sealGaloisKeysReference], destination, pool.memoryPoolHandle);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)rotateVector:(ASLCipherText *)encrypted
+              steps:(int)steps
+          galoisKey:(ASLGaloisKeys *)galoisKey
+               into:(ASLCipherText *)destination
+               pool:(ASLMemoryPoolHandle *)pool
+              error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->rotate_vector([encrypted sealCipherTextReference], steps, [galoisKey sealGaloisKeysReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText * _Nullable)rotateVector:(ASLCipherText *)encrypted
+                                   steps:(int)steps
+                               galoisKey:(ASLGaloisKeys *)galoisKey
+
+                                   error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        _evaluator->rotate_vector(sealEncrypted, steps, [galoisKey sealGaloisKeysReference], destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)rotateVector:(ASLCipherText *)encrypted
+              steps:(int)steps
+          galoisKey:(ASLGaloisKeys *)galoisKey
+               into:(ASLCipherText *)destination
+              error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->rotate_vector([encrypted sealCipherTextReference], steps, [galoisKey sealGaloisKeysReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText *)complexConjugateInplace:(ASLCipherText *)encrypted
+                                galoisKey:(ASLGaloisKeys *)galoisKey
+                                     pool:(ASLMemoryPoolHandle *)pool
+                                    error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->complex_conjugate_inplace(sealEncrypted, [galoisKey sealGaloisKeysReference], pool.memoryPoolHandle);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText *)complexConjugateInplace:(ASLCipherText *)encrypted
+                                galoisKey:(ASLGaloisKeys *)galoisKey
+                                    error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        _evaluator->complex_conjugate_inplace(sealEncrypted, [galoisKey sealGaloisKeysReference]);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText * _Nullable)complexConjugate:(ASLCipherText *)encrypted
+                                   galoisKey:(ASLGaloisKeys *)galoisKey
+                                        pool:(ASLMemoryPoolHandle *)pool
+                                       error:(NSError **)error {
+    
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext destination = seal::Ciphertext();
+    try {
+        _evaluator->complex_conjugate(sealEncrypted, [galoisKey sealGaloisKeysReference], destination, pool.memoryPoolHandle);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)complexConjugate:(ASLCipherText *)encrypted
+              galoisKey:(ASLGaloisKeys *)galoisKey
+                   into:(ASLCipherText *)destination
+                   pool:(ASLMemoryPoolHandle *)pool
+                  error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(destination != nil);
+    NSParameterAssert(pool != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->complex_conjugate([encrypted sealCipherTextReference], [galoisKey sealGaloisKeysReference], sealDestination, pool.memoryPoolHandle);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText * _Nullable)complexConjugate:(ASLCipherText *)encrypted
+                                   galoisKey:(ASLGaloisKeys *)galoisKey
+                                       error:(NSError **)error {
+    
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    seal::Ciphertext destination = seal::Ciphertext();
+    
+    try {
+        _evaluator->complex_conjugate(sealEncrypted, [galoisKey sealGaloisKeysReference], destination);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:destination]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)complexConjugate:(ASLCipherText *)encrypted
+              galoisKey:(ASLGaloisKeys *)galoisKey
+                   into:(ASLCipherText *)destination
+                  error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        _evaluator->complex_conjugate([encrypted sealCipherTextReference], [galoisKey sealGaloisKeysReference], sealDestination);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+#pragma mark - Automatic Alignment
+
+- (NSUInteger)alignedOperandCacheCapacity {
+    std::lock_guard<std::mutex> lock(_alignedOperandMutex);
+    return _alignedOperandCacheCapacity;
+}
+
+- (void)setAlignedOperandCacheCapacity:(NSUInteger)alignedOperandCacheCapacity {
+    std::lock_guard<std::mutex> lock(_alignedOperandMutex);
+    _alignedOperandCacheCapacity = alignedOperandCacheCapacity;
+    [self evictAlignedOperandsLocked];
+}
+
+- (NSUInteger)alignedOperandCacheCount {
+    std::lock_guard<std::mutex> lock(_alignedOperandMutex);
+    return _alignedOperands.size();
+}
+
+-(void)removeAllAlignedOperands {
+    std::lock_guard<std::mutex> lock(_alignedOperandMutex);
+    _alignedOperandIndex.clear();
+    _alignedOperands.clear();
+}
+
+/// Returns the aligned copy of operand cached under key, computing it on a miss. compute runs
+/// outside the lock so concurrent alignments do not serialize; when two threads miss on the same
+/// key, the entry inserted first is kept and returned to both.
+- (id)alignedOperandOf:(id)operand
+         mutationCount:(NSUInteger)mutationCount
+                   key:(ASLAlignmentKey)key
+               compute:(id (^)(void))compute {
+    key.operand = reinterpret_cast<std::uintptr_t>((__bridge void *)operand);
+    auto const isCurrent = [&](ASLAlignedOperandEntry const &entry) {
+        return entry.operand == operand && entry.mutationCount == mutationCount;
+    };
+    
+    {
+        std::lock_guard<std::mutex> lock(_alignedOperandMutex);
+        auto const cached = _alignedOperandIndex.find(key);
+        if (cached != _alignedOperandIndex.end()) {
+            if (isCurrent(*cached->second)) {
+                _alignedOperands.splice(_alignedOperands.begin(), _alignedOperands, cached->second);
+                return cached->second->aligned;
+            }
+            _alignedOperands.erase(cached->second);
+            _alignedOperandIndex.erase(cached);
+        }
+    }
+    
+    id const aligned = compute();
+    
+    std::lock_guard<std::mutex> lock(_alignedOperandMutex);
+    if (_alignedOperandCacheCapacity == 0) {
+        return aligned;
+    }
+    auto const raced = _alignedOperandIndex.find(key);
+    if (raced != _alignedOperandIndex.end()) {
+        if (isCurrent(*raced->second)) {
+            return raced->second->aligned;
+        }
+        _alignedOperands.erase(raced->second);
+        _alignedOperandIndex.erase(raced);
+    }
+    _alignedOperands.push_front({key, operand, mutationCount, aligned});
+    _alignedOperandIndex.emplace(key, _alignedOperands.begin());
+    [self evictAlignedOperandsLocked];
+    return aligned;
+}
+
+- (void)evictAlignedOperandsLocked {
+    while (_alignedOperands.size() > _alignedOperandCacheCapacity) {
+        _alignedOperandIndex.erase(_alignedOperands.back().key);
+        _alignedOperands.pop_back();
+    }
+}
+
+/// Applies transform to *operand in place when inplace is set; otherwise replaces *operand with
+/// its transformed copy, which is cached under key.
+- (void)alignCipherText:(ASLCipherText * __strong *)operand
+                inplace:(BOOL)inplace
+                    key:(ASLAlignmentKey)key
+              transform:(void (^)(seal::Ciphertext const &source, seal::Ciphertext &destination))transform {
+    if (inplace) {
+        seal::Ciphertext &encrypted = [*operand mutableSealCipherText];
+        transform(encrypted, encrypted);
+        return;
+    }
+    ASLCipherText * const source = *operand;
+    *operand = [self alignedOperandOf:source mutationCount:source.mutationCount key:key compute:^id {
+        seal::Ciphertext destination;
+        transform([source sealCipherTextReference], destination);
+        return [[ASLCipherText alloc] initWithCipherText:std::move(destination)];
+    }];
+}
+
+/// Replaces *operand with its transformed copy, which is cached under key.
+- (void)alignPlainText:(ASLPlainText * __strong *)operand
+                   key:(ASLAlignmentKey)key
+             transform:(void (^)(seal::Plaintext const &source, seal::Plaintext &destination))transform {
+    ASLPlainText * const source = *operand;
+    *operand = [self alignedOperandOf:source mutationCount:source.mutationCount key:key compute:^id {
+        seal::Plaintext destination;
+        transform([source sealPlainTextReference], destination);
+        return [[ASLPlainText alloc] initWithPlainText:std::move(destination)];
+    }];
+}
+
+/// Brings *encrypted1 and *encrypted2 to a common level and, when matchScales is set, a common
+/// scale, as described in Automatic Alignment. *encrypted1 is modified in place when inplace is
+/// set; otherwise the operands that need switching are replaced by cached copies.
+- (void)alignCipherText:(ASLCipherText * __strong *)encrypted1
+             cipherText:(ASLCipherText * __strong *)encrypted2
+                inplace:(BOOL)inplace
+            matchScales:(BOOL)matchScales {
+    std::shared_ptr<seal::SEALContext> const context = _context;
+    seal::Evaluator * const evaluator = _evaluator;
+    auto contextData = [&](ASLCipherText *encrypted) {
+        return context->get_context_data([encrypted sealCipherTextReference].parms_id());
+    };
+    if (!contextData(*encrypted1) || !contextData(*encrypted2)) {
+        // Invalid operands are reported by the operation itself.
+        return;
+    }
+    auto scale = [](ASLCipherText *encrypted) {
+        return [encrypted sealCipherTextReference].scale();
+    };
+    
+    if (matchScales && !ASLScalesAreClose(scale(*encrypted1), scale(*encrypted2))) {
+        // Rescale the operand with the larger scale when that brings it near the other scale.
+        bool const firstIsLarger = scale(*encrypted1) > scale(*encrypted2);
+        ASLCipherText * __strong * const larger = firstIsLarger ? encrypted1 : encrypted2;
+        double const smallerScale = scale(firstIsLarger ? *encrypted2 : *encrypted1);
+        auto const largerData = contextData(*larger);
+        auto const nextData = largerData->next_context_data();
+        double const prime = static_cast<double>(largerData->parms().coeff_modulus().back().value());
+        double const ratio = scale(*larger) / prime / smallerScale;
+        if (nextData && ratio > 0.5 && ratio < 2.0) {
+            [self alignCipherText:larger
+                          inplace:inplace && firstIsLarger
+                              key:ASLAlignmentKey(ASLAlignmentRescale, nextData->parms_id(), 0)
+                        transform:^(seal::Ciphertext const &source, seal::Ciphertext &destination) {
+                evaluator->rescale_to_next(source, destination);
+            }];
+        }
+    }
+    if (matchScales && !ASLScalesAreClose(scale(*encrypted1), scale(*encrypted2))) {
+        // Multiply the operand at the higher level by one, encoded so that the rescaled product
+        // has exactly the other operand's scale.
+        bool const firstIsHigher = contextData(*encrypted1)->chain_index() > contextData(*encrypted2)->chain_index();
+        ASLCipherText * __strong * const adjusted = firstIsHigher ? encrypted1 : encrypted2;
+        double const targetScale = scale(firstIsHigher ? *encrypted2 : *encrypted1);
+        auto const adjustedData = contextData(*adjusted);
+        seal::parms_id_type const parmsId = adjustedData->parms_id();
+        double const prime = static_cast<double>(adjustedData->parms().coeff_modulus().back().value());
+        // One is encoded as the single coefficient round(oneScale), which is 0 below 1 and would
+        // make the product transparent.
+        double const oneScale = targetScale * prime / scale(*adjusted);
+        if (!(oneScale >= 1.0)) {
+            throw std::invalid_argument("scales cannot be aligned: the operand at the higher level has a scale larger than the other scale times the prime it would be rescaled by");
+        }
+        [self alignCipherText:adjusted
+                      inplace:inplace && firstIsHigher
+                          key:ASLAlignmentKey(ASLAlignmentMultiplyByOne, parmsId, targetScale)
+                    transform:^(seal::Ciphertext const &source, seal::Ciphertext &destination) {
+            seal::CKKSEncoder encoder(context);
+            seal::Plaintext one;
+            encoder.encode(1.0, parmsId, oneScale, one);
+            evaluator->multiply_plain(source, one, destination);
+            evaluator->rescale_to_next_inplace(destination);
+            destination.scale() = targetScale;
+        }];
+    }
+    
+    size_t const level1 = contextData(*encrypted1)->chain_index();
+    size_t const level2 = contextData(*encrypted2)->chain_index();
+    if (level1 != level2) {
+        bool const firstIsHigher = level1 > level2;
+        ASLCipherText * __strong * const higher = firstIsHigher ? encrypted1 : encrypted2;
+        seal::parms_id_type const parmsId = [(firstIsHigher ? *encrypted2 : *encrypted1) sealCipherTextReference].parms_id();
+        [self alignCipherText:higher
+                      inplace:inplace && firstIsHigher
+                          key:ASLAlignmentKey(ASLAlignmentModSwitch, parmsId, 0)
+                    transform:^(seal::Ciphertext const &source, seal::Ciphertext &destination) {
+            evaluator->mod_switch_to(source, parmsId, destination);
+        }];
+    }
+    
+    double const scale1 = scale(*encrypted1);
+    double const scale2 = scale(*encrypted2);
+    if (matchScales && scale1 != scale2 && ASLScalesAreClose(scale1, scale2)) {
+        if (inplace) {
+            [*encrypted1 mutableSealCipherText].scale() = scale2;
+        } else {
+            seal::parms_id_type const parmsId = [*encrypted2 sealCipherTextReference].parms_id();
+            [self alignCipherText:encrypted2
+                          inplace:NO
+                              key:ASLAlignmentKey(ASLAlignmentSetScale, parmsId, scale1)
+                        transform:^(seal::Ciphertext const &source, seal::Ciphertext &destination) {
+                destination = source;
+                destination.scale() = scale1;
+            }];
+        }
+    }
+}
+
+/// Brings *encrypted and *plain to a common level and, when matchScales is set, makes scales that
+/// differ only by rescaling error identical. Only plaintexts in NTT form, as used by CKKS, have a
+/// level. *encrypted is modified in place when inplace is set; *plain is always replaced by a
+/// cached copy when it needs switching.
+- (void)alignCipherText:(ASLCipherText * __strong *)encrypted
+              plainText:(ASLPlainText * __strong *)plain
+                inplace:(BOOL)inplace
+            matchScales:(BOOL)matchScales {
+    seal::Evaluator * const evaluator = _evaluator;
+    seal::Ciphertext const &sealEncrypted = [*encrypted sealCipherTextReference];
+    seal::Plaintext const &sealPlain = [*plain sealPlainTextReference];
+    if (!sealPlain.is_ntt_form()) {
+        return;
+    }
+    auto const cipherData = _context->get_context_data(sealEncrypted.parms_id());
+    auto const plainData = _context->get_context_data(sealPlain.parms_id());
+    if (!cipherData || !plainData) {
+        // Invalid operands are reported by the operation itself.
+        return;
+    }
+    
+    if (cipherData->chain_index() > plainData->chain_index()) {
+        seal::parms_id_type const parmsId = plainData->parms_id();
+        [self alignCipherText:encrypted
+                      inplace:inplace
+                          key:ASLAlignmentKey(ASLAlignmentModSwitch, parmsId, 0)
+                    transform:^(seal::Ciphertext const &source, seal::Ciphertext &destination) {
+            evaluator->mod_switch_to(source, parmsId, destination);
+        }];
+    } else if (plainData->chain_index() > cipherData->chain_index()) {
+        seal::parms_id_type const parmsId = cipherData->parms_id();
+        [self alignPlainText:plain
+                         key:ASLAlignmentKey(ASLAlignmentModSwitch, parmsId, 0)
+                   transform:^(seal::Plaintext const &source, seal::Plaintext &destination) {
+            evaluator->mod_switch_to(source, parmsId, destination);
+        }];
+    }
+    
+    double const cipherScale = [*encrypted sealCipherTextReference].scale();
+    double const plainScale = [*plain sealPlainTextReference].scale();
+    if (matchScales && cipherScale != plainScale && ASLScalesAreClose(cipherScale, plainScale)) {
+        if (inplace) {
+            [*encrypted mutableSealCipherText].scale() = plainScale;
+        } else {
+            seal::parms_id_type const parmsId = [*plain sealPlainTextReference].parms_id();
+            [self alignPlainText:plain
+                             key:ASLAlignmentKey(ASLAlignmentSetScale, parmsId, cipherScale)
+                       transform:^(seal::Plaintext const &source, seal::Plaintext &destination) {
+                destination = source;
+                destination.scale() = cipherScale;
+            }];
+        }
+    }
+}
+
+#pragma mark - Slot Reductions
+
+-(ASLCipherText * _Nullable)sumSlots:(ASLCipherText *)encrypted
+                           galoisKey:(ASLGaloisKeys *)galoisKey
+                               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    return [self sumSlotsInplace:[encrypted copy] galoisKey:galoisKey operation:_cmd error:error];
+}
+
+-(ASLCipherText * _Nullable)sumSlotsInplace:(ASLCipherText *)encrypted
+                                  galoisKey:(ASLGaloisKeys *)galoisKey
+                                      error:(NSError **)error {
+    return [self sumSlotsInplace:encrypted galoisKey:galoisKey operation:_cmd error:error];
+}
+
+/// Sums the slots of encrypted in place, recording the call in the instrumentation as operation.
+-(ASLCipherText * _Nullable)sumSlotsInplace:(ASLCipherText *)encrypted
+                                  galoisKey:(ASLGaloisKeys *)galoisKey
+                                  operation:(SEL)operation
+                                      error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, operation, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
+    try {
+        [self sumAllSlotsInplace:sealEncrypted galoisKeys:[galoisKey sealGaloisKeysReference]];
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1567,19 +4914,42 @@
     }
 }
 
--(ASLCipherText *)applyGaloisInplace:(ASLCipherText *)encrypted
-                       galoisElement:(uint64_t)galoisElement
+-(ASLCipherText * _Nullable)sumSlots:(ASLCipherText *)encrypted
+                             inRange:(NSRange)range
                            galoisKey:(ASLGaloisKeys *)galoisKey
-                                pool:(ASLMemoryPoolHandle *)pool
                                error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
+    return [self sumSlotsInplace:[encrypted copy] inRange:range galoisKey:galoisKey operation:_cmd error:error];
+}
+
+-(ASLCipherText * _Nullable)sumSlotsInplace:(ASLCipherText *)encrypted
+                                    inRange:(NSRange)range
+                                  galoisKey:(ASLGaloisKeys *)galoisKey
+                                      error:(NSError **)error {
+    return [self sumSlotsInplace:encrypted inRange:range galoisKey:galoisKey operation:_cmd error:error];
+}
+
+/// Sums the slots of encrypted in range in place, recording the call in the instrumentation
+/// as operation.
+-(ASLCipherText * _Nullable)sumSlotsInplace:(ASLCipherText *)encrypted
+                                    inRange:(NSRange)range
+                                  galoisKey:(ASLGaloisKeys *)galoisKey
+                                  operation:(SEL)operation
+                                      error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
     NSParameterAssert(galoisKey != nil);
-    NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, operation, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
-        _evaluator->apply_galois_inplace(sealEncrypted, static_cast<std::uint32_t>(galoisElement), galoisKey.sealGaloisKeys, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        [self validateSumSlotsRange:range];
+        ASLSumWindowInplace(*_evaluator,
+                            sealEncrypted,
+                            range.length,
+                            [self isBatchingScheme],
+                            [galoisKey sealGaloisKeysReference],
+                            seal::MemoryManager::GetPool());
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1593,17 +4963,406 @@
     }
 }
 
--(ASLCipherText *)applyGaloisInplace:(ASLCipherText *)encrypted
-                       galoisElement:(uint64_t)galoisElement
-                           galoisKey:(ASLGaloisKeys *)galoisKey
+-(ASLCipherText * _Nullable)innerProduct:(ASLCipherText *)encrypted1
+                                    with:(ASLCipherText *)encrypted2
+                     relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                               galoisKey:(ASLGaloisKeys *)galoisKey
+                                   error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    seal::MemoryPoolHandle pool = seal::MemoryManager::GetPool();
+    seal::Ciphertext destination = seal::Ciphertext(pool);
+    try {
+        _evaluator->multiply([encrypted1 sealCipherTextReference], [encrypted2 sealCipherTextReference], destination, pool);
+        _evaluator->relinearize_inplace(destination, [relinearizationKeys sealRelinKeysReference], pool);
+        if (![self isBatchingScheme]) {
+            _evaluator->rescale_to_next_inplace(destination, pool);
+        }
+        [self sumAllSlotsInplace:destination galoisKeys:[galoisKey sealGaloisKeysReference]];
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(NSArray<NSNumber *> *)galoisStepsForSumSlots {
+    size_t const rowSize = _context->first_context_data()->parms().poly_modulus_degree() >> 1;
+    NSMutableArray<NSNumber *> * const steps = [NSMutableArray array];
+    if ([self isBatchingScheme]) {
+        [steps addObject:@0];
+    }
+    for (int const step : ASLSumWindowSteps(rowSize)) {
+        [steps addObject:@(step)];
+    }
+    return steps;
+}
+
+-(NSArray<NSNumber *> *)galoisStepsForSumSlotsInRange:(NSRange)range {
+    NSMutableArray<NSNumber *> * const steps = [NSMutableArray array];
+    for (int const step : ASLSumWindowSteps(range.length)) {
+        [steps addObject:@(step)];
+    }
+    return steps;
+}
+
+/// Sums every slot of encrypted into every slot, rotating rows and then columns for BFV.
+-(void)sumAllSlotsInplace:(seal::Ciphertext &)encrypted
+               galoisKeys:(seal::GaloisKeys const &)galoisKeys {
+    seal::MemoryPoolHandle pool = seal::MemoryManager::GetPool();
+    bool const isBatchingScheme = [self isBatchingScheme];
+    size_t const rowSize = encrypted.poly_modulus_degree() >> 1;
+    ASLSumWindowInplace(*_evaluator, encrypted, rowSize, isBatchingScheme, galoisKeys, pool);
+    if (isBatchingScheme) {
+        seal::Ciphertext swapped(pool);
+        _evaluator->rotate_columns(encrypted, galoisKeys, swapped, pool);
+        _evaluator->add_inplace(encrypted, swapped);
+    }
+}
+
+/// Throws unless range is a non-empty range of slots that, for BFV, lies within one matrix row.
+-(void)validateSumSlotsRange:(NSRange)range {
+    size_t const polyModulusDegree = _context->first_context_data()->parms().poly_modulus_degree();
+    size_t const rowSize = polyModulusDegree >> 1;
+    size_t const slotCount = [self isBatchingScheme] ? polyModulusDegree : rowSize;
+    if (range.length == 0 || range.location >= slotCount || range.length > slotCount - range.location) {
+        throw std::invalid_argument("range is out of bounds");
+    }
+    if ([self isBatchingScheme] && range.location / rowSize != (NSMaxRange(range) - 1) / rowSize) {
+        throw std::invalid_argument("range must not cross a matrix row");
+    }
+}
+
+/// Returns whether the context uses BFV, whose slots form a 2-by-(N/2) matrix, rather than CKKS.
+-(BOOL)isBatchingScheme {
+    return _context->key_context_data()->parms().scheme() == seal::scheme_type::BFV;
+}
+
+#pragma mark - Prepared Plaintexts
+
+-(ASLCipherText * _Nullable)multiplyPlainInplace:(ASLCipherText *)encrypted
+                                        prepared:(ASLPreparedPlainText *)plain
+                                           error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    try {
+        ASLMultiplyPreparedInplace(*_evaluator, [encrypted mutableSealCipherText], plain);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText * _Nullable)multiplyPlain:(ASLCipherText *)encrypted
+                                 prepared:(ASLPreparedPlainText *)plain
+                                    error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    try {
+        seal::Ciphertext result = [encrypted sealCipherTextReference];
+        ASLMultiplyPreparedInplace(*_evaluator, result, plain);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(result)]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)multiplyPlain:(ASLCipherText *)encrypted
+            prepared:(ASLPreparedPlainText *)plain
+                into:(ASLCipherText *)destination
+               error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        if (encrypted != destination) {
+            sealDestination = [encrypted sealCipherTextReference];
+        }
+        ASLMultiplyPreparedInplace(*_evaluator, sealDestination, plain);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+-(ASLCipherText * _Nullable)addPlainInplace:(ASLCipherText *)encrypted
+                                   prepared:(ASLPreparedPlainText *)plain
+                                      error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    try {
+        ASLAddPreparedInplace(*_evaluator, [encrypted mutableSealCipherText], plain);
+        return scope.complete(encrypted);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(ASLCipherText * _Nullable)addPlain:(ASLCipherText *)encrypted
+                            prepared:(ASLPreparedPlainText *)plain
                                error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    try {
+        seal::Ciphertext result = [encrypted sealCipherTextReference];
+        ASLAddPreparedInplace(*_evaluator, result, plain);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(result)]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+-(BOOL)addPlain:(ASLCipherText *)encrypted
+       prepared:(ASLPreparedPlainText *)plain
+           into:(ASLCipherText *)destination
+          error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(destination != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealDestination = [destination mutableSealCipherText];
+    try {
+        if (encrypted != destination) {
+            sealDestination = [encrypted sealCipherTextReference];
+        }
+        ASLAddPreparedInplace(*_evaluator, sealDestination, plain);
+        return scope.complete(destination) != nil;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+#pragma mark - Multiply Accumulate
+
+-(ASLCipherText * _Nullable)multiplyAccumulate:(NSArray<ASLCipherText *> *)encrypteds1
+                                    encrypted2:(NSArray<ASLCipherText *> *)encrypteds2
+                           relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                         error:(NSError **)error {
+    NSParameterAssert(encrypteds1 != nil);
+    NSParameterAssert(encrypteds2 != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds1);
+    std::vector<seal::Ciphertext const *> const references1 = ASLCipherTextReferences(encrypteds1);
+    std::vector<seal::Ciphertext const *> const references2 = ASLCipherTextReferences(encrypteds2);
+    seal::RelinKeys const &sealRelinKeys = [relinearizationKeys sealRelinKeysReference];
+    std::shared_ptr<seal::SEALContext> const context = _context;
+    seal::Evaluator &evaluator = *_evaluator;
+    
+    try {
+        if (references1.size() != references2.size()) {
+            throw std::invalid_argument("encrypteds1 and encrypteds2 must have the same count");
+        }
+        if (references1.empty()) {
+            throw std::invalid_argument("encrypteds cannot be empty");
+        }
+        
+        // Each worker accumulates the unrelinearized products of one contiguous range, reusing a
+        // single product buffer reserved for size 3 so no multiplication reallocates.
+        size_t const count = references1.size();
+        size_t const chunkCount = std::max<size_t>(1, std::min<size_t>(self.batchConcurrency, count));
+        std::vector<seal::Ciphertext> sums(chunkCount);
+        ASLParallelFor(chunkCount, chunkCount, [&](size_t chunk, seal::MemoryPoolHandle const &pool) {
+            size_t const begin = count * chunk / chunkCount;
+            size_t const end = count * (chunk + 1) / chunkCount;
+            seal::Ciphertext &sum = sums[chunk];
+            seal::Ciphertext product(context, references1[begin]->parms_id(), 3, pool);
+            evaluator.multiply(*references1[begin], *references2[begin], sum, pool);
+            for (size_t index = begin + 1; index < end; ++index) {
+                evaluator.multiply(*references1[index], *references2[index], product, pool);
+                evaluator.add_inplace(sum, product);
+            }
+        });
+        
+        seal::Ciphertext destination = std::move(sums[0]);
+        for (size_t chunk = 1; chunk < chunkCount; ++chunk) {
+            evaluator.add_inplace(destination, sums[chunk]);
+        }
+        evaluator.relinearize_inplace(destination, sealRelinKeys);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+#pragma mark - Matrix Multiplication
+
+-(ASLCipherText * _Nullable)multiplyMatrix:(ASLPlainMatrix *)matrix
+                                    vector:(ASLCipherText *)encrypted
+                                 galoisKey:(ASLGaloisKeys *)galoisKey
+                                     error:(NSError **)error {
+    NSParameterAssert(matrix != nil);
+    NSParameterAssert(encrypted != nil);
     NSParameterAssert(galoisKey != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    size_t const babyStepCount = matrix.babyStepCount;
+    size_t const giantStepCount = matrix.giantStepCount;
+    size_t const dimension = matrix.dimension;
+    std::vector<seal::Plaintext const *> diagonals(dimension, nullptr);
+    for (size_t k = 0; k < dimension; ++k) {
+        ASLPlainText * const diagonal = [matrix diagonalAtIndex:k];
+        if (diagonal != nil) {
+            diagonals[k] = &[diagonal sealPlainTextReference];
+        }
+    }
+    seal::Ciphertext const &sealEncrypted = [encrypted sealCipherTextReference];
+    seal::GaloisKeys const &sealGaloisKeys = [galoisKey sealGaloisKeysReference];
+    bool const isBatchingScheme = [self isBatchingScheme];
+    size_t const concurrency = self.batchConcurrency;
+    seal::Evaluator &evaluator = *_evaluator;
+    
     try {
-        _evaluator->apply_galois_inplace(sealEncrypted, static_cast<std::uint32_t>(galoisElement), galoisKey.sealGaloisKeys);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        if (matrix.diagonalCount == 0) {
+            throw std::invalid_argument("matrix must have a non-zero diagonal");
+        }
+        
+        // Baby steps: the vector rotated by 0 ... babyStepCount - 1, in NTT form so the
+        // pre-transformed BFV diagonals multiply without further transforms.
+        std::vector<int> babySteps;
+        for (size_t step = 0; step < babyStepCount; ++step) {
+            babySteps.push_back(static_cast<int>(step));
+        }
+        std::vector<seal::Ciphertext> babies = ASLRotateBySteps(evaluator, sealEncrypted, babySteps, sealGaloisKeys, isBatchingScheme, concurrency);
+        if (isBatchingScheme) {
+            ASLParallelFor(babies.size(), concurrency, [&](size_t index, seal::MemoryPoolHandle const &) {
+                evaluator.transform_to_ntt_inplace(babies[index]);
+            });
+        }
+        
+        // Giant steps: each group of babyStepCount diagonals is summed and rotated once. A
+        // group without diagonals leaves its partial empty; the workers only write their own
+        // element of partials, so no shared flags are needed.
+        std::vector<seal::Ciphertext> partials(giantStepCount);
+        ASLParallelFor(giantStepCount, concurrency, [&](size_t giant, seal::MemoryPoolHandle const &pool) {
+            seal::Ciphertext partial(pool);
+            seal::Ciphertext product(pool);
+            bool hasProduct = false;
+            for (size_t baby = 0; baby < babyStepCount; ++baby) {
+                size_t const k = giant * babyStepCount + baby;
+                if (k >= dimension || diagonals[k] == nullptr) {
+                    continue;
+                }
+                if (!hasProduct) {
+                    evaluator.multiply_plain(babies[baby], *diagonals[k], partial, pool);
+                    hasProduct = true;
+                } else {
+                    evaluator.multiply_plain(babies[baby], *diagonals[k], product, pool);
+                    evaluator.add_inplace(partial, product);
+                }
+            }
+            if (!hasProduct) {
+                return;
+            }
+            if (isBatchingScheme) {
+                evaluator.transform_from_ntt_inplace(partial);
+            }
+            int const steps = static_cast<int>(giant * babyStepCount);
+            if (steps != 0) {
+                if (isBatchingScheme) {
+                    evaluator.rotate_rows_inplace(partial, steps, sealGaloisKeys, pool);
+                } else {
+                    evaluator.rotate_vector_inplace(partial, steps, sealGaloisKeys, pool);
+                }
+            }
+            partials[giant] = std::move(partial);
+        });
+        
+        // The partials live in the worker pools, so the first one is copied into a destination
+        // from the global pool rather than moved.
+        seal::Ciphertext destination(seal::MemoryManager::GetPool());
+        bool hasDestination = false;
+        for (size_t giant = 0; giant < giantStepCount; ++giant) {
+            if (partials[giant].size() == 0) {
+                continue;
+            }
+            if (!hasDestination) {
+                destination = partials[giant];
+                hasDestination = true;
+            } else {
+                evaluator.add_inplace(destination, partials[giant]);
+            }
+        }
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1617,21 +5376,121 @@
     }
 }
 
--(ASLCipherText * _Nullable)applyGalois:(ASLCipherText *)encrypted
-                          galoisElement:(uint64_t)galoisElement
-                              galoisKey:(ASLGaloisKeys *)galoisKey
+#pragma mark - Slot Permutations
 
-                                   pool:(ASLMemoryPoolHandle *)pool
-                                  error:(NSError **)error {
+-(ASLCipherText * _Nullable)permuteSlots:(ASLCipherText *)encrypted
+                             permutation:(ASLSlotPermutation *)permutation
+                               galoisKey:(ASLGaloisKeys *)galoisKey
+                                   error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
+    NSParameterAssert(permutation != nil);
     NSParameterAssert(galoisKey != nil);
-    NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    std::vector<int> const &babySteps = [permutation babySteps];
+    std::vector<ASLSlotPermutationGroup> const &groups = [permutation groups];
+    seal::Ciphertext const &sealEncrypted = [encrypted sealCipherTextReference];
+    seal::GaloisKeys const &sealGaloisKeys = [galoisKey sealGaloisKeysReference];
+    bool const isBatchingScheme = [self isBatchingScheme];
+    size_t const concurrency = self.batchConcurrency;
+    seal::Evaluator &evaluator = *_evaluator;
+    
+    try {
+        std::vector<seal::Ciphertext> babies = ASLRotateBySteps(evaluator, sealEncrypted, babySteps, sealGaloisKeys, isBatchingScheme, concurrency);
+        if (isBatchingScheme) {
+            ASLParallelFor(babies.size(), concurrency, [&](size_t index, seal::MemoryPoolHandle const &) {
+                evaluator.transform_to_ntt_inplace(babies[index]);
+            });
+        }
+        
+        std::vector<seal::Ciphertext> partials(groups.size());
+        ASLParallelFor(groups.size(), concurrency, [&](size_t index, seal::MemoryPoolHandle const &pool) {
+            ASLSlotPermutationGroup const &group = groups[index];
+            seal::Ciphertext partial(pool);
+            seal::Ciphertext product(pool);
+            for (size_t term = 0; term < group.terms.size(); ++term) {
+                seal::Ciphertext &target = term == 0 ? partial : product;
+                evaluator.multiply_plain(babies[group.terms[term].first], group.terms[term].second, target, pool);
+                if (term != 0) {
+                    evaluator.add_inplace(partial, product);
+                }
+            }
+            if (isBatchingScheme) {
+                evaluator.transform_from_ntt_inplace(partial);
+            }
+            if (group.giantStep != 0) {
+                if (isBatchingScheme) {
+                    evaluator.rotate_rows_inplace(partial, group.giantStep, sealGaloisKeys, pool);
+                } else {
+                    evaluator.rotate_vector_inplace(partial, group.giantStep, sealGaloisKeys, pool);
+                }
+            }
+            partials[index] = std::move(partial);
+        });
+        
+        // Partials for slots that read from the other row are summed first and swapped once.
+        // The partials live in the worker pools, so they are copied into sums from the global
+        // pool rather than moved.
+        seal::Ciphertext sums[2] = {seal::Ciphertext(seal::MemoryManager::GetPool()), seal::Ciphertext(seal::MemoryManager::GetPool())};
+        bool hasSum[2] = {false, false};
+        for (size_t index = 0; index < groups.size(); ++index) {
+            size_t const side = groups[index].swapsRows ? 1 : 0;
+            if (!hasSum[side]) {
+                sums[side] = partials[index];
+                hasSum[side] = true;
+            } else {
+                evaluator.add_inplace(sums[side], partials[index]);
+            }
+        }
+        if (hasSum[1]) {
+            evaluator.rotate_columns_inplace(sums[1], sealGaloisKeys);
+            if (hasSum[0]) {
+                evaluator.add_inplace(sums[0], sums[1]);
+            } else {
+                sums[0] = std::move(sums[1]);
+            }
+        }
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(sums[0])]);
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+#pragma mark - Polynomial Evaluation
+
+-(ASLCipherText * _Nullable)evaluatePolynomial:(ASLCipherText *)encrypted
+                                  coefficients:(NSArray<NSNumber *> *)coefficients
+                           relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                         error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(coefficients != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    std::vector<double> sealCoefficients;
+    sealCoefficients.reserve(coefficients.count);
+    for (NSNumber * const coefficient in coefficients) {
+        sealCoefficients.push_back(coefficient.doubleValue);
+    }
+    
     try {
-        _evaluator->apply_galois(sealEncrypted, static_cast<std::uint32_t>(galoisElement), galoisKey.sealGaloisKeys, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        seal::CKKSEncoder encoder(_context);
+        ASLPolynomialEvaluator polynomialEvaluator(*_evaluator,
+                                                   _context,
+                                                   encoder,
+                                                   [relinearizationKeys sealRelinKeysReference],
+                                                   sealCoefficients,
+                                                   seal::MemoryManager::GetPool());
+        seal::Ciphertext destination = polynomialEvaluator.evaluate([encrypted sealCipherTextReference]);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1645,19 +5504,74 @@
     }
 }
 
--(ASLCipherText * _Nullable)applyGalois:(ASLCipherText *)encrypted
-                          galoisElement:(uint64_t)galoisElement
-                              galoisKey:(ASLGaloisKeys *)galoisKey
+#pragma mark - Comparisons
 
-                                  error:(NSError **)error {
+-(ASLCipherText * _Nullable)sign:(ASLCipherText *)encrypted
+                   approximation:(ASLSignApproximation *)approximation
+             relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                           error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    return scope.complete([self sign:encrypted approximation:approximation factor:1.0 offset:0.0 relinearizationKeys:relinearizationKeys error:error]);
+}
+
+-(ASLCipherText * _Nullable)step:(ASLCipherText *)encrypted
+                   approximation:(ASLSignApproximation *)approximation
+             relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                           error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    return scope.complete([self sign:encrypted approximation:approximation factor:0.5 offset:0.5 relinearizationKeys:relinearizationKeys error:error]);
+}
+
+-(ASLCipherText * _Nullable)max:(ASLCipherText *)encrypted1
+                           with:(ASLCipherText *)encrypted2
+                  approximation:(ASLSignApproximation *)approximation
+            relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                          error:(NSError **)error {
+    NSParameterAssert(encrypted2 != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    return scope.complete([self select:encrypted1 with:encrypted2 maximum:YES approximation:approximation relinearizationKeys:relinearizationKeys error:error]);
+}
+
+-(ASLCipherText * _Nullable)min:(ASLCipherText *)encrypted1
+                           with:(ASLCipherText *)encrypted2
+                  approximation:(ASLSignApproximation *)approximation
+            relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                          error:(NSError **)error {
+    NSParameterAssert(encrypted2 != nil);
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
+    return scope.complete([self select:encrypted1 with:encrypted2 maximum:NO approximation:approximation relinearizationKeys:relinearizationKeys error:error]);
+}
+
+-(ASLCipherText * _Nullable)relu:(ASLCipherText *)encrypted
+                   approximation:(ASLSignApproximation *)approximation
+             relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                           error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    return scope.complete([self select:encrypted with:nil maximum:YES approximation:approximation relinearizationKeys:relinearizationKeys error:error]);
+}
+
+-(ASLCipherText * _Nullable)sign:(ASLCipherText *)encrypted
+                   approximation:(ASLSignApproximation *)approximation
+                          factor:(double)factor
+                          offset:(double)offset
+             relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                           error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(approximation != nil);
+    NSParameterAssert(relinearizationKeys != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
     try {
-        _evaluator->apply_galois(sealEncrypted, static_cast<std::uint32_t>(galoisElement), galoisKey.sealGaloisKeys, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        seal::CKKSEncoder encoder(_context);
+        seal::Ciphertext destination = ASLEvaluateSign(*_evaluator,
+                                                       _context,
+                                                       encoder,
+                                                       [relinearizationKeys sealRelinKeysReference],
+                                                       [encrypted sealCipherTextReference],
+                                                       [approximation polynomials],
+                                                       factor,
+                                                       offset,
+                                                       seal::MemoryManager::GetPool());
+        return [[ASLCipherText alloc] initWithCipherText:std::move(destination)];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1671,19 +5585,26 @@
     }
 }
 
--(ASLCipherText *)rotateRowsInplace:(ASLCipherText *)encrypted
-                              steps:(int)steps
-                          galoisKey:(ASLGaloisKeys *)galoisKey
-                               pool:(ASLMemoryPoolHandle *)pool
-                              error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
-    NSParameterAssert(pool != nil);
+-(ASLCipherText * _Nullable)select:(ASLCipherText *)encrypted1
+                              with:(ASLCipherText * _Nullable)encrypted2
+                           maximum:(BOOL)maximum
+                     approximation:(ASLSignApproximation *)approximation
+               relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                             error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(approximation != nil);
+    NSParameterAssert(relinearizationKeys != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
     try {
-        _evaluator->rotate_rows_inplace(sealEncrypted, steps, galoisKey.sealGaloisKeys, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        seal::Ciphertext destination = ASLSelectByComparison(*_evaluator,
+                                                             _context,
+                                                             [relinearizationKeys sealRelinKeysReference],
+                                                             [encrypted1 sealCipherTextReference],
+                                                             encrypted2 != nil ? &[encrypted2 sealCipherTextReference] : nullptr,
+                                                             [approximation polynomials],
+                                                             maximum,
+                                                             seal::MemoryManager::GetPool());
+        return [[ASLCipherText alloc] initWithCipherText:std::move(destination)];
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1697,17 +5618,25 @@
     }
 }
 
--(ASLCipherText *)rotateRowsInplace:(ASLCipherText *)encrypted
-                              steps:(int)steps
-                          galoisKey:(ASLGaloisKeys *)galoisKey
+#pragma mark - Equality Tests
+
+-(ASLCipherText * _Nullable)isEqual:(ASLCipherText *)encrypted1
+                                 to:(ASLCipherText *)encrypted2
+                relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
                               error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
+    NSParameterAssert(relinearizationKeys != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted1);
     try {
-        _evaluator->rotate_rows_inplace(sealEncrypted, steps, galoisKey.sealGaloisKeys);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        seal::Ciphertext destination = ASLEqualityIndicator(*_evaluator,
+                                                            _context,
+                                                            [encrypted1 sealCipherTextReference],
+                                                            [encrypted2 sealCipherTextReference],
+                                                            [relinearizationKeys sealRelinKeysReference],
+                                                            seal::MemoryManager::GetPool());
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1721,21 +5650,48 @@
     }
 }
 
--(ASLCipherText * _Nullable)rotateRows:(ASLCipherText *)encrypted
-                                 steps:(int)steps
-                             galoisKey:(ASLGaloisKeys *)galoisKey
-
-                                  pool:(ASLMemoryPoolHandle *)pool
-                                 error:(NSError **)error {
+-(ASLCipherText * _Nullable)isMember:(ASLCipherText *)encrypted
+                               ofSet:(NSArray<ASLCipherText *> *)encrypteds
+                 relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                               error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
-    NSParameterAssert(pool != nil);
+    NSParameterAssert(encrypteds != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext const &sealEncrypted = [encrypted sealCipherTextReference];
+    std::vector<seal::Ciphertext const *> const references = ASLCipherTextReferences(encrypteds);
+    seal::RelinKeys const &sealRelinKeys = [relinearizationKeys sealRelinKeysReference];
+    std::shared_ptr<seal::SEALContext> const context = _context;
+    seal::Evaluator &evaluator = *_evaluator;
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
     try {
-        _evaluator->rotate_rows(sealEncrypted, steps, galoisKey.sealGaloisKeys, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        if (references.empty()) {
+            throw std::invalid_argument("encrypteds cannot be empty");
+        }
+        if (context->key_context_data()->parms().scheme() != seal::scheme_type::BFV) {
+            throw std::logic_error("unsupported scheme");
+        }
+        
+        // A slot is a member when some difference is 0, that is when the product of the
+        // differences is 0. The product is nonzero exactly where every difference is, so one
+        // exponentiation of it replaces an equality test per member, and duplicate members are
+        // counted once.
+        std::vector<seal::Ciphertext> differences(references.size());
+        std::vector<seal::Ciphertext const *> differenceReferences(references.size());
+        for (size_t index = 0; index < references.size(); ++index) {
+            evaluator.sub(sealEncrypted, *references[index], differences[index]);
+            differenceReferences[index] = &differences[index];
+        }
+        
+        seal::MemoryPoolHandle const pool = seal::MemoryManager::GetPool();
+        seal::Ciphertext destination(pool);
+        ASLMultiplyMany(evaluator, context, differenceReferences, sealRelinKeys, self.batchConcurrency, seal::MemoryPoolHandle(), destination);
+        std::uint64_t const plainModulus = context->first_context_data()->parms().plain_modulus().value();
+        ASLExponentiateInplace(evaluator, context, destination, plainModulus - 1, sealRelinKeys, pool);
+        evaluator.negate_inplace(destination);
+        evaluator.add_plain_inplace(destination, seal::Plaintext("1", pool));
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1749,19 +5705,18 @@
     }
 }
 
--(ASLCipherText * _Nullable)rotateRows:(ASLCipherText *)encrypted
-                                 steps:(int)steps
-                             galoisKey:(ASLGaloisKeys *)galoisKey
+#pragma mark - Scalar Operations
 
-                                 error:(NSError **)error {
+-(ASLCipherText * _Nullable)multiplyScalarInplace:(ASLCipherText *)encrypted
+                                     integerValue:(int64_t)value
+                                            error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
-        _evaluator->rotate_rows(sealEncrypted, steps, galoisKey.sealGaloisKeys, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        ASLMultiplyIntegerInplace(_context, sealEncrypted, value);
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1775,17 +5730,16 @@
     }
 }
 
--(ASLCipherText *)rotateColumnsInplace:(ASLCipherText *)encrypted
-                             galoisKey:(ASLGaloisKeys *)galoisKey
-                                  pool:(ASLMemoryPoolHandle *)pool
-                                 error:(NSError **)error {
+-(ASLCipherText * _Nullable)multiplyScalar:(ASLCipherText *)encrypted
+                              integerValue:(int64_t)value
+                                     error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = encrypted.sealCipherText;
     try {
-        _evaluator->rotate_columns_inplace(sealEncrypted, galoisKey.sealGaloisKeys, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        ASLMultiplyIntegerInplace(_context, destination, value);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1799,16 +5753,16 @@
     }
 }
 
--(ASLCipherText *)rotateColumnsInplace:(ASLCipherText *)encrypted
-                             galoisKey:(ASLGaloisKeys *)galoisKey
-                                 error:(NSError **)error {
+-(ASLCipherText * _Nullable)addScalarInplace:(ASLCipherText *)encrypted
+                                integerValue:(int64_t)value
+                                       error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
-        _evaluator->rotate_columns_inplace(sealEncrypted, galoisKey.sealGaloisKeys);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        ASLAddIntegerInplace(*_evaluator, _context, sealEncrypted, value, seal::MemoryManager::GetPool());
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1822,20 +5776,16 @@
     }
 }
 
--(ASLCipherText * _Nullable)rotateColumns:(ASLCipherText *)encrypted
-                                galoisKey:(ASLGaloisKeys *)galoisKey
-
-                                     pool:(ASLMemoryPoolHandle *)pool
-                                    error:(NSError **)error {
+-(ASLCipherText * _Nullable)addScalar:(ASLCipherText *)encrypted
+                         integerValue:(int64_t)value
+                                error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
-    NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = encrypted.sealCipherText;
     try {
-        _evaluator->rotate_columns(sealEncrypted, galoisKey.sealGaloisKeys, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        ASLAddIntegerInplace(*_evaluator, _context, destination, value, seal::MemoryManager::GetPool());
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1849,18 +5799,17 @@
     }
 }
 
--(ASLCipherText * _Nullable)rotateColumns:(ASLCipherText *)encrypted
-                                galoisKey:(ASLGaloisKeys *)galoisKey
-
-                                    error:(NSError **)error {
+-(ASLCipherText * _Nullable)multiplyScalarInplace:(ASLCipherText *)encrypted
+                                      doubleValue:(double)value
+                                            scale:(double)scale
+                                            error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
-        _evaluator->rotate_columns(sealEncrypted, galoisKey.sealGaloisKeys, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        ASLMultiplyRealInplace(_context, sealEncrypted, value, scale);
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1874,19 +5823,17 @@
     }
 }
 
--(ASLCipherText *)rotateVectorInplace:(ASLCipherText *)encrypted
-                                steps:(int)steps
-                            galoisKey:(ASLGaloisKeys *)galoisKey
-                                 pool:(ASLMemoryPoolHandle *)pool
-                                error:(NSError **)error {
+-(ASLCipherText * _Nullable)multiplyScalar:(ASLCipherText *)encrypted
+                               doubleValue:(double)value
+                                     scale:(double)scale
+                                     error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
-    NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = encrypted.sealCipherText;
     try {
-        _evaluator->rotate_vector_inplace(sealEncrypted, steps, galoisKey.sealGaloisKeys, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        ASLMultiplyRealInplace(_context, destination, value, scale);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1900,17 +5847,16 @@
     }
 }
 
--(ASLCipherText *)rotateVectorInplace:(ASLCipherText *)encrypted
-                                steps:(int)steps
-                            galoisKey:(ASLGaloisKeys *)galoisKey
-                                error:(NSError **)error {
+-(ASLCipherText * _Nullable)addScalarInplace:(ASLCipherText *)encrypted
+                                 doubleValue:(double)value
+                                       error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext &sealEncrypted = [encrypted mutableSealCipherText];
     try {
-        _evaluator->rotate_vector_inplace(sealEncrypted, steps, galoisKey.sealGaloisKeys);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        ASLAddRealInplace(_context, sealEncrypted, value);
+        return scope.complete(encrypted);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1924,21 +5870,16 @@
     }
 }
 
--(ASLCipherText * _Nullable)rotateVector:(ASLCipherText *)encrypted
-                                   steps:(int)steps
-                               galoisKey:(ASLGaloisKeys *)galoisKey
-
-                                    pool:(ASLMemoryPoolHandle *)pool
-                                   error:(NSError **)error {
+-(ASLCipherText * _Nullable)addScalar:(ASLCipherText *)encrypted
+                          doubleValue:(double)value
+                                error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
-    NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    seal::Ciphertext destination = encrypted.sealCipherText;
     try {
-        _evaluator->rotate_vector(sealEncrypted, steps, galoisKey.sealGaloisKeys, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        ASLAddRealInplace(_context, destination, value);
+        return scope.complete([[ASLCipherText alloc] initWithCipherText:std::move(destination)]);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1952,19 +5893,46 @@
     }
 }
 
--(ASLCipherText * _Nullable)rotateVector:(ASLCipherText *)encrypted
-                                   steps:(int)steps
-                               galoisKey:(ASLGaloisKeys *)galoisKey
+#pragma mark - Multi-step Rotations
 
-                                   error:(NSError **)error {
+-(NSArray<ASLCipherText *> * _Nullable)rotateRows:(ASLCipherText *)encrypted
+                                          bySteps:(NSArray<NSNumber *> *)steps
+                                        galoisKey:(ASLGaloisKeys *)galoisKey
+                                            error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    return scope.complete([self rotate:encrypted bySteps:steps galoisKey:galoisKey rotateRows:YES error:error]);
+}
+
+-(NSArray<ASLCipherText *> * _Nullable)rotateVector:(ASLCipherText *)encrypted
+                                            bySteps:(NSArray<NSNumber *> *)steps
+                                          galoisKey:(ASLGaloisKeys *)galoisKey
+                                              error:(NSError **)error {
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypted);
+    return scope.complete([self rotate:encrypted bySteps:steps galoisKey:galoisKey rotateRows:NO error:error]);
+}
+
+-(NSArray<ASLCipherText *> * _Nullable)rotate:(ASLCipherText *)encrypted
+                                      bySteps:(NSArray<NSNumber *> *)steps
+                                    galoisKey:(ASLGaloisKeys *)galoisKey
+                                   rotateRows:(BOOL)rotateRows
+                                        error:(NSError **)error {
     NSParameterAssert(encrypted != nil);
+    NSParameterAssert(steps != nil);
     NSParameterAssert(galoisKey != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    std::vector<int> sealSteps;
+    sealSteps.reserve(steps.count);
+    for (NSNumber * const step in steps) {
+        sealSteps.push_back(step.intValue);
+    }
     try {
-        _evaluator->rotate_vector(sealEncrypted, steps, galoisKey.sealGaloisKeys, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        std::vector<seal::Ciphertext> destinations = ASLRotateBySteps(*_evaluator,
+                                                                      [encrypted sealCipherTextReference],
+                                                                      sealSteps,
+                                                                      [galoisKey sealGaloisKeysReference],
+                                                                      rotateRows,
+                                                                      self.batchConcurrency);
+        return ASLCipherTextArray(destinations);
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -1978,18 +5946,29 @@
     }
 }
 
--(ASLCipherText *)complexConjugateInplace:(ASLCipherText *)encrypted
-                                galoisKey:(ASLGaloisKeys *)galoisKey
-                                     pool:(ASLMemoryPoolHandle *)pool
-                                    error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
-    NSParameterAssert(pool != nil);
+#pragma mark - Batch Operations
+
+-(NSArray<ASLCipherText *> * _Nullable)addBatch:(NSArray<ASLCipherText *> *)encrypteds1
+                                     encrypted2:(NSArray<ASLCipherText *> *)encrypteds2
+                                          error:(NSError **)error {
+    NSParameterAssert(encrypteds1 != nil);
+    NSParameterAssert(encrypteds2 != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds1);
+    std::vector<seal::Ciphertext const *> const sealEncrypteds1 = ASLCipherTextReferences(encrypteds1);
+    std::vector<seal::Ciphertext const *> const sealEncrypteds2 = ASLCipherTextReferences(encrypteds2);
+    std::vector<seal::Ciphertext> destinations(sealEncrypteds1.size());
+    seal::Evaluator * const evaluator = _evaluator;
+    seal::MemoryPoolHandle const outputPool = seal::MemoryManager::GetPool();
     try {
-        _evaluator->complex_conjugate_inplace(sealEncrypted, galoisKey.sealGaloisKeys, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        if (sealEncrypteds1.size() != sealEncrypteds2.size()) {
+            throw std::invalid_argument("encrypteds1 and encrypteds2 must have the same count");
+        }
+        ASLParallelFor(destinations.size(), self.batchConcurrency, [&](size_t index, seal::MemoryPoolHandle const &pool) {
+            destinations[index] = seal::Ciphertext(outputPool);
+            evaluator->add(*sealEncrypteds1[index], *sealEncrypteds2[index], destinations[index]);
+        });
+        return scope.complete(ASLCipherTextArray(destinations));
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -2003,16 +5982,33 @@
     }
 }
 
--(ASLCipherText *)complexConjugateInplace:(ASLCipherText *)encrypted
-                                galoisKey:(ASLGaloisKeys *)galoisKey
-                                    error:(NSError **)error {
-    NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
+-(NSArray<ASLCipherText *> * _Nullable)multiplyPlainBatch:(NSArray<ASLCipherText *> *)encrypteds
+                                                   plains:(NSArray<ASLPlainText *> *)plains
+                                                    error:(NSError **)error {
+    NSParameterAssert(encrypteds != nil);
+    NSParameterAssert(plains != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds);
+    std::vector<seal::Ciphertext const *> const sealEncrypteds = ASLCipherTextReferences(encrypteds);
+    std::vector<seal::Plaintext const *> sealPlains;
+    sealPlains.reserve(plains.count);
+    for (ASLPlainText * const plain in plains) {
+        sealPlains.push_back(&[plain sealPlainTextReference]);
+    }
+    std::vector<seal::Ciphertext> destinations(sealEncrypteds.size());
+    seal::Evaluator * const evaluator = _evaluator;
+    seal::MemoryPoolHandle const outputPool = seal::MemoryManager::GetPool();
     try {
-        _evaluator->complex_conjugate_inplace(sealEncrypted, galoisKey.sealGaloisKeys);
-        return [[ASLCipherText alloc] initWithCipherText:sealEncrypted];
+        if (sealPlains.size() != 1 && sealPlains.size() != sealEncrypteds.size()) {
+            throw std::invalid_argument("plains must contain one plaintext or one per ciphertext");
+        }
+        bool const broadcast = sealPlains.size() == 1;
+        ASLParallelFor(destinations.size(), self.batchConcurrency, [&](size_t index, seal::MemoryPoolHandle const &pool) {
+            destinations[index] = seal::Ciphertext(outputPool);
+            seal::Plaintext const &plain = *sealPlains[broadcast ? 0 : index];
+            evaluator->multiply_plain(*sealEncrypteds[index], plain, destinations[index], pool);
+        });
+        return scope.complete(ASLCipherTextArray(destinations));
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -2026,20 +6022,30 @@
     }
 }
 
--(ASLCipherText * _Nullable)complexConjugate:(ASLCipherText *)encrypted
-                                   galoisKey:(ASLGaloisKeys *)galoisKey
-                                        pool:(ASLMemoryPoolHandle *)pool
-                                       error:(NSError **)error {
-    
-    NSParameterAssert(encrypted != nil);
+-(NSArray<ASLCipherText *> * _Nullable)rotateBatch:(NSArray<ASLCipherText *> *)encrypteds
+                                             steps:(int)steps
+                                         galoisKey:(ASLGaloisKeys *)galoisKey
+                                             error:(NSError **)error {
+    NSParameterAssert(encrypteds != nil);
     NSParameterAssert(galoisKey != nil);
-    NSParameterAssert(pool != nil);
     
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds);
+    std::vector<seal::Ciphertext const *> const sealEncrypteds = ASLCipherTextReferences(encrypteds);
+    seal::GaloisKeys const &sealGaloisKeys = [galoisKey sealGaloisKeysReference];
+    std::vector<seal::Ciphertext> destinations(sealEncrypteds.size());
+    seal::Evaluator * const evaluator = _evaluator;
+    seal::MemoryPoolHandle const outputPool = seal::MemoryManager::GetPool();
+    bool const isCKKS = _context->key_context_data()->parms().scheme() == seal::scheme_type::CKKS;
     try {
-        _evaluator->complex_conjugate(sealEncrypted, galoisKey.sealGaloisKeys, destination, pool.memoryPoolHandle);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        ASLParallelFor(destinations.size(), self.batchConcurrency, [&](size_t index, seal::MemoryPoolHandle const &pool) {
+            destinations[index] = seal::Ciphertext(outputPool);
+            if (isCKKS) {
+                evaluator->rotate_vector(*sealEncrypteds[index], steps, sealGaloisKeys, destinations[index], pool);
+            } else {
+                evaluator->rotate_rows(*sealEncrypteds[index], steps, sealGaloisKeys, destinations[index], pool);
+            }
+        });
+        return scope.complete(ASLCipherTextArray(destinations));
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -2053,19 +6059,24 @@
     }
 }
 
--(ASLCipherText * _Nullable)complexConjugate:(ASLCipherText *)encrypted
-                                   galoisKey:(ASLGaloisKeys *)galoisKey
-                                       error:(NSError **)error {
-    
-    NSParameterAssert(encrypted != nil);
-    NSParameterAssert(galoisKey != nil);
-    
-    seal::Ciphertext sealEncrypted = encrypted.sealCipherText;
-    seal::Ciphertext destination = seal::Ciphertext();
+-(NSArray<ASLCipherText *> * _Nullable)relinearizeBatch:(NSArray<ASLCipherText *> *)encrypteds
+                                    relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                                  error:(NSError **)error {
+    NSParameterAssert(encrypteds != nil);
+    NSParameterAssert(relinearizationKeys != nil);
     
+    ASLInstrumentationScope scope(_instrumentation, self, _cmd, encrypteds);
+    std::vector<seal::Ciphertext const *> const sealEncrypteds = ASLCipherTextReferences(encrypteds);
+    seal::RelinKeys const &sealRelinKeys = [relinearizationKeys sealRelinKeysReference];
+    std::vector<seal::Ciphertext> destinations(sealEncrypteds.size());
+    seal::Evaluator * const evaluator = _evaluator;
+    seal::MemoryPoolHandle const outputPool = seal::MemoryManager::GetPool();
     try {
-        _evaluator->complex_conjugate(sealEncrypted, galoisKey.sealGaloisKeys, destination);
-        return [[ASLCipherText alloc] initWithCipherText:destination];
+        ASLParallelFor(destinations.size(), self.batchConcurrency, [&](size_t index, seal::MemoryPoolHandle const &pool) {
+            destinations[index] = seal::Ciphertext(outputPool);
+            evaluator->relinearize(*sealEncrypteds[index], sealRelinKeys, destinations[index], pool);
+        });
+        return scope.complete(ASLCipherTextArray(destinations));
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
             *error = [NSError ASL_SealInvalidParameter:e];
@@ -2079,4 +6090,176 @@
     }
 }
 
+#pragma mark - Asynchronous Operations
+
+-(ASLEvaluationTask * _Nullable)submitWithPriority:(ASLEvaluationPriority)priority
+                                         operation:(ASLCipherText * _Nullable (^)(ASLEvaluator *evaluator, NSError **error))operation
+                                 completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                             error:(NSError **)error {
+    NSParameterAssert(operation != nil);
+    NSParameterAssert(completionHandler != nil);
+    
+    ASLEvaluationQueue * const queue = self.evaluationQueue ?: ASLEvaluationQueue.defaultQueue;
+    return [queue submitWithPriority:priority block:^(ASLEvaluationTask *task) {
+        NSError *operationError = nil;
+        ASLCipherText * const result = operation(self, &operationError);
+        // A task cancelled while the operation ran has already reported the cancellation.
+        if ([task markFinished]) {
+            completionHandler(result, result == nil ? operationError : nil);
+        }
+    } cancellationHandler:^{
+        completionHandler(nil, ASLEvaluationCancelledError());
+    } error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)negate:(ASLCipherText *)encrypted
+                              priority:(ASLEvaluationPriority)priority
+                     completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                 error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator negate:encrypted error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)add:(ASLCipherText *)encrypted1
+                         encrypted2:(ASLCipherText *)encrypted2
+                           priority:(ASLEvaluationPriority)priority
+                  completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                              error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator add:encrypted1 encrypted2:encrypted2 error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)sub:(ASLCipherText *)encrypted1
+                         encrypted2:(ASLCipherText *)encrypted2
+                           priority:(ASLEvaluationPriority)priority
+                  completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                              error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator sub:encrypted1 encrypted2:encrypted2 error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)multiply:(ASLCipherText *)encrypted1
+                              encrypted2:(ASLCipherText *)encrypted2
+                                priority:(ASLEvaluationPriority)priority
+                       completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                   error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator multiply:encrypted1 encrypted2:encrypted2 error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)square:(ASLCipherText *)encrypted
+                              priority:(ASLEvaluationPriority)priority
+                     completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                 error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator square:encrypted error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)addPlain:(ASLCipherText *)encrypted
+                                   plain:(ASLPlainText *)plain
+                                priority:(ASLEvaluationPriority)priority
+                       completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                   error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator addPlain:encrypted plain:plain error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)multiplyPlain:(ASLCipherText *)encrypted
+                                        plain:(ASLPlainText *)plain
+                                     priority:(ASLEvaluationPriority)priority
+                            completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                        error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(plain != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator multiplyPlain:encrypted plain:plain error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)relinearize:(ASLCipherText *)encrypted
+                        relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                   priority:(ASLEvaluationPriority)priority
+                          completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                      error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(relinearizationKeys != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator relinearize:encrypted relinearizationKeys:relinearizationKeys error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)modSwitchToNext:(ASLCipherText *)encrypted
+                                       priority:(ASLEvaluationPriority)priority
+                              completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                          error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator modSwitchToNext:encrypted error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)rescaleToNext:(ASLCipherText *)encrypted
+                                     priority:(ASLEvaluationPriority)priority
+                            completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                        error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator rescaleToNext:encrypted error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)rotateRows:(ASLCipherText *)encrypted
+                                     steps:(int)steps
+                                 galoisKey:(ASLGaloisKeys *)galoisKey
+                                  priority:(ASLEvaluationPriority)priority
+                         completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                     error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator rotateRows:encrypted steps:steps galoisKey:galoisKey error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
+-(ASLEvaluationTask * _Nullable)rotateVector:(ASLCipherText *)encrypted
+                                       steps:(int)steps
+                                   galoisKey:(ASLGaloisKeys *)galoisKey
+                                    priority:(ASLEvaluationPriority)priority
+                           completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                       error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    NSParameterAssert(galoisKey != nil);
+    
+    return [self submitWithPriority:priority operation:^ASLCipherText *(ASLEvaluator *evaluator, NSError **operationError) {
+        return [evaluator rotateVector:encrypted steps:steps galoisKey:galoisKey error:operationError];
+    } completionHandler:completionHandler error:error];
+}
+
 @end
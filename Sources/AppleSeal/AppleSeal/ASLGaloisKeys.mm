@@ -99,6 +99,10 @@
     return _galoisKeys;
 }
 
+- (seal::GaloisKeys const &)sealGaloisKeysReference {
+    return _galoisKeys;
+}
+
 - (instancetype)initWithGaloisKeys:(seal::GaloisKeys)sealGaloisKeys {
     self = [super initWithKSwitchKeys:sealGaloisKeys];
        if (self == nil) {
@@ -0,0 +1,464 @@
+//
+//  ASLInstrumentation.mm
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLInstrumentation.h"
+#import "ASLInstrumentation_Internal.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <objc/runtime.h>
+#include <vector>
+#include "seal/context.h"
+
+#import "ASLSealContext_Internal.h"
+#import "ASLCipherText_Internal.h"
+#import "ASLPlainText_Internal.h"
+
+/// Latency bucket i counts calls of [2^i, 2^(i + 1)) nanoseconds; the last bucket also counts
+/// everything slower, about nine minutes and up.
+static constexpr size_t ASLLatencyBucketCount = 40;
+
+/// The number of distinct class and operation pairs an instrumentation can record.
+static constexpr size_t ASLOperationCapacity = 1024;
+
+/// Adds value to a counter. The counters publish nothing else, so relaxed ordering suffices.
+static inline void ASLIncrement(std::atomic<uint64_t> &counter, uint64_t value) {
+    counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+static inline size_t ASLLatencyBucket(uint64_t nanoseconds) {
+    if (nanoseconds == 0) {
+        return 0;
+    }
+    return std::min<size_t>(63 - __builtin_clzll(nanoseconds), ASLLatencyBucketCount - 1);
+}
+
+/// The counters of one operation at one input level. Output levels are indexed like input
+/// levels, with the last entry for outputs that have no level.
+struct ASLLevelCounters {
+    explicit ASLLevelCounters(size_t levelCount)
+    : outputLevels(new std::atomic<uint64_t>[levelCount + 1]), outputLevelCount(levelCount + 1) {
+        reset();
+    }
+
+    void reset() {
+        for (std::atomic<uint64_t> *counter : {&calls, &failures, &totalNanoseconds, &maximumNanoseconds, &inputSizeTotal, &outputSizeTotal}) {
+            counter->store(0, std::memory_order_relaxed);
+        }
+        for (std::atomic<uint64_t> &bucket : latencyBuckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        for (size_t level = 0; level < outputLevelCount; ++level) {
+            outputLevels[level].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> failures;
+    std::atomic<uint64_t> totalNanoseconds;
+    std::atomic<uint64_t> maximumNanoseconds;
+    std::atomic<uint64_t> inputSizeTotal;
+    std::atomic<uint64_t> outputSizeTotal;
+    std::array<std::atomic<uint64_t>, ASLLatencyBucketCount> latencyBuckets;
+    std::unique_ptr<std::atomic<uint64_t>[]> outputLevels;
+    size_t const outputLevelCount;
+};
+
+/// The counters of one method of one class, for every input level.
+struct ASLOperationRecord {
+    ASLOperationRecord(Class owner, SEL operation, size_t levelCount) : owner(owner), operation(operation) {
+        levels.reserve(levelCount + 1);
+        for (size_t level = 0; level <= levelCount; ++level) {
+            levels.push_back(std::make_unique<ASLLevelCounters>(levelCount));
+        }
+    }
+
+    __unsafe_unretained Class const owner;
+    SEL const operation;
+    std::vector<std::unique_ptr<ASLLevelCounters>> levels;
+};
+
+/// A fixed open-addressing table of operation records. A record is allocated the first time its
+/// operation is seen and published with a compare-and-swap, so recording never takes a lock and,
+/// after the first call of each operation, never allocates.
+class ASLInstrumentationRecorder {
+public:
+    explicit ASLInstrumentationRecorder(std::shared_ptr<seal::SEALContext> context) : _context(std::move(context)) {
+        std::shared_ptr<const seal::SEALContext::ContextData> const keyContextData = _context->key_context_data();
+        _levelCount = keyContextData->chain_index() + 1;
+        _parametersIds.resize(_levelCount);
+        for (std::shared_ptr<const seal::SEALContext::ContextData> contextData = keyContextData; contextData; contextData = contextData->next_context_data()) {
+            _parametersIds[contextData->chain_index()] = contextData->parms_id();
+        }
+        for (std::atomic<ASLOperationRecord *> &slot : _slots) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+        _enabled.store(true, std::memory_order_relaxed);
+    }
+
+    ~ASLInstrumentationRecorder() {
+        for (std::atomic<ASLOperationRecord *> &slot : _slots) {
+            delete slot.load(std::memory_order_acquire);
+        }
+    }
+
+    bool enabled() const {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void setEnabled(bool enabled) {
+        _enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    /// The number of levels in the context; this is also the index used for inputs without a level.
+    size_t levelCount() const {
+        return _levelCount;
+    }
+
+    size_t levelIndex(seal::parms_id_type const &parmsId) const {
+        std::shared_ptr<const seal::SEALContext::ContextData> const contextData = _context->get_context_data(parmsId);
+        return contextData ? contextData->chain_index() : _levelCount;
+    }
+
+    seal::parms_id_type parametersId(size_t level) const {
+        return level < _levelCount ? _parametersIds[level] : seal::parms_id_zero;
+    }
+
+    void record(Class owner, SEL operation, size_t inputLevel, size_t inputSize,
+                bool completed, size_t outputLevel, size_t outputSize, uint64_t nanoseconds) {
+        ASLOperationRecord * const record = find(owner, operation);
+        if (record == nullptr) {
+            return;
+        }
+        ASLLevelCounters &counters = *record->levels[inputLevel];
+        ASLIncrement(counters.calls, 1);
+        ASLIncrement(counters.totalNanoseconds, nanoseconds);
+        ASLIncrement(counters.inputSizeTotal, inputSize);
+        ASLIncrement(counters.latencyBuckets[ASLLatencyBucket(nanoseconds)], 1);
+        uint64_t maximum = counters.maximumNanoseconds.load(std::memory_order_relaxed);
+        while (nanoseconds > maximum && !counters.maximumNanoseconds.compare_exchange_weak(maximum, nanoseconds, std::memory_order_relaxed)) {
+        }
+        if (completed) {
+            ASLIncrement(counters.outputSizeTotal, outputSize);
+            ASLIncrement(counters.outputLevels[outputLevel], 1);
+        } else {
+            ASLIncrement(counters.failures, 1);
+        }
+    }
+
+    template <typename Visitor>
+    void forEachRecord(Visitor visit) const {
+        for (std::atomic<ASLOperationRecord *> const &slot : _slots) {
+            ASLOperationRecord const * const record = slot.load(std::memory_order_acquire);
+            if (record != nullptr) {
+                visit(*record);
+            }
+        }
+    }
+
+    void reset() {
+        forEachRecord([](ASLOperationRecord const &record) {
+            for (std::unique_ptr<ASLLevelCounters> const &counters : record.levels) {
+                counters->reset();
+            }
+        });
+    }
+
+private:
+    ASLOperationRecord *find(Class owner, SEL operation) {
+        size_t const hash = std::hash<void const *>()((__bridge void const *)owner) * 31 + std::hash<void const *>()(operation);
+        for (size_t probe = 0; probe < ASLOperationCapacity; ++probe) {
+            std::atomic<ASLOperationRecord *> &slot = _slots[(hash + probe) % ASLOperationCapacity];
+            ASLOperationRecord *record = slot.load(std::memory_order_acquire);
+            if (record == nullptr) {
+                std::unique_ptr<ASLOperationRecord> created(new ASLOperationRecord(owner, operation, _levelCount));
+                if (slot.compare_exchange_strong(record, created.get(), std::memory_order_acq_rel)) {
+                    return created.release();
+                }
+                // Another thread filled the slot first; record now holds its entry.
+            }
+            if (record->owner == owner && record->operation == operation) {
+                return record;
+            }
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<seal::SEALContext> _context;
+    size_t _levelCount = 0;
+    std::vector<seal::parms_id_type> _parametersIds;
+    std::array<std::atomic<ASLOperationRecord *>, ASLOperationCapacity> _slots;
+    std::atomic<bool> _enabled;
+};
+
+#pragma mark - ASLInstrumentationScope
+
+ASLInstrumentationScope::ASLInstrumentationScope(ASLInstrumentation *instrumentation, id owner, SEL operation)
+: _owner(Nil), _operation(operation) {
+    if (instrumentation == nil) {
+        return;
+    }
+    std::shared_ptr<ASLInstrumentationRecorder> recorder = [instrumentation recorder];
+    if (!recorder->enabled()) {
+        return;
+    }
+    _recorder = std::move(recorder);
+    _owner = object_getClass(owner);
+    _inputLevel = _recorder->levelCount();
+    _outputLevel = _recorder->levelCount();
+    _start = std::chrono::steady_clock::now();
+}
+
+ASLInstrumentationScope::ASLInstrumentationScope(ASLInstrumentation *instrumentation, id owner, SEL operation, ASLCipherText *input)
+: ASLInstrumentationScope(instrumentation, owner, operation) {
+    setInput(input);
+}
+
+ASLInstrumentationScope::ASLInstrumentationScope(ASLInstrumentation *instrumentation, id owner, SEL operation, ASLPlainText *input)
+: ASLInstrumentationScope(instrumentation, owner, operation) {
+    if (_recorder && input != nil) {
+        _inputLevel = _recorder->levelIndex([input sealPlainTextReference].parms_id());
+    }
+}
+
+ASLInstrumentationScope::ASLInstrumentationScope(ASLInstrumentation *instrumentation, id owner, SEL operation, NSArray<ASLCipherText *> *inputs)
+: ASLInstrumentationScope(instrumentation, owner, operation) {
+    setInput(inputs.firstObject);
+}
+
+ASLInstrumentationScope::~ASLInstrumentationScope() {
+    if (!_recorder) {
+        return;
+    }
+    std::chrono::nanoseconds const elapsed = std::chrono::steady_clock::now() - _start;
+    _recorder->record(_owner, _operation, _inputLevel, _inputSize, _completed, _outputLevel, _outputSize,
+                      static_cast<uint64_t>(elapsed.count()));
+}
+
+ASLCipherText *ASLInstrumentationScope::complete(ASLCipherText *output) {
+    if (_recorder && output != nil) {
+        setOutput(output);
+        _completed = true;
+    }
+    return output;
+}
+
+ASLPlainText *ASLInstrumentationScope::complete(ASLPlainText *output) {
+    if (_recorder && output != nil) {
+        _outputLevel = _recorder->levelIndex([output sealPlainTextReference].parms_id());
+        _completed = true;
+    }
+    return output;
+}
+
+NSArray<ASLCipherText *> *ASLInstrumentationScope::complete(NSArray<ASLCipherText *> *outputs) {
+    if (_recorder && outputs != nil) {
+        setOutput(outputs.firstObject);
+        _completed = true;
+    }
+    return outputs;
+}
+
+void ASLInstrumentationScope::complete() {
+    if (_recorder) {
+        _completed = true;
+    }
+}
+
+void ASLInstrumentationScope::setInput(ASLCipherText *input) {
+    if (_recorder && input != nil) {
+        seal::Ciphertext const &encrypted = [input sealCipherTextReference];
+        _inputLevel = _recorder->levelIndex(encrypted.parms_id());
+        _inputSize = encrypted.size();
+    }
+}
+
+void ASLInstrumentationScope::setOutput(ASLCipherText *output) {
+    if (output != nil) {
+        seal::Ciphertext const &encrypted = [output sealCipherTextReference];
+        _outputLevel = _recorder->levelIndex(encrypted.parms_id());
+        _outputSize = encrypted.size();
+    }
+}
+
+#pragma mark - ASLOperationStatistics
+
+@interface ASLOperationStatistics ()
+
+- (instancetype)initWithRecord:(ASLOperationRecord const &)record
+                         level:(size_t)level
+                      recorder:(ASLInstrumentationRecorder const &)recorder;
+
+@end
+
+@implementation ASLOperationStatistics
+
+- (instancetype)initWithRecord:(ASLOperationRecord const &)record
+                         level:(size_t)level
+                      recorder:(ASLInstrumentationRecorder const &)recorder {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    ASLLevelCounters const &counters = *record.levels[level];
+    _componentName = NSStringFromClass(record.owner);
+    _operation = NSStringFromSelector(record.operation);
+    _level = level < recorder.levelCount() ? static_cast<NSInteger>(level) : -1;
+    seal::parms_id_type const parmsId = recorder.parametersId(level);
+    _parametersId = ASLParametersIdTypeMake(parmsId[0], parmsId[1], parmsId[2], parmsId[3]);
+    _callCount = counters.calls.load(std::memory_order_relaxed);
+    _failureCount = counters.failures.load(std::memory_order_relaxed);
+    _totalNanoseconds = counters.totalNanoseconds.load(std::memory_order_relaxed);
+    _maximumNanoseconds = counters.maximumNanoseconds.load(std::memory_order_relaxed);
+
+    NSMutableArray<NSNumber *> * const histogram = [NSMutableArray arrayWithCapacity:ASLLatencyBucketCount];
+    for (std::atomic<uint64_t> const &bucket : counters.latencyBuckets) {
+        [histogram addObject:@(bucket.load(std::memory_order_relaxed))];
+    }
+    _latencyHistogram = [histogram copy];
+
+    NSMutableDictionary<NSNumber *, NSNumber *> * const outputLevelCounts = [NSMutableDictionary dictionary];
+    uint64_t outputCount = 0;
+    for (size_t outputLevel = 0; outputLevel < counters.outputLevelCount; ++outputLevel) {
+        uint64_t const count = counters.outputLevels[outputLevel].load(std::memory_order_relaxed);
+        if (count != 0) {
+            NSInteger const key = outputLevel < recorder.levelCount() ? static_cast<NSInteger>(outputLevel) : -1;
+            outputLevelCounts[@(key)] = @(count);
+            outputCount += count;
+        }
+    }
+    _outputLevelCounts = [outputLevelCounts copy];
+    _averageInputSize = _callCount == 0 ? 0 : static_cast<double>(counters.inputSizeTotal.load(std::memory_order_relaxed)) / _callCount;
+    _averageOutputSize = outputCount == 0 ? 0 : static_cast<double>(counters.outputSizeTotal.load(std::memory_order_relaxed)) / outputCount;
+
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"%@ %@ level %ld: %llu calls, %llu failures, %llu ns",
+            _componentName, _operation, static_cast<long>(_level), _callCount, _failureCount, _totalNanoseconds];
+}
+
+@end
+
+#pragma mark - ASLInstrumentation
+
+@implementation ASLInstrumentation {
+    std::shared_ptr<ASLInstrumentationRecorder> _recorder;
+}
+
+#pragma mark - Initialization
+
++ (instancetype)instrumentationWithContext:(ASLSealContext *)context {
+    NSParameterAssert(context != nil);
+    return [[self alloc] initWithContext:context];
+}
+
+- (instancetype)initWithContext:(ASLSealContext *)context {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    _recorder = std::make_shared<ASLInstrumentationRecorder>(context.sealContext);
+
+    return self;
+}
+
+#pragma mark - Properties
+
+- (BOOL)isEnabled {
+    return _recorder->enabled();
+}
+
+- (void)setEnabled:(BOOL)enabled {
+    _recorder->setEnabled(enabled);
+}
+
+- (std::shared_ptr<ASLInstrumentationRecorder>)recorder {
+    return _recorder;
+}
+
+#pragma mark - Public Methods
+
+- (NSArray<ASLOperationStatistics *> *)snapshot {
+    NSMutableArray<ASLOperationStatistics *> * const statistics = [NSMutableArray array];
+    ASLInstrumentationRecorder const &recorder = *_recorder;
+    recorder.forEachRecord([&](ASLOperationRecord const &record) {
+        for (size_t level = 0; level < record.levels.size(); ++level) {
+            if (record.levels[level]->calls.load(std::memory_order_relaxed) != 0) {
+                [statistics addObject:[[ASLOperationStatistics alloc] initWithRecord:record level:level recorder:recorder]];
+            }
+        }
+    });
+    [statistics sortUsingComparator:^NSComparisonResult(ASLOperationStatistics *lhs, ASLOperationStatistics *rhs) {
+        NSComparisonResult const byClass = [lhs.componentName compare:rhs.componentName];
+        if (byClass != NSOrderedSame) {
+            return byClass;
+        }
+        NSComparisonResult const byOperation = [lhs.operation compare:rhs.operation];
+        if (byOperation != NSOrderedSame) {
+            return byOperation;
+        }
+        return [@(rhs.level) compare:@(lhs.level)];
+    }];
+    return [statistics copy];
+}
+
+- (void)reset {
+    _recorder->reset();
+}
+
+- (NSString *)textReport {
+    NSMutableString * const report = [NSMutableString stringWithString:@"component\toperation\tlevel\tcalls\tfailures\ttotal ns\tmean ns\tmax ns\tinput size\toutput size\n"];
+    for (ASLOperationStatistics *statistics in [self snapshot]) {
+        [report appendFormat:@"%@\t%@\t%ld\t%llu\t%llu\t%llu\t%llu\t%llu\t%.2f\t%.2f\n",
+         statistics.componentName,
+         statistics.operation,
+         static_cast<long>(statistics.level),
+         statistics.callCount,
+         statistics.failureCount,
+         statistics.totalNanoseconds,
+         statistics.totalNanoseconds / statistics.callCount,
+         statistics.maximumNanoseconds,
+         statistics.averageInputSize,
+         statistics.averageOutputSize];
+    }
+    return [report copy];
+}
+
+- (NSData *)JSONReport {
+    NSMutableArray<NSDictionary *> * const entries = [NSMutableArray array];
+    for (ASLOperationStatistics *statistics in [self snapshot]) {
+        NSMutableDictionary<NSString *, NSNumber *> * const outputLevelCounts = [NSMutableDictionary dictionary];
+        [statistics.outputLevelCounts enumerateKeysAndObjectsUsingBlock:^(NSNumber *level, NSNumber *count, BOOL *stop) {
+            outputLevelCounts[level.stringValue] = count;
+        }];
+        ASLParametersIdType const parametersId = statistics.parametersId;
+        [entries addObject:@{
+            @"componentName": statistics.componentName,
+            @"operation": statistics.operation,
+            @"level": @(statistics.level),
+            @"parametersId": @[@(parametersId.block[0]), @(parametersId.block[1]), @(parametersId.block[2]), @(parametersId.block[3])],
+            @"callCount": @(statistics.callCount),
+            @"failureCount": @(statistics.failureCount),
+            @"totalNanoseconds": @(statistics.totalNanoseconds),
+            @"maximumNanoseconds": @(statistics.maximumNanoseconds),
+            @"latencyHistogram": statistics.latencyHistogram,
+            @"averageInputSize": @(statistics.averageInputSize),
+            @"averageOutputSize": @(statistics.averageOutputSize),
+            @"outputLevelCounts": outputLevelCounts,
+        }];
+    }
+    return [NSJSONSerialization dataWithJSONObject:entries options:NSJSONWritingPrettyPrinted error:nil];
+}
+
+@end
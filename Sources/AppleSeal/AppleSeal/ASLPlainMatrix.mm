@@ -0,0 +1,165 @@
+//
+//  ASLPlainMatrix.mm
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLPlainMatrix.h"
+#import "ASLPlainMatrix_Internal.h"
+
+#include <cmath>
+#include <stdexcept>
+#include "seal/evaluator.h"
+
+#import "ASLEvaluator_Internal.h"
+#import "ASLPlainText_Internal.h"
+#import "NSError+CXXAdditions.h"
+
+@implementation ASLPlainMatrix {
+    NSDictionary<NSNumber *, ASLPlainText *> *_diagonals;
+}
+
+#pragma mark - Initialization
+
++ (instancetype)matrixWithRows:(NSArray<NSArray<NSNumber *> *> *)rows
+                   ckksEncoder:(ASLCKKSEncoder *)encoder
+                  parametersId:(ASLParametersIdType)parametersId
+                         scale:(double)scale
+                         error:(NSError **)error {
+    NSParameterAssert(rows != nil);
+    NSParameterAssert(encoder != nil);
+    
+    return [[ASLPlainMatrix alloc] initWithRows:rows
+                                      slotCount:encoder.slotCount
+                                        rowSize:encoder.slotCount
+                                   parametersId:parametersId
+                                          error:error
+                                 encodeDiagonal:^ASLPlainText *(NSArray<NSNumber *> *values, NSError **encodeError) {
+        return [encoder encodeWithDoubleValues:values
+                                  parametersId:parametersId
+                                         scale:scale
+                                         error:encodeError];
+    }];
+}
+
++ (instancetype)matrixWithRows:(NSArray<NSArray<NSNumber *> *> *)rows
+                  batchEncoder:(ASLBatchEncoder *)encoder
+                     evaluator:(ASLEvaluator *)evaluator
+                  parametersId:(ASLParametersIdType)parametersId
+                         error:(NSError **)error {
+    NSParameterAssert(rows != nil);
+    NSParameterAssert(encoder != nil);
+    NSParameterAssert(evaluator != nil);
+    
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block), std::end(parametersId.block), sealParametersId.begin());
+    
+    return [[ASLPlainMatrix alloc] initWithRows:rows
+                                      slotCount:encoder.slotCount
+                                        rowSize:encoder.slotCount / 2
+                                   parametersId:parametersId
+                                          error:error
+                                 encodeDiagonal:^ASLPlainText *(NSArray<NSNumber *> *values, NSError **encodeError) {
+        ASLPlainText * const plain = [encoder encodeWithSignedValues:values error:encodeError];
+        if (plain == nil) {
+            return nil;
+        }
+        try {
+            [evaluator sealEvaluatorReference].transform_to_ntt_inplace([plain mutableSealPlainText], sealParametersId);
+            return plain;
+        } catch (std::invalid_argument const &e) {
+            if (encodeError != nil) {
+                *encodeError = [NSError ASL_SealInvalidParameter:e];
+            }
+            return nil;
+        }
+    }];
+}
+
+- (instancetype)initWithRows:(NSArray<NSArray<NSNumber *> *> *)rows
+                   slotCount:(NSUInteger)slotCount
+                     rowSize:(NSUInteger)rowSize
+                parametersId:(ASLParametersIdType)parametersId
+                       error:(NSError **)error
+              encodeDiagonal:(ASLPlainText * _Nullable (^)(NSArray<NSNumber *> *values, NSError **encodeError))encodeDiagonal {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+    
+    NSUInteger const dimension = rows.firstObject.count;
+    try {
+        if (dimension == 0 || rows.count > dimension) {
+            throw std::invalid_argument("matrix must have at least as many columns as rows");
+        }
+        for (NSArray<NSNumber *> * const row in rows) {
+            if (row.count != dimension) {
+                throw std::invalid_argument("matrix rows must have the same number of columns");
+            }
+        }
+        if (rowSize % dimension != 0) {
+            throw std::invalid_argument("matrix dimension must divide the number of slots in a row");
+        }
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+    
+    _dimension = dimension;
+    _parametersId = parametersId;
+    _babyStepCount = static_cast<NSUInteger>(std::ceil(std::sqrt(static_cast<double>(dimension))));
+    _giantStepCount = (dimension + _babyStepCount - 1) / _babyStepCount;
+    
+    NSMutableArray<NSNumber *> * const galoisSteps = [NSMutableArray array];
+    for (NSUInteger step = 1; step < _babyStepCount; ++step) {
+        [galoisSteps addObject:@(step)];
+    }
+    for (NSUInteger giant = 1; giant < _giantStepCount; ++giant) {
+        [galoisSteps addObject:@(giant * _babyStepCount)];
+    }
+    _galoisSteps = [galoisSteps copy];
+    
+    // Diagonal k holds M[i][(i + k) mod n] in slot i, pre-rotated right by the giant step it belongs to.
+    NSMutableDictionary<NSNumber *, ASLPlainText *> * const diagonals = [NSMutableDictionary dictionary];
+    NSNumber * const zero = @0;
+    for (NSUInteger k = 0; k < dimension; ++k) {
+        NSUInteger const giantStep = (k / _babyStepCount) * _babyStepCount;
+        NSMutableArray<NSNumber *> * const values = [NSMutableArray arrayWithCapacity:slotCount];
+        BOOL isZero = YES;
+        for (NSUInteger slot = 0; slot < slotCount; ++slot) {
+            NSUInteger const i = (slot + dimension - giantStep % dimension) % dimension;
+            NSNumber * const value = i < rows.count ? rows[i][(i + k) % dimension] : zero;
+            isZero = isZero && value.doubleValue == 0;
+            [values addObject:value];
+        }
+        if (isZero) {
+            continue;
+        }
+        ASLPlainText * const diagonal = encodeDiagonal(values, error);
+        if (diagonal == nil) {
+            return nil;
+        }
+        diagonals[@(k)] = diagonal;
+    }
+    _diagonals = [diagonals copy];
+    
+    return self;
+}
+
+#pragma mark - Properties
+
+- (NSUInteger)diagonalCount {
+    return _diagonals.count;
+}
+
+#pragma mark - Internal Methods
+
+- (ASLPlainText *)diagonalAtIndex:(NSUInteger)index {
+    return _diagonals[@(index)];
+}
+
+@end
@@ -22,6 +22,7 @@
 
 @implementation ASLPlainText {
     seal::Plaintext _plainText;
+    NSUInteger _mutationCount;
 }
 
 #pragma mark - Initialization
@@ -283,6 +284,7 @@
 - (BOOL)reserve:(size_t)capacity error:(NSError **)error {
     try {
         _plainText.reserve(capacity);
+        _mutationCount += 1;
         return YES;
     } catch (std::logic_error const &e) {
         if (error != nil) {
@@ -299,12 +301,14 @@
 
 - (void)returnMemoryToPool {
     _plainText.release();
+    _mutationCount += 1;
 }
 
 - (BOOL)resize:(size_t)coefficientCount
          error:(NSError **)error {
     try {
         _plainText.resize(coefficientCount);
+        _mutationCount += 1;
         return YES;
     } catch (std::invalid_argument const &e) {
         if (error != nil) {
@@ -325,6 +329,7 @@
           error:(NSError **)error {
     try {
         _plainText.set_zero(coefficientCount);
+        _mutationCount += 1;
         return YES;
     } catch (...) {
         [NSException raise:NSRangeException
@@ -339,6 +344,7 @@
           error:(NSError **)error {
     try {
         _plainText.set_zero(startCoefficient, length);
+        _mutationCount += 1;
         return YES;
     } catch (...) {
         [NSException raise:NSRangeException
@@ -350,6 +356,7 @@
 
 - (void)setZero {
     _plainText.set_zero();
+    _mutationCount += 1;
 }
 
 #pragma mark ASLPlainText_Internal
@@ -358,4 +365,17 @@
     return _plainText;
 }
 
+- (seal::Plaintext const &)sealPlainTextReference {
+    return _plainText;
+}
+
+- (seal::Plaintext &)mutableSealPlainText {
+    _mutationCount += 1;
+    return _plainText;
+}
+
+- (NSUInteger)mutationCount {
+    return _mutationCount;
+}
+
 @end
@@ -0,0 +1,119 @@
+//
+//  ASLPreparedPlainText.mm
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLPreparedPlainText.h"
+#import "ASLPreparedPlainText_Internal.h"
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include "seal/evaluator.h"
+
+#import "ASLEvaluator_Internal.h"
+#import "ASLPlainText_Internal.h"
+#import "NSError+CXXAdditions.h"
+
+@implementation ASLPreparedPlainText {
+    ASLEvaluator *_evaluator;
+    ASLPlainText *_plainText;
+    bool _isBFV;
+    std::mutex _cacheMutex;
+    std::map<seal::parms_id_type, std::shared_ptr<seal::Plaintext const>> _nttPlainTexts;
+}
+
+#pragma mark - Initialization
+
++ (instancetype)preparedPlainTextWithPlainText:(ASLPlainText *)plain
+                                     evaluator:(ASLEvaluator *)evaluator
+                                         error:(NSError **)error {
+    NSParameterAssert(plain != nil);
+    NSParameterAssert(evaluator != nil);
+    
+    ASLPreparedPlainText * const prepared = [[ASLPreparedPlainText alloc] initWithPlainText:[plain copy]
+                                                                                  evaluator:evaluator];
+    std::shared_ptr<seal::SEALContext> const context = [evaluator sealContext];
+    try {
+        seal::Plaintext const &sealPlain = [prepared sealPlainTextReference];
+        if (prepared->_isBFV) {
+            if (sealPlain.is_ntt_form()) {
+                throw std::invalid_argument("plain cannot be in NTT form");
+            }
+            [prepared nttPlainTextForParametersId:context->first_parms_id()];
+        } else {
+            if (!sealPlain.is_ntt_form()) {
+                throw std::invalid_argument("plain must be in NTT form");
+            }
+            [prepared nttPlainTextForParametersId:sealPlain.parms_id()];
+        }
+        return prepared;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+- (instancetype)initWithPlainText:(ASLPlainText *)plainText
+                        evaluator:(ASLEvaluator *)evaluator {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+    
+    _evaluator = evaluator;
+    _plainText = plainText;
+    _isBFV = [evaluator sealContext]->key_context_data()->parms().scheme() == seal::scheme_type::BFV;
+    
+    return self;
+}
+
+#pragma mark - Properties
+
+- (ASLPlainText *)plainText {
+    return [_plainText copy];
+}
+
+- (NSUInteger)preparedLevelCount {
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    return _nttPlainTexts.size();
+}
+
+#pragma mark - ASLPreparedPlainText_Internal
+
+- (seal::Plaintext const &)sealPlainTextReference {
+    return [_plainText sealPlainTextReference];
+}
+
+- (std::shared_ptr<seal::Plaintext const>)nttPlainTextForParametersId:(seal::parms_id_type const &)parametersId {
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    auto const cached = _nttPlainTexts.find(parametersId);
+    if (cached != _nttPlainTexts.end()) {
+        return cached->second;
+    }
+    
+    seal::Evaluator &evaluator = [_evaluator sealEvaluatorReference];
+    seal::Plaintext const &source = [_plainText sealPlainTextReference];
+    auto prepared = std::make_shared<seal::Plaintext>();
+    if (_isBFV) {
+        evaluator.transform_to_ntt(source, parametersId, *prepared);
+    } else if (source.parms_id() == parametersId) {
+        *prepared = source;
+    } else {
+        evaluator.mod_switch_to(source, parametersId, *prepared);
+    }
+    _nttPlainTexts[parametersId] = prepared;
+    return prepared;
+}
+
+@end
@@ -0,0 +1,148 @@
+//
+//  ASLProductAccumulator.mm
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLProductAccumulator.h"
+
+#include <utility>
+#include "seal/ciphertext.h"
+#include "seal/evaluator.h"
+
+#import "ASLEvaluator_Internal.h"
+#import "ASLCipherText_Internal.h"
+#import "ASLRelinearizationKeys_Internal.h"
+#import "NSError+CXXAdditions.h"
+
+@implementation ASLProductAccumulator {
+    ASLEvaluator *_evaluator;
+    std::shared_ptr<seal::SEALContext> _context;
+    seal::Ciphertext _sum;
+    seal::Ciphertext _product;
+    NSUInteger _termCount;
+}
+
+#pragma mark - Initialization
+
++ (instancetype)accumulatorWithEvaluator:(ASLEvaluator *)evaluator {
+    NSParameterAssert(evaluator != nil);
+    return [[self alloc] initWithEvaluator:evaluator];
+}
+
+- (instancetype)initWithEvaluator:(ASLEvaluator *)evaluator {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+    
+    _evaluator = evaluator;
+    _context = [evaluator sealContext];
+    _termCount = 0;
+    
+    return self;
+}
+
+#pragma mark - Properties
+
+- (NSUInteger)termCount {
+    return _termCount;
+}
+
+#pragma mark - Public Methods
+
+- (BOOL)multiply:(ASLCipherText *)encrypted1
+      encrypted2:(ASLCipherText *)encrypted2
+           error:(NSError **)error {
+    NSParameterAssert(encrypted1 != nil);
+    NSParameterAssert(encrypted2 != nil);
+    
+    seal::Evaluator &evaluator = [_evaluator sealEvaluatorReference];
+    try {
+        seal::Ciphertext const &sealEncrypted1 = [encrypted1 sealCipherTextReference];
+        seal::Ciphertext const &sealEncrypted2 = [encrypted2 sealCipherTextReference];
+        if (_termCount == 0) {
+            evaluator.multiply(sealEncrypted1, sealEncrypted2, _sum);
+        } else {
+            if (_product.size_capacity() < 3) {
+                _product.reserve(_context, sealEncrypted1.parms_id(), 3);
+            }
+            evaluator.multiply(sealEncrypted1, sealEncrypted2, _product);
+            evaluator.add_inplace(_sum, _product);
+        }
+        _termCount += 1;
+        return YES;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+- (BOOL)add:(ASLCipherText *)encrypted
+      error:(NSError **)error {
+    NSParameterAssert(encrypted != nil);
+    
+    seal::Evaluator &evaluator = [_evaluator sealEvaluatorReference];
+    try {
+        seal::Ciphertext const &sealEncrypted = [encrypted sealCipherTextReference];
+        if (_termCount == 0) {
+            _sum = sealEncrypted;
+        } else {
+            evaluator.add_inplace(_sum, sealEncrypted);
+        }
+        _termCount += 1;
+        return YES;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return NO;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return NO;
+    }
+}
+
+- (ASLCipherText * _Nullable)relinearizedSumWithRelinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                                              error:(NSError **)error {
+    NSParameterAssert(relinearizationKeys != nil);
+    
+    seal::Evaluator &evaluator = [_evaluator sealEvaluatorReference];
+    try {
+        if (_termCount == 0) {
+            throw std::invalid_argument("no terms have been accumulated");
+        }
+        evaluator.relinearize_inplace(_sum, [relinearizationKeys sealRelinKeysReference]);
+        ASLCipherText * const result = [[ASLCipherText alloc] initWithCipherText:std::move(_sum)];
+        [self reset];
+        return result;
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    } catch (std::logic_error const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealLogicError:e];
+        }
+        return nil;
+    }
+}
+
+- (void)reset {
+    _sum = seal::Ciphertext();
+    _termCount = 0;
+}
+
+@end
@@ -91,6 +91,10 @@
     return _relinearizationKeys;
 }
 
+- (seal::RelinKeys const &)sealRelinKeysReference {
+    return _relinearizationKeys;
+}
+
 - (instancetype)initWithRelinearizationKeys:(seal::RelinKeys)relinearizationKeys {
     self = [super initWithKSwitchKeys:relinearizationKeys];
     if (self == nil) {
@@ -0,0 +1,310 @@
+//
+//  ASLSignApproximation.mm
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLSignApproximation.h"
+#import "ASLSignApproximation_Internal.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#import "NSError+CXXAdditions.h"
+
+/// The largest depth the approximation search considers.
+static NSUInteger const ASLSignMaximumSearchDepth = 48;
+
+/// The number of log-spaced cells [gap, 1] is first split into when bounding the error.
+static size_t const ASLSignErrorCellCount = 256;
+
+/// How far above the largest error seen at a point the bound of a cell may be before the
+/// cell is bisected, relative to that error.
+static double const ASLSignErrorBoundTolerance = 1.0 / 64.0;
+
+/// The relative width below which a cell is no longer bisected.
+static double const ASLSignErrorMinimumCellWidth = 1e-12;
+
+/// The relative amount every enclosure is widened by to cover floating-point rounding.
+static double const ASLSignRoundingSlack = 1e-14;
+
+/// A closed interval of reals.
+struct ASLSignInterval {
+    double lower;
+    double upper;
+};
+
+static ASLSignInterval ASLSignIntervalProduct(ASLSignInterval const &lhs, ASLSignInterval const &rhs) {
+    double const products[] = {lhs.lower * rhs.lower, lhs.lower * rhs.upper, lhs.upper * rhs.lower, lhs.upper * rhs.upper};
+    return {*std::min_element(std::begin(products), std::end(products)), *std::max_element(std::begin(products), std::end(products))};
+}
+
+/// Returns polynomial(value) by Horner's rule.
+static double ASLSignEvaluate(std::vector<double> const &polynomial, double value) {
+    double result = 0.0;
+    for (auto coefficient = polynomial.rbegin(); coefficient != polynomial.rend(); ++coefficient) {
+        result = result * value + *coefficient;
+    }
+    return result;
+}
+
+/// Returns an interval containing polynomial(x) for every x in values, by Horner's rule in
+/// interval arithmetic.
+static ASLSignInterval ASLSignEvaluate(std::vector<double> const &polynomial, ASLSignInterval const &values) {
+    ASLSignInterval result = {0.0, 0.0};
+    for (auto coefficient = polynomial.rbegin(); coefficient != polynomial.rend(); ++coefficient) {
+        result = ASLSignIntervalProduct(result, values);
+        result.lower += *coefficient;
+        result.upper += *coefficient;
+    }
+    return result;
+}
+
+/// Returns the coefficients of the derivative of polynomial, constant term first.
+static std::vector<double> ASLSignDerivative(std::vector<double> const &polynomial) {
+    std::vector<double> derivative(polynomial.size() - 1);
+    for (size_t i = 1; i < polynomial.size(); ++i) {
+        derivative[i - 1] = polynomial[i] * static_cast<double>(i);
+    }
+    return derivative;
+}
+
+/// Returns the coefficients of f_n for degree 2n + 1, constant term first.
+static std::vector<double> ASLSignPolynomial(NSUInteger degree) {
+    size_t const n = degree / 2;
+    std::vector<double> coefficients(degree + 1, 0.0);
+    double weight = 1.0;
+    for (size_t i = 0; i <= n; ++i) {
+        // weight is 4^-i C(2i, i); x (1 - x^2)^i contributes (-1)^j C(i, j) x^(2j + 1).
+        double binomial = 1.0;
+        for (size_t j = 0; j <= i; ++j) {
+            coefficients[2 * j + 1] += weight * binomial * ((j % 2 == 0) ? 1.0 : -1.0);
+            binomial = binomial * static_cast<double>(i - j) / static_cast<double>(j + 1);
+        }
+        weight = weight * static_cast<double>(2 * i + 1) * static_cast<double>(2 * i + 2) / (4.0 * static_cast<double>(i + 1) * static_cast<double>(i + 1));
+    }
+    return coefficients;
+}
+
+/// Returns the coefficients of g_n for degree 2n + 1, constant term first.
+static std::vector<double> ASLAcceleratedSignPolynomial(NSUInteger degree) {
+    switch (degree) {
+        case 3:
+            return {0.0, 2126.0 / 1024.0, 0.0, -1359.0 / 1024.0};
+        case 5:
+            return {0.0, 3334.0 / 1024.0, 0.0, -6108.0 / 1024.0, 0.0, 3796.0 / 1024.0};
+        default:
+            return {0.0, 4589.0 / 1024.0, 0.0, -16577.0 / 1024.0, 0.0, 25614.0 / 1024.0, 0.0, -12860.0 / 1024.0};
+    }
+}
+
+/// Returns the levels one polynomial of the given degree consumes in evaluatePolynomial.
+static NSUInteger ASLSignPolynomialDepth(NSUInteger degree) {
+    return degree == 3 ? 2 : degree == 5 ? 3 : 4;
+}
+
+/// Returns the ciphertext multiplications one polynomial of the given degree performs in evaluatePolynomial.
+static NSUInteger ASLSignPolynomialMultiplications(NSUInteger degree) {
+    return degree == 3 ? 2 : 4;
+}
+
+@implementation ASLSignApproximation {
+    std::vector<std::vector<double>> _polynomials;
+    std::vector<std::vector<double>> _derivatives;
+}
+
+#pragma mark - Initialization
+
++ (instancetype)approximationWithDegree:(NSUInteger)degree
+                  acceleratedIterations:(NSUInteger)acceleratedIterations
+                             iterations:(NSUInteger)iterations
+                                  error:(NSError **)error {
+    try {
+        if (degree != 3 && degree != 5 && degree != 7) {
+            throw std::invalid_argument("degree must be 3, 5 or 7");
+        }
+        if (acceleratedIterations + iterations == 0) {
+            throw std::invalid_argument("approximation must have at least one iteration");
+        }
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+    return [[ASLSignApproximation alloc] initWithDegree:degree
+                                  acceleratedIterations:acceleratedIterations
+                                             iterations:iterations];
+}
+
+- (instancetype)initWithDegree:(NSUInteger)degree
+         acceleratedIterations:(NSUInteger)acceleratedIterations
+                    iterations:(NSUInteger)iterations {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+    
+    _degree = degree;
+    _acceleratedIterations = acceleratedIterations;
+    _iterations = iterations;
+    _depth = (acceleratedIterations + iterations) * ASLSignPolynomialDepth(degree);
+    _multiplicationCount = (acceleratedIterations + iterations) * ASLSignPolynomialMultiplications(degree);
+    _polynomials.assign(acceleratedIterations, ASLAcceleratedSignPolynomial(degree));
+    _polynomials.insert(_polynomials.end(), iterations, ASLSignPolynomial(degree));
+    for (std::vector<double> const &polynomial : _polynomials) {
+        _derivatives.push_back(ASLSignDerivative(polynomial));
+    }
+    
+    return self;
+}
+
+#pragma mark - Approximation Tables
+
++ (instancetype)cheapestApproximationForInputGap:(double)gap
+                                    maximumError:(double)maximumError {
+    ASLSignApproximation *cheapest = nil;
+    for (ASLSignApproximation * const approximation in [self candidateApproximations]) {
+        if (cheapest != nil && approximation.depth > cheapest.depth) {
+            break;
+        }
+        if (!([approximation maximumErrorForInputGap:gap] <= maximumError)) {
+            continue;
+        }
+        if (cheapest == nil || approximation.multiplicationCount < cheapest.multiplicationCount) {
+            cheapest = approximation;
+        }
+    }
+    return cheapest;
+}
+
++ (NSArray<ASLSignApproximation *> *)approximationsForInputGap:(double)gap
+                                                  maximumDepth:(NSUInteger)maximumDepth {
+    NSMutableArray<ASLSignApproximation *> * const table = [NSMutableArray array];
+    double smallestError = INFINITY;
+    ASLSignApproximation *best = nil;
+    double bestError = INFINITY;
+    for (ASLSignApproximation * const approximation in [self candidateApproximations]) {
+        if (approximation.depth > maximumDepth) {
+            break;
+        }
+        if (best != nil && approximation.depth > best.depth) {
+            if (bestError < smallestError) {
+                [table addObject:best];
+                smallestError = bestError;
+            }
+            best = nil;
+            bestError = INFINITY;
+        }
+        double const error = [approximation maximumErrorForInputGap:gap];
+        if (error < bestError) {
+            best = approximation;
+            bestError = error;
+        }
+    }
+    if (best != nil && bestError < smallestError) {
+        [table addObject:best];
+    }
+    return [table copy];
+}
+
+/// Returns every approximation up to the search depth, ordered by depth.
++ (NSArray<ASLSignApproximation *> *)candidateApproximations {
+    NSMutableArray<ASLSignApproximation *> * const candidates = [NSMutableArray array];
+    for (NSUInteger degree = 3; degree <= 7; degree += 2) {
+        NSUInteger const maximumIterations = ASLSignMaximumSearchDepth / ASLSignPolynomialDepth(degree);
+        for (NSUInteger total = 1; total <= maximumIterations; ++total) {
+            for (NSUInteger iterations = 0; iterations <= total; ++iterations) {
+                [candidates addObject:[[ASLSignApproximation alloc] initWithDegree:degree
+                                                             acceleratedIterations:total - iterations
+                                                                        iterations:iterations]];
+            }
+        }
+    }
+    [candidates sortWithOptions:NSSortStable usingComparator:^NSComparisonResult(ASLSignApproximation *lhs, ASLSignApproximation *rhs) {
+        return lhs.depth < rhs.depth ? NSOrderedAscending : lhs.depth > rhs.depth ? NSOrderedDescending : NSOrderedSame;
+    }];
+    return candidates;
+}
+
+#pragma mark - Public Methods
+
+- (double)maximumErrorForInputGap:(double)gap {
+    NSParameterAssert(gap > 0 && gap <= 1);
+    
+    // The composite is odd, so only positive inputs are considered. [gap, 1] is split into
+    // log-spaced cells, densest near the gap, and the error over each cell is bounded by an
+    // enclosure of its image. A cell whose bound is well above the largest error seen at any
+    // point is bisected, so the result is an upper bound within the tolerance of the maximum.
+    std::vector<ASLSignInterval> cells;
+    double pointError = 0.0;
+    for (size_t cell = 0; cell < ASLSignErrorCellCount; ++cell) {
+        double const lower = std::pow(gap, 1.0 - static_cast<double>(cell) / static_cast<double>(ASLSignErrorCellCount));
+        double const upper = std::pow(gap, 1.0 - static_cast<double>(cell + 1) / static_cast<double>(ASLSignErrorCellCount));
+        cells.push_back({lower, upper});
+        pointError = std::max(pointError, [self errorAtInput:lower]);
+    }
+    pointError = std::max(pointError, [self errorAtInput:1.0]);
+    
+    double maximumError = 0.0;
+    while (!cells.empty()) {
+        ASLSignInterval const cell = cells.back();
+        cells.pop_back();
+        ASLSignInterval const image = [self enclosureOfInputs:cell];
+        double const bound = std::max(std::abs(1.0 - image.lower), std::abs(1.0 - image.upper));
+        double const middle = 0.5 * (cell.lower + cell.upper);
+        pointError = std::max(pointError, [self errorAtInput:middle]);
+        if (bound <= pointError * (1.0 + ASLSignErrorBoundTolerance)
+            || cell.upper - cell.lower <= cell.lower * ASLSignErrorMinimumCellWidth) {
+            maximumError = std::max(maximumError, bound);
+        } else {
+            cells.push_back({cell.lower, middle});
+            cells.push_back({middle, cell.upper});
+        }
+    }
+    return maximumError;
+}
+
+#pragma mark - Private Methods
+
+/// Returns |1 - p(value)| for the composite p.
+- (double)errorAtInput:(double)value {
+    for (std::vector<double> const &polynomial : _polynomials) {
+        value = ASLSignEvaluate(polynomial, value);
+    }
+    return std::abs(1.0 - value);
+}
+
+/// Returns an interval containing p(x) for the composite p and every x in inputs. Each
+/// polynomial is enclosed by both its mean value form, p(m) + p'(X)(X - m) for the midpoint m,
+/// which is tight on narrow intervals, and Horner's rule in interval arithmetic, and the two
+/// enclosures are intersected.
+- (ASLSignInterval)enclosureOfInputs:(ASLSignInterval)inputs {
+    for (size_t index = 0; index < _polynomials.size(); ++index) {
+        double const middle = 0.5 * (inputs.lower + inputs.upper);
+        double const radius = 0.5 * (inputs.upper - inputs.lower);
+        double const value = ASLSignEvaluate(_polynomials[index], middle);
+        ASLSignInterval const slope = ASLSignEvaluate(_derivatives[index], inputs);
+        double const spread = std::max(std::abs(slope.lower), std::abs(slope.upper)) * radius;
+        ASLSignInterval const horner = ASLSignEvaluate(_polynomials[index], inputs);
+        ASLSignInterval image = {std::max(value - spread, horner.lower), std::min(value + spread, horner.upper)};
+        double const slack = ASLSignRoundingSlack * (1.0 + std::max(std::abs(image.lower), std::abs(image.upper)));
+        image.lower -= slack;
+        image.upper += slack;
+        inputs = image;
+    }
+    return inputs;
+}
+
+#pragma mark - Internal Methods
+
+- (std::vector<std::vector<double>> const &)polynomials {
+    return _polynomials;
+}
+
+@end
@@ -0,0 +1,219 @@
+//
+//  ASLSlotPermutation.mm
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLSlotPermutation.h"
+#import "ASLSlotPermutation_Internal.h"
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include "seal/evaluator.h"
+
+#import "ASLEvaluator_Internal.h"
+#import "ASLPlainText_Internal.h"
+#import "NSError+CXXAdditions.h"
+
+@implementation ASLSlotPermutation {
+    std::vector<int> _babySteps;
+    std::vector<ASLSlotPermutationGroup> _groups;
+}
+
+#pragma mark - Initialization
+
++ (instancetype)permutationWithIndices:(NSArray<NSNumber *> *)indices
+                           ckksEncoder:(ASLCKKSEncoder *)encoder
+                          parametersId:(ASLParametersIdType)parametersId
+                                 scale:(double)scale
+                                 error:(NSError **)error {
+    NSParameterAssert(indices != nil);
+    NSParameterAssert(encoder != nil);
+    
+    return [[ASLSlotPermutation alloc] initWithIndices:indices
+                                             slotCount:encoder.slotCount
+                                               rowSize:encoder.slotCount
+                                          parametersId:parametersId
+                                                 error:error
+                                            encodeMask:^ASLPlainText *(NSArray<NSNumber *> *values, NSError **encodeError) {
+        return [encoder encodeWithDoubleValues:values
+                                  parametersId:parametersId
+                                         scale:scale
+                                         error:encodeError];
+    }];
+}
+
++ (instancetype)permutationWithIndices:(NSArray<NSNumber *> *)indices
+                          batchEncoder:(ASLBatchEncoder *)encoder
+                             evaluator:(ASLEvaluator *)evaluator
+                          parametersId:(ASLParametersIdType)parametersId
+                                 error:(NSError **)error {
+    NSParameterAssert(indices != nil);
+    NSParameterAssert(encoder != nil);
+    NSParameterAssert(evaluator != nil);
+    
+    seal::parms_id_type sealParametersId = {};
+    std::copy(std::begin(parametersId.block), std::end(parametersId.block), sealParametersId.begin());
+    
+    return [[ASLSlotPermutation alloc] initWithIndices:indices
+                                             slotCount:encoder.slotCount
+                                               rowSize:encoder.slotCount / 2
+                                          parametersId:parametersId
+                                                 error:error
+                                            encodeMask:^ASLPlainText *(NSArray<NSNumber *> *values, NSError **encodeError) {
+        ASLPlainText * const plain = [encoder encodeWithSignedValues:values error:encodeError];
+        if (plain == nil) {
+            return nil;
+        }
+        try {
+            [evaluator sealEvaluatorReference].transform_to_ntt_inplace([plain mutableSealPlainText], sealParametersId);
+            return plain;
+        } catch (std::invalid_argument const &e) {
+            if (encodeError != nil) {
+                *encodeError = [NSError ASL_SealInvalidParameter:e];
+            }
+            return nil;
+        }
+    }];
+}
+
+- (instancetype)initWithIndices:(NSArray<NSNumber *> *)indices
+                      slotCount:(NSUInteger)slotCount
+                        rowSize:(NSUInteger)rowSize
+                   parametersId:(ASLParametersIdType)parametersId
+                          error:(NSError **)error
+                     encodeMask:(ASLPlainText * _Nullable (^)(NSArray<NSNumber *> *values, NSError **encodeError))encodeMask {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+    
+    // Output slot (row, column) reads input slot (sourceRow, column + offset) modulo the row size.
+    std::vector<size_t> offsets(slotCount);
+    std::vector<bool> swapsRows(slotCount);
+    std::set<std::pair<bool, size_t>> masks;
+    try {
+        if (indices.count != slotCount) {
+            throw std::invalid_argument("indices must have an element for every slot");
+        }
+        for (NSUInteger slot = 0; slot < slotCount; ++slot) {
+            NSUInteger const source = indices[slot].unsignedIntegerValue;
+            if (source >= slotCount) {
+                throw std::invalid_argument("index out of range");
+            }
+            offsets[slot] = (source % rowSize + rowSize - slot % rowSize) % rowSize;
+            swapsRows[slot] = source / rowSize != slot / rowSize;
+            masks.emplace(swapsRows[slot], offsets[slot]);
+        }
+    } catch (std::invalid_argument const &e) {
+        if (error != nil) {
+            *error = [NSError ASL_SealInvalidParameter:e];
+        }
+        return nil;
+    }
+    
+    // Split each offset k into k / babyStepCount giant steps and k % babyStepCount baby steps,
+    // choosing the power-of-two baby step count that needs the fewest rotations.
+    size_t babyStepCount = 1;
+    size_t rotationCount = SIZE_MAX;
+    for (size_t candidate = 1; candidate <= rowSize; candidate <<= 1) {
+        std::set<size_t> babies;
+        std::set<std::pair<bool, size_t>> giants;
+        for (auto const &mask : masks) {
+            babies.insert(mask.second % candidate);
+            giants.emplace(mask.first, mask.second / candidate);
+        }
+        size_t cost = babies.size() - babies.count(0);
+        bool hasSwap = false;
+        for (auto const &giant : giants) {
+            cost += giant.second != 0 ? 1 : 0;
+            hasSwap = hasSwap || giant.first;
+        }
+        cost += hasSwap ? 1 : 0;
+        if (cost < rotationCount) {
+            rotationCount = cost;
+            babyStepCount = candidate;
+        }
+    }
+    
+    std::map<size_t, size_t> babyIndices;
+    for (auto const &mask : masks) {
+        babyIndices.emplace(mask.second % babyStepCount, 0);
+    }
+    for (auto &babyIndex : babyIndices) {
+        babyIndex.second = _babySteps.size();
+        _babySteps.push_back(static_cast<int>(babyIndex.first));
+    }
+    
+    // The mask of offset k is pre-rotated right by its giant step, and for the other row also
+    // swapped, so the partial sum lines up with the output once the group is rotated.
+    std::set<int> galoisSteps;
+    std::map<std::pair<bool, size_t>, size_t> groupIndices;
+    NSNumber * const zero = @0;
+    NSNumber * const one = @1;
+    for (auto const &mask : masks) {
+        size_t const giantStep = (mask.second / babyStepCount) * babyStepCount;
+        size_t const babyStep = mask.second % babyStepCount;
+        NSMutableArray<NSNumber *> * const values = [NSMutableArray arrayWithCapacity:slotCount];
+        for (NSUInteger slot = 0; slot < slotCount; ++slot) {
+            size_t const row = slot / rowSize;
+            size_t const outputRow = mask.first ? 1 - row : row;
+            size_t const output = outputRow * rowSize + (slot % rowSize + rowSize - giantStep) % rowSize;
+            bool const selected = offsets[output] == mask.second && swapsRows[output] == mask.first;
+            [values addObject:selected ? one : zero];
+        }
+        ASLPlainText * const encoded = encodeMask(values, error);
+        if (encoded == nil) {
+            return nil;
+        }
+        
+        auto const key = std::make_pair(mask.first, giantStep);
+        auto groupIndex = groupIndices.find(key);
+        if (groupIndex == groupIndices.end()) {
+            groupIndex = groupIndices.emplace(key, _groups.size()).first;
+            ASLSlotPermutationGroup group;
+            group.giantStep = static_cast<int>(giantStep);
+            group.swapsRows = mask.first;
+            _groups.push_back(std::move(group));
+        }
+        _groups[groupIndex->second].terms.emplace_back(babyIndices.at(babyStep), [encoded sealPlainText]);
+        
+        if (babyStep != 0) {
+            galoisSteps.insert(static_cast<int>(babyStep));
+        }
+        if (giantStep != 0) {
+            galoisSteps.insert(static_cast<int>(giantStep));
+        }
+        if (mask.first) {
+            galoisSteps.insert(0);
+        }
+    }
+    
+    NSMutableArray<NSNumber *> * const steps = [NSMutableArray arrayWithCapacity:galoisSteps.size()];
+    for (int const step : galoisSteps) {
+        [steps addObject:@(step)];
+    }
+    _slotCount = slotCount;
+    _maskCount = masks.size();
+    _rotationCount = rotationCount;
+    _parametersId = parametersId;
+    _galoisSteps = [steps copy];
+    
+    return self;
+}
+
+#pragma mark - Internal Methods
+
+- (std::vector<int> const &)babySteps {
+    return _babySteps;
+}
+
+- (std::vector<ASLSlotPermutationGroup> const &)groups {
+    return _groups;
+}
+
+@end
@@ -60,12 +60,12 @@
 
 +(BOOL)isMetaDataValidForRelinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
 									 context:(ASLSealContext*)context {
-	return seal::is_metadata_valid_for(relinearizationKeys.sealRelinKeys, context.sealContext);
+	return seal::is_metadata_valid_for([relinearizationKeys sealRelinKeysReference], context.sealContext);
 }
 
 +(BOOL)isMetaDataValidForGaloisKeys:(ASLGaloisKeys*)galoisKeys
 							context:(ASLSealContext*)context {
-	return seal::is_metadata_valid_for(galoisKeys.sealGaloisKeys, context.sealContext);
+	return seal::is_metadata_valid_for([galoisKeys sealGaloisKeysReference], context.sealContext);
 }
 
 +(BOOL)isBufferValidForPlainText:(ASLPlainText*)plainText {
@@ -89,11 +89,11 @@
 }
 
 +(BOOL)isBufferValidForRelinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys {
-	return seal::is_buffer_valid(relinearizationKeys.sealRelinKeys);
+	return seal::is_buffer_valid([relinearizationKeys sealRelinKeysReference]);
 }
 
 +(BOOL)isBufferValidForGaloisKeys:(ASLGaloisKeys*)galoisKeys {
-	return seal::is_buffer_valid(galoisKeys.sealGaloisKeys);
+	return seal::is_buffer_valid([galoisKeys sealGaloisKeysReference]);
 }
 
 +(BOOL)isDataValidForPlainText:(ASLPlainText*)plainText
@@ -122,12 +122,12 @@
 }
 +(BOOL)isDataValidForRelinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
 								 context:(ASLSealContext*)context {
-	return seal::is_data_valid_for(relinearizationKeys.sealRelinKeys, context.sealContext);
+	return seal::is_data_valid_for([relinearizationKeys sealRelinKeysReference], context.sealContext);
 }
 
 +(BOOL)isDataValidForGaloisKeys:(ASLGaloisKeys*)galoisKeys
 						context:(ASLSealContext*)context {
-	return seal::is_data_valid_for(galoisKeys.sealGaloisKeys, context.sealContext);
+	return seal::is_data_valid_for([galoisKeys sealGaloisKeysReference], context.sealContext);
 }
 
 +(BOOL)isValidForPlainText:(ASLPlainText*)plainText
@@ -156,12 +156,12 @@
 
 +(BOOL)isValidForRelinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
 							 context:(ASLSealContext*)context {
-	return seal::is_valid_for(relinearizationKeys.sealRelinKeys, context.sealContext);
+	return seal::is_valid_for([relinearizationKeys sealRelinKeysReference], context.sealContext);
 }
 
 +(BOOL)isValidForGaloisKeys:(ASLGaloisKeys*)galoisKeys
 					context:(ASLSealContext*)context {
-	return seal::is_valid_for(galoisKeys.sealGaloisKeys, context.sealContext);
+	return seal::is_valid_for([galoisKeys sealGaloisKeysReference], context.sealContext);
 }
 
 @end
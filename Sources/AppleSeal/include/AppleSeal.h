@@ -41,6 +41,14 @@ FOUNDATION_EXPORT const unsigned char AppleSealVersionString[];
 #import <AppleSeal/ASLDecryptor.h>
 #import <AppleSeal/ASLEncryptor.h>
 #import <AppleSeal/ASLEvaluator.h>
+#import <AppleSeal/ASLEvaluationGraph.h>
+#import <AppleSeal/ASLProductAccumulator.h>
+#import <AppleSeal/ASLPlainMatrix.h>
+#import <AppleSeal/ASLPreparedPlainText.h>
+#import <AppleSeal/ASLSlotPermutation.h>
+#import <AppleSeal/ASLSignApproximation.h>
+#import <AppleSeal/ASLInstrumentation.h>
+#import <AppleSeal/ASLEvaluationQueue.h>
 #import <AppleSeal/ASLKeyGenerator.h>
 #import <AppleSeal/ASLEncryptionParameterQualifiers.h>
 #import <AppleSeal/ASLNttTables.h>
@@ -63,6 +63,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly, assign) size_t slotCount;
 
+/*!
+ The maximum number of workers that encodeBatch methods encode on concurrently.
+ Defaults to the number of active processors. A value of 1 encodes batches
+ serially on the calling thread.
+ */
+@property (nonatomic, assign) NSUInteger batchConcurrency;
+
 /*!
  Creates a plaintext from a given matrix. This function "batches" a given matrix
  of integers modulo the plaintext modulus into a plaintext element, and stores
@@ -201,6 +208,100 @@ NS_ASSUME_NONNULL_BEGIN
 - (ASLPlainText* _Nullable)decodeWithPlainText:(ASLPlainText*)plainText
                                           pool:(ASLMemoryPoolHandle *)pool
                                          error:(NSError **)error;
+
+/*!
+ Creates a plaintext from a matrix stored in a buffer. Unlike encodeWithUnsignedValues,
+ values are reduced modulo the plaintext modulus rather than rejected, and they are
+ read in place: the plaintext is the only allocation. The first half of the slots
+ represent the first row of the matrix and the second half the second row; slots past
+ count are zero.
+ 
+ @param values The matrix of integers to batch
+ @param count The number of values, at most slotCount
+ @throws ASLSealErrorCodeInvalidParameter if count is larger than slotCount
+ */
+- (ASLPlainText * _Nullable)encodeUInt64Buffer:(const uint64_t *)values
+                                         count:(size_t)count
+                                         error:(NSError **)error;
+
+/*!
+ Creates a plaintext from a matrix of signed integers stored in a buffer. Negative
+ values are represented by their residues modulo the plaintext modulus, and every value
+ is reduced rather than rejected. Values are read in place, so the plaintext is the
+ only allocation. Slots past count are zero.
+ 
+ @param values The matrix of integers to batch
+ @param count The number of values, at most slotCount
+ @throws ASLSealErrorCodeInvalidParameter if count is larger than slotCount
+ */
+- (ASLPlainText * _Nullable)encodeInt64Buffer:(const int64_t *)values
+                                        count:(size_t)count
+                                        error:(NSError **)error;
+
+/*!
+ Inverse of encodeUInt64Buffer. Writes the first count slots of a plaintext into a
+ buffer as integers modulo the plaintext modulus, without boxing them. The transform
+ uses scratch space from the global memory pool.
+ 
+ @param plainText The plaintext polynomial to unbatch
+ @param destination The buffer to write count slots to
+ @param count The number of slots to write, at most slotCount
+ @throws ASLSealErrorCodeInvalidParameter if plain is not valid for the encryption parameters
+ @throws ASLSealErrorCodeInvalidParameter if plain is in NTT form
+ @throws ASLSealErrorCodeInvalidParameter if count is larger than slotCount
+ */
+- (BOOL)decodePlainText:(ASLPlainText *)plainText
+       intoUInt64Buffer:(uint64_t *)destination
+                  count:(size_t)count
+                  error:(NSError **)error;
+
+/*!
+ Inverse of encodeInt64Buffer. Writes the first count slots of a plaintext into a
+ buffer, mapping residues above half the plaintext modulus to negative integers.
+ The transform uses scratch space from the global memory pool.
+ 
+ @param plainText The plaintext polynomial to unbatch
+ @param destination The buffer to write count slots to
+ @param count The number of slots to write, at most slotCount
+ @throws ASLSealErrorCodeInvalidParameter if plain is not valid for the encryption parameters
+ @throws ASLSealErrorCodeInvalidParameter if plain is in NTT form
+ @throws ASLSealErrorCodeInvalidParameter if count is larger than slotCount
+ */
+- (BOOL)decodePlainText:(ASLPlainText *)plainText
+        intoInt64Buffer:(int64_t *)destination
+                  count:(size_t)count
+                  error:(NSError **)error;
+
+/*!
+ Creates one plaintext per slotCount values of a buffer, as encodeUInt64Buffer does
+ for each chunk, so a column of any length can be ingested in one call. The chunks
+ are encoded concurrently on up to batchConcurrency workers into plaintexts that are
+ all allocated at full size from the global pool before the workers start, so the
+ workers do not allocate. The slots of the last plaintext past the end of the
+ buffer are zero.
+ 
+ @param values The integers to batch
+ @param count The number of values
+ @return ceil(count / slotCount) plaintexts in buffer order
+ */
+- (NSArray<ASLPlainText *> * _Nullable)encodeBatchUInt64Buffer:(const uint64_t *)values
+                                                         count:(size_t)count
+                                                         error:(NSError **)error;
+
+/*!
+ Creates one plaintext per slotCount values of a buffer of signed integers, as
+ encodeInt64Buffer does for each chunk. The chunks are encoded concurrently on up
+ to batchConcurrency workers into plaintexts preallocated from the global pool, as
+ encodeBatchUInt64Buffer does. The slots of the last plaintext past the end of the
+ buffer are zero.
+ 
+ @param values The integers to batch
+ @param count The number of values
+ @return ceil(count / slotCount) plaintexts in buffer order
+ */
+- (NSArray<ASLPlainText *> * _Nullable)encodeBatchInt64Buffer:(const int64_t *)values
+                                                        count:(size_t)count
+                                                        error:(NSError **)error;
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,26 @@
+//
+//  ASLBatchEncoder_Internal.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLBatchEncoder.h"
+
+#include "seal/plaintext.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ASLBatchEncoder ()
+
+/// Encodes values as encodeUInt64Buffer:count:error: does, but into destination, reusing its
+/// allocation when it is large enough. Throws std::invalid_argument if count is larger than
+/// slotCount.
+- (void)encodeUInt64Buffer:(const uint64_t *)values
+                     count:(size_t)count
+         intoSealPlainText:(seal::Plaintext &)destination;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -40,6 +40,16 @@ NS_ASSUME_NONNULL_BEGIN
  the slots. By applying generators of the two cyclic subgroups of the Galois
  group, we can effectively enable cyclic rotations and complex conjugations
  of the encrypted complex vectors.
+ 
+ Prepared Plaintexts
+ Constants such as masks, weights and polynomial coefficients are often encoded
+ again at every use. The preparedPlainFor methods encode each distinct
+ (values, scale, parametersId) once and return the same plaintext, already in
+ NTT form, for every later request. At most preparedPlainCacheCapacity
+ plaintexts are kept; the least recently used one is evicted first. Each holds
+ N * (number of primes at parametersId) 64-bit words.
+ 
+ The cache is safe to use from multiple threads at once.
  */
 
 @interface ASLCKKSEncoder : NSObject
@@ -60,6 +70,26 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly, assign) size_t slotCount;
 
+/*!
+ The maximum number of workers that encodeBatch methods encode on concurrently.
+ Defaults to the number of active processors. A value of 1 encodes batches
+ serially on the calling thread.
+ */
+@property (nonatomic, assign) NSUInteger batchConcurrency;
+
+/// The number of prepared plaintexts kept before the least recently used is evicted.
+/// Defaults to 64; 0 disables caching.
+@property (nonatomic, assign) NSUInteger preparedPlainCacheCapacity;
+
+/// The number of prepared plaintexts currently cached
+@property (nonatomic, readonly, assign) NSUInteger preparedPlainCacheCount;
+
+/// The number of preparedPlainFor requests answered from the cache
+@property (nonatomic, readonly, assign) NSUInteger preparedPlainCacheHitCount;
+
+/// The number of preparedPlainFor requests that had to encode
+@property (nonatomic, readonly, assign) NSUInteger preparedPlainCacheMissCount;
+
 /*!
  Encodes a vector of double-precision floating-point real or complex numbers
  into a plaintext polynomial. Append zeros if vector size is less than N/2.
@@ -478,6 +508,244 @@ for the encryption parameters
 - (NSArray<ASLComplexType *> * _Nullable)decodeComplexDoubleValues:(ASLPlainText *)plainText
                                                               pool:(ASLMemoryPoolHandle *)pool
                                                              error:(NSError **)error;
+
+/*!
+ Encodes a buffer of double-precision floating-point real numbers into a
+ plaintext polynomial without creating an object per value. Append zeros
+ if count is less than N/2.
+ 
+ @param values The buffer of count double-precision floating-point numbers to encode
+ @param count The number of values to encode, at most slotCount
+ @param scale Scaling parameter defining encoding precision
+ @param parametersId parms_id determining the encryption parameters to
+ be used by the result plaintext
+ @throws ASL_SealInvalidParameter if count is larger than slotCount
+ @throws ASL_SealInvalidParameter if parms_id is not valid for the encryption
+ parameters
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ */
+- (ASLPlainText * _Nullable)encodeDoubles:(const double *)values
+                                    count:(size_t)count
+                                    scale:(double)scale
+                             parametersId:(ASLParametersIdType)parametersId
+                                    error:(NSError **)error;
+
+/*!
+ Encodes a buffer of double-precision floating-point real numbers into a
+ plaintext polynomial without creating an object per value. Append zeros
+ if count is less than N/2. The encryption parameters used are the top
+ level parameters for the given context.
+ 
+ @param values The buffer of count double-precision floating-point numbers to encode
+ @param count The number of values to encode, at most slotCount
+ @param scale Scaling parameter defining encoding precision
+ @throws ASL_SealInvalidParameter if count is larger than slotCount
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ */
+- (ASLPlainText * _Nullable)encodeDoubles:(const double *)values
+                                    count:(size_t)count
+                                    scale:(double)scale
+                                    error:(NSError **)error;
+
+/*!
+ Encodes a buffer of interleaved complex numbers into a plaintext polynomial
+ without creating an object per value. Append zeros if count is less than N/2.
+ 
+ @param values The buffer of 2 * count doubles holding the real and imaginary
+ part of each complex number in turn
+ @param count The number of complex numbers to encode, at most slotCount
+ @param scale Scaling parameter defining encoding precision
+ @param parametersId parms_id determining the encryption parameters to
+ be used by the result plaintext
+ @throws ASL_SealInvalidParameter if count is larger than slotCount
+ @throws ASL_SealInvalidParameter if parms_id is not valid for the encryption
+ parameters
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ */
+- (ASLPlainText * _Nullable)encodeComplexDoubles:(const double *)values
+                                           count:(size_t)count
+                                           scale:(double)scale
+                                    parametersId:(ASLParametersIdType)parametersId
+                                           error:(NSError **)error;
+
+/*!
+ Encodes a buffer of interleaved complex numbers into a plaintext polynomial
+ without creating an object per value. Append zeros if count is less than N/2.
+ The encryption parameters used are the top level parameters for the given
+ context.
+ 
+ @param values The buffer of 2 * count doubles holding the real and imaginary
+ part of each complex number in turn
+ @param count The number of complex numbers to encode, at most slotCount
+ @param scale Scaling parameter defining encoding precision
+ @throws ASL_SealInvalidParameter if count is larger than slotCount
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ */
+- (ASLPlainText * _Nullable)encodeComplexDoubles:(const double *)values
+                                           count:(size_t)count
+                                           scale:(double)scale
+                                           error:(NSError **)error;
+
+/*!
+ Decodes a plaintext polynomial into a buffer of double-precision
+ floating-point real numbers without creating an object per value.
+ The first MIN(capacity, slotCount) slots are written.
+ 
+ @param plainText The plaintext to decode
+ @param destination The buffer to write the decoded values to
+ @param capacity The number of doubles destination can hold
+ @throws ASLInvalidParameter if plain is not in NTT form or is invalid
+ for the encryption parameters
+ */
+- (BOOL)decodeDoubles:(ASLPlainText *)plainText
+                 into:(double *)destination
+             capacity:(size_t)capacity
+                error:(NSError **)error;
+
+/*!
+ Decodes a plaintext polynomial into a buffer of interleaved complex
+ numbers without creating an object per value. The first
+ MIN(capacity, slotCount) slots are written, each as its real part
+ followed by its imaginary part.
+ 
+ @param plainText The plaintext to decode
+ @param destination The buffer of 2 * capacity doubles to write the decoded values to
+ @param capacity The number of complex numbers destination can hold
+ @throws ASLInvalidParameter if plain is not in NTT form or is invalid
+ for the encryption parameters
+ */
+- (BOOL)decodeComplexDoubles:(ASLPlainText *)plainText
+                        into:(double *)destination
+                    capacity:(size_t)capacity
+                       error:(NSError **)error;
+
+/*!
+ Creates one plaintext per slotCount values of a buffer, as encodeDoubles does for
+ each chunk, so a column of any length can be ingested in one call. The chunks are
+ encoded concurrently on up to batchConcurrency workers into plaintexts that are
+ all allocated at full size from the global pool before the workers start. Each
+ worker allocates only its encoding temporaries, from its own memory pool. The last
+ plaintext is zero-padded.
+ 
+ @param values The buffer of count double-precision floating-point numbers to encode
+ @param count The number of values
+ @param scale Scaling parameter defining encoding precision
+ @param parametersId parms_id determining the encryption parameters to
+ be used by the result plaintexts
+ @return ceil(count / slotCount) plaintexts in buffer order
+ @throws ASL_SealInvalidParameter if parms_id is not valid for the encryption
+ parameters
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ */
+- (NSArray<ASLPlainText *> * _Nullable)encodeBatchDoubles:(const double *)values
+                                                    count:(size_t)count
+                                                    scale:(double)scale
+                                             parametersId:(ASLParametersIdType)parametersId
+                                                    error:(NSError **)error;
+
+/*!
+ Creates one plaintext per slotCount values of a buffer at the top level
+ parameters of the context, encoding the chunks concurrently as
+ encodeBatchDoubles:count:scale:parametersId:error: does.
+ 
+ @param values The buffer of count double-precision floating-point numbers to encode
+ @param count The number of values
+ @param scale Scaling parameter defining encoding precision
+ @return ceil(count / slotCount) plaintexts in buffer order
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ */
+- (NSArray<ASLPlainText *> * _Nullable)encodeBatchDoubles:(const double *)values
+                                                    count:(size_t)count
+                                                    scale:(double)scale
+                                                    error:(NSError **)error;
+
+/*!
+ Returns a plaintext encoding value in every slot, as encodeWithDoubleValue:
+ does, taking it from the cache when the same value, scale and parametersId
+ were requested before.
+ 
+ The returned plaintext is shared with later requests and must not be modified.
+ If it is, the cache discards it and encodes the value again.
+ 
+ @param value The double-precision floating-point number to encode
+ @param scale Scaling parameter defining encoding precision
+ @param parametersId parms_id determining the encryption parameters to
+ be used by the result plaintext
+ @throws ASL_SealInvalidParameter if parms_id is not valid for the encryption
+ parameters
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ */
+- (ASLPlainText * _Nullable)preparedPlainForValue:(double)value
+                                            scale:(double)scale
+                                     parametersId:(ASLParametersIdType)parametersId
+                                            error:(NSError **)error;
+
+/*!
+ Returns a plaintext encoding values, as encodeWithDoubleValues: does, taking
+ it from the cache when the same values, scale and parametersId were requested
+ before.
+ 
+ The returned plaintext is shared with later requests and must not be modified.
+ If it is, the cache discards it and encodes the values again.
+ 
+ @param values The vector of double-precision floating-point numbers to encode
+ @param scale Scaling parameter defining encoding precision
+ @param parametersId parms_id determining the encryption parameters to
+ be used by the result plaintext
+ @throws ASL_SealInvalidParameter if values has invalid size
+ @throws ASL_SealInvalidParameter if parms_id is not valid for the encryption
+ parameters
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ */
+- (ASLPlainText * _Nullable)preparedPlainForValues:(NSArray<NSNumber *> *)values
+                                             scale:(double)scale
+                                      parametersId:(ASLParametersIdType)parametersId
+                                             error:(NSError **)error;
+
+/*!
+ Returns a plaintext encoding a buffer of values, as encodeDoubles: does,
+ taking it from the cache when the same values, scale and parametersId were
+ requested before.
+ 
+ The returned plaintext is shared with later requests and must not be modified.
+ If it is, the cache discards it and encodes the values again.
+ 
+ @param values The buffer of count double-precision floating-point numbers to encode
+ @param count The number of values to encode, at most slotCount
+ @param scale Scaling parameter defining encoding precision
+ @param parametersId parms_id determining the encryption parameters to
+ be used by the result plaintext
+ @throws ASL_SealInvalidParameter if count is larger than slotCount
+ @throws ASL_SealInvalidParameter if parms_id is not valid for the encryption
+ parameters
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ */
+- (ASLPlainText * _Nullable)preparedPlainForDoubles:(const double *)values
+                                              count:(size_t)count
+                                              scale:(double)scale
+                                       parametersId:(ASLParametersIdType)parametersId
+                                              error:(NSError **)error;
+
+/// Evicts every cached prepared plaintext
+- (void)removeAllPreparedPlains;
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,27 @@
+//
+//  ASLCKKSEncoder_Internal.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLCKKSEncoder.h"
+
+#include "seal/plaintext.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ASLCKKSEncoder ()
+
+/// Encodes values at the top level parameters as encodeDoubles:count:scale:error: does, but
+/// into destination, reusing its allocation when it is large enough. Throws
+/// std::invalid_argument if the values cannot be encoded.
+- (void)encodeDoubles:(const double *)values
+                count:(size_t)count
+                scale:(double)scale
+    intoSealPlainText:(seal::Plaintext &)destination;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -18,6 +18,18 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, assign, readonly) seal::Ciphertext sealCipherText;
 
 - (instancetype)initWithCipherText:(seal::Ciphertext)cipherText;
+
+/// Returns a reference to the ciphertext backing the receiver without copying it.
+- (seal::Ciphertext const &)sealCipherTextReference;
+
+/// Returns a mutable reference to the ciphertext backing the receiver. In-place
+/// evaluator operations write through it so the receiver is updated directly.
+- (seal::Ciphertext &)mutableSealCipherText;
+
+/// Incremented whenever the ciphertext backing the receiver may have been modified, so
+/// values derived from it can be recognised as stale.
+@property (nonatomic, readonly, assign) NSUInteger mutationCount;
+
 @end
 
 @interface ASLSerializableCipherText ()
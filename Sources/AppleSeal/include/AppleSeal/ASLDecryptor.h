@@ -11,6 +11,7 @@
 #import "ASLSealContext.h"
 #import "ASLSecretKey.h"
 #import "ASLCipherText.h"
+#import "ASLInstrumentation.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -61,6 +62,13 @@ NS_ASSUME_NONNULL_BEGIN
 + (instancetype _Nullable)decryptorWithContext:(ASLSealContext *)context
                                      secretKey:(ASLSecretKey *)secretKey
                                          error:(NSError **)error;
+
+/*!
+ The instrumentation that records the calls of the receiver's public methods, or nil
+ to record nothing. Defaults to nil. See ASLInstrumentation.
+ */
+@property (nonatomic, strong, nullable) ASLInstrumentation *instrumentation;
+
 /*!
  Decrypts a Ciphertext and stores the result in the destination parameter.
  
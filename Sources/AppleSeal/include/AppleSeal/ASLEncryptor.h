@@ -12,6 +12,9 @@
 #import "ASLPublicKey.h"
 #import "ASLSecretKey.h"
 #import "ASLParametersIdType.h"
+#import "ASLInstrumentation.h"
+#import "ASLBatchEncoder.h"
+#import "ASLCKKSEncoder.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -97,6 +100,12 @@ NS_ASSUME_NONNULL_BEGIN
                                      secretKey:(ASLSecretKey *)secretKey
                                          error:(NSError **)error;
 
+/*!
+ The instrumentation that records the calls of the receiver's public methods, or nil
+ to record nothing. Defaults to nil. See ASLInstrumentation.
+ */
+@property (nonatomic, strong, nullable) ASLInstrumentation *instrumentation;
+
 /*!
  Encrypts a plaintext with the public key and stores the result in
  destination. The encryption parameters for the resulting ciphertext
@@ -455,6 +464,92 @@ NS_ASSUME_NONNULL_BEGIN
  */
 -(ASLSerializableCipherText * _Nullable)encryptSerializableZeroSymmetricWithError:(NSError **)error;
 
+/*!
+ Batches a buffer of integers and encrypts it with the public key into
+ destination, without creating an intermediate ASLPlainText. The values are
+ encoded as encodeUInt64Buffer:count:error: does, into a scratch plaintext the
+ receiver reuses across calls. The resulting ciphertext is at the highest
+ (data) level in the modulus switching chain.
+ 
+ @param values The matrix of integers to batch, reduced modulo the plaintext modulus
+ @param count The number of values, at most slotCount of encoder
+ @param encoder The batch encoder to encode with, created with the receiver's context
+ @param destination The ciphertext to overwrite with the result
+ @throws ASL_SealInvalidParameter if count is larger than slotCount
+ @throws ASL_SealLogicError if a public key is not set
+ */
+- (BOOL)encryptUInt64Buffer:(const uint64_t *)values
+                      count:(size_t)count
+                    encoder:(ASLBatchEncoder *)encoder
+                       into:(ASLCipherText *)destination
+                      error:(NSError **)error;
+
+/*!
+ Batches a buffer of integers and encrypts it with the secret key into
+ destination, as encryptUInt64Buffer:count:encoder:into:error: does with the
+ public key.
+ 
+ @param values The matrix of integers to batch, reduced modulo the plaintext modulus
+ @param count The number of values, at most slotCount of encoder
+ @param encoder The batch encoder to encode with, created with the receiver's context
+ @param destination The ciphertext to overwrite with the result
+ @throws ASL_SealInvalidParameter if count is larger than slotCount
+ @throws ASL_SealLogicError if a secret key is not set
+ */
+- (BOOL)encryptSymmetricUInt64Buffer:(const uint64_t *)values
+                               count:(size_t)count
+                             encoder:(ASLBatchEncoder *)encoder
+                                into:(ASLCipherText *)destination
+                               error:(NSError **)error;
+
+/*!
+ Encodes a buffer of double-precision floating-point numbers and encrypts it
+ with the public key into destination, without creating an intermediate
+ ASLPlainText. The values are encoded at the top level parameters, as
+ encodeDoubles:count:scale:error: does, into a scratch plaintext the receiver
+ reuses across calls.
+ 
+ @param values The buffer of count double-precision floating-point numbers to encode
+ @param count The number of values, at most slotCount of encoder
+ @param scale Scaling parameter defining encoding precision
+ @param encoder The CKKS encoder to encode with, created with the receiver's context
+ @param destination The ciphertext to overwrite with the result
+ @throws ASL_SealInvalidParameter if count is larger than slotCount
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ @throws ASL_SealLogicError if a public key is not set
+ */
+- (BOOL)encryptDoubles:(const double *)values
+                 count:(size_t)count
+                 scale:(double)scale
+               encoder:(ASLCKKSEncoder *)encoder
+                  into:(ASLCipherText *)destination
+                 error:(NSError **)error;
+
+/*!
+ Encodes a buffer of double-precision floating-point numbers and encrypts it
+ with the secret key into destination, as
+ encryptDoubles:count:scale:encoder:into:error: does with the public key.
+ 
+ @param values The buffer of count double-precision floating-point numbers to encode
+ @param count The number of values, at most slotCount of encoder
+ @param scale Scaling parameter defining encoding precision
+ @param encoder The CKKS encoder to encode with, created with the receiver's context
+ @param destination The ciphertext to overwrite with the result
+ @throws ASL_SealInvalidParameter if count is larger than slotCount
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if encoding is too large for the encryption
+ parameters
+ @throws ASL_SealLogicError if a secret key is not set
+ */
+- (BOOL)encryptSymmetricDoubles:(const double *)values
+                          count:(size_t)count
+                          scale:(double)scale
+                        encoder:(ASLCKKSEncoder *)encoder
+                           into:(ASLCipherText *)destination
+                          error:(NSError **)error;
+
 /*!
  Give a new instance of public key.
  
@@ -0,0 +1,236 @@
+//
+//  ASLEvaluationGraph.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "ASLCipherText.h"
+#import "ASLPlainText.h"
+#import "ASLEvaluator.h"
+#import "ASLRelinearizationKeys.h"
+#import "ASLGaloisKeys.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ASLEvaluationGraph;
+
+/*!
+ @class ASLEvaluationNode
+
+ @brief A handle to a value recorded in an ASLEvaluationGraph
+
+ @discussion Nodes are created by the recording methods of ASLEvaluationGraph and can
+ only be used as operands of, or outputs requested from, the graph that created them.
+ A node does not hold a ciphertext; its value is computed when the graph is evaluated.
+ */
+@interface ASLEvaluationNode : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The position of the node in the order it was recorded
+@property (nonatomic, readonly, assign) NSUInteger index;
+
+@end
+
+/*!
+ @class ASLEvaluationGraph
+
+ @brief Records a circuit of evaluator operations and executes it lazily
+
+ @discussion Instead of executing each operation eagerly, the graph records
+ it as a node of a directed acyclic graph. Nothing is computed until a result
+ is requested with evaluate, at which point the graph is planned and run on the
+ evaluator it was created with.
+
+ Planning
+ Only the nodes that the requested outputs depend on are executed; every other
+ recorded node is dropped. When optimization is enabled the planner also:
+
+ - Hoists relinearization over addition and subtraction, so a sum of relinearized
+ products becomes one relinearization of the sum of products.
+ - Hoists rescaling over addition and subtraction in the same way, so a sum of
+ rescaled operands is rescaled once.
+ - Moves relinearization after a rescale or modulus switch of its result, so the
+ key switch runs at the lower level.
+ - Skips relinearization of ciphertexts that already have size 2.
+
+ These rewrites only apply to intermediate nodes with a single consumer that are
+ not themselves requested as outputs, so the values of all requested outputs are
+ unchanged.
+
+ Execution
+ Nodes are grouped into waves by their depth in the graph. The nodes of a wave are
+ independent and run concurrently on up to batchConcurrency workers of the evaluator,
+ each allocating its temporaries from its own memory pool. Node results are allocated
+ from the global pool. An intermediate result that has a single consumer is moved
+ into that consumer and updated in place instead of being copied.
+
+ When the evaluator has an instrumentation, each evaluation is recorded in it as one
+ evaluateOutputs:error: call of ASLEvaluationGraph with the graph inputs as input;
+ the individual nodes are not recorded.
+
+ Thread Safety
+ Recording operations is not thread-safe. Input ciphertexts and plaintexts are read
+ when the graph is evaluated, so they must not be mutated during evaluation.
+ */
+@interface ASLEvaluationGraph : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ Creates an empty graph that executes on the given evaluator.
+
+ @param evaluator The evaluator that runs the recorded operations
+ */
++ (instancetype)graphWithEvaluator:(ASLEvaluator *)evaluator;
+
+/// The relinearization keys used by relinearize nodes
+@property (nonatomic, strong, nullable) ASLRelinearizationKeys *relinearizationKeys;
+
+/// The Galois keys used by rotation nodes
+@property (nonatomic, strong, nullable) ASLGaloisKeys *galoisKeys;
+
+/// Whether evaluation rewrites the graph to remove relinearizations and rescales. Defaults to YES.
+@property (nonatomic, assign, getter=isOptimizationEnabled) BOOL optimizationEnabled;
+
+/// The number of nodes recorded so far
+@property (nonatomic, readonly, assign) NSUInteger nodeCount;
+
+/*!
+ Records a ciphertext as an input of the graph.
+
+ @param encrypted The input ciphertext
+ */
+- (ASLEvaluationNode *)input:(ASLCipherText *)encrypted;
+
+/*!
+ Records the negation of a node.
+
+ @param encrypted The node to negate
+ */
+- (ASLEvaluationNode *)negate:(ASLEvaluationNode *)encrypted;
+
+/*!
+ Records the sum of two nodes.
+
+ @param encrypted1 The first node to add
+ @param encrypted2 The second node to add
+ */
+- (ASLEvaluationNode *)add:(ASLEvaluationNode *)encrypted1
+                encrypted2:(ASLEvaluationNode *)encrypted2;
+
+/*!
+ Records the difference of two nodes.
+
+ @param encrypted1 The node to subtract from
+ @param encrypted2 The node to subtract
+ */
+- (ASLEvaluationNode *)sub:(ASLEvaluationNode *)encrypted1
+                encrypted2:(ASLEvaluationNode *)encrypted2;
+
+/*!
+ Records the product of two nodes. The product is not relinearized.
+
+ @param encrypted1 The first node to multiply
+ @param encrypted2 The second node to multiply
+ */
+- (ASLEvaluationNode *)multiply:(ASLEvaluationNode *)encrypted1
+                     encrypted2:(ASLEvaluationNode *)encrypted2;
+
+/*!
+ Records the square of a node. The square is not relinearized.
+
+ @param encrypted The node to square
+ */
+- (ASLEvaluationNode *)square:(ASLEvaluationNode *)encrypted;
+
+/*!
+ Records the sum of a node and a plaintext.
+
+ @param encrypted The node to add to
+ @param plain The plaintext to add
+ */
+- (ASLEvaluationNode *)addPlain:(ASLEvaluationNode *)encrypted
+                          plain:(ASLPlainText *)plain;
+
+/*!
+ Records the product of a node and a plaintext.
+
+ @param encrypted The node to multiply
+ @param plain The plaintext to multiply with
+ */
+- (ASLEvaluationNode *)multiplyPlain:(ASLEvaluationNode *)encrypted
+                               plain:(ASLPlainText *)plain;
+
+/*!
+ Records the relinearization of a node using relinearizationKeys.
+
+ @param encrypted The node to relinearize
+ */
+- (ASLEvaluationNode *)relinearize:(ASLEvaluationNode *)encrypted;
+
+/*!
+ Records rescaling a node to the next level of the modulus switching chain.
+
+ @param encrypted The node to rescale
+ */
+- (ASLEvaluationNode *)rescaleToNext:(ASLEvaluationNode *)encrypted;
+
+/*!
+ Records switching a node to the next level of the modulus switching chain.
+
+ @param encrypted The node to switch
+ */
+- (ASLEvaluationNode *)modSwitchToNext:(ASLEvaluationNode *)encrypted;
+
+/*!
+ Records a BFV row rotation of a node using galoisKeys.
+
+ @param encrypted The node to rotate
+ @param steps The number of steps to rotate (negative left, positive right)
+ */
+- (ASLEvaluationNode *)rotateRows:(ASLEvaluationNode *)encrypted
+                            steps:(int)steps;
+
+/*!
+ Records a CKKS vector rotation of a node using galoisKeys.
+
+ @param encrypted The node to rotate
+ @param steps The number of steps to rotate (negative left, positive right)
+ */
+- (ASLEvaluationNode *)rotateVector:(ASLEvaluationNode *)encrypted
+                              steps:(int)steps;
+
+/*!
+ Plans and executes the part of the graph that the output depends on and
+ returns its value.
+
+ @param output The node to compute
+ @throws ASL_SealInvalidParameter if a required key set is not set
+ @throws ASL_SealInvalidParameter or ASL_SealLogicError if a recorded operation
+ fails, as the corresponding ASLEvaluator method would
+ */
+- (ASLCipherText * _Nullable)evaluate:(ASLEvaluationNode *)output
+                                error:(NSError **)error;
+
+/*!
+ Plans and executes the part of the graph that the outputs depend on and
+ returns their values in the same order. Shared subexpressions are computed once.
+
+ @param outputs The nodes to compute
+ @throws ASL_SealInvalidParameter if a required key set is not set
+ @throws ASL_SealInvalidParameter or ASL_SealLogicError if a recorded operation
+ fails, as the corresponding ASLEvaluator method would
+ */
+- (NSArray<ASLCipherText *> * _Nullable)evaluateOutputs:(NSArray<ASLEvaluationNode *> *)outputs
+                                                  error:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,129 @@
+//
+//  ASLEvaluationQueue.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+extern NSString * const ASLEvaluationQueueErrorDomain;
+
+typedef NS_ENUM(NSInteger, ASLEvaluationQueueErrorCode) {
+    /// The task was cancelled before it finished
+    ASLEvaluationQueueErrorCodeCancelled = 1,
+    /// The queue already held as many waiting tasks as its capacity allows
+    ASLEvaluationQueueErrorCodeFull,
+};
+
+/// The order in which waiting tasks are started. Tasks of the same priority start in
+/// the order they were submitted.
+typedef NS_ENUM(NSInteger, ASLEvaluationPriority) {
+    ASLEvaluationPriorityLow = 0,
+    ASLEvaluationPriorityNormal,
+    ASLEvaluationPriorityHigh,
+};
+
+/*!
+ @class ASLEvaluationTask
+
+ @brief A handle to work submitted to an ASLEvaluationQueue
+
+ @discussion A task is waiting until one of the queue's workers starts it, then running
+ until its block returns. Cancelling a waiting task removes it from the queue so its
+ block never runs. Cancelling a running task does not interrupt the homomorphic
+ operation in progress, but its result is discarded.
+ */
+@interface ASLEvaluationTask : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The priority the task was submitted with
+@property (nonatomic, readonly, assign) ASLEvaluationPriority priority;
+
+/// Whether cancel succeeded before the task finished
+@property (nonatomic, readonly, assign, getter=isCancelled) BOOL cancelled;
+
+/// Whether the task ran to completion without being cancelled
+@property (nonatomic, readonly, assign, getter=isFinished) BOOL finished;
+
+/*!
+ Cancels the task and calls its cancellation handler, unless the task has already
+ finished or been cancelled.
+
+ @return YES if the task was cancelled by this call
+ */
+- (BOOL)cancel;
+
+@end
+
+/*!
+ @class ASLEvaluationQueue
+
+ @brief A bounded executor for homomorphic operations
+
+ @discussion Runs submitted tasks on at most maximumConcurrentTasks background workers,
+ highest priority first. At most capacity tasks may wait to be started; submitting
+ beyond that fails immediately with ASLEvaluationQueueErrorCodeFull instead of
+ blocking, so callers can shed or defer load while the queue is saturated.
+
+ Workers run at the utility quality of service. Blocks and completion handlers are
+ called on those workers; a cancellation handler is called on the thread that cancels
+ the task. A queue stays alive while it has waiting or running tasks.
+ */
+@interface ASLEvaluationQueue : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ Creates a queue.
+
+ @param maximumConcurrentTasks The number of tasks that may run at once, at least 1
+ @param capacity The number of tasks that may wait to be started, at least 1
+ */
++ (instancetype)queueWithMaximumConcurrentTasks:(NSUInteger)maximumConcurrentTasks
+                                       capacity:(NSUInteger)capacity;
+
+/// A queue with one worker per active processor and a capacity of 1024, used by
+/// evaluators that have no evaluationQueue of their own
+@property (class, nonatomic, readonly, strong) ASLEvaluationQueue *defaultQueue;
+
+/// The number of tasks that may run at once
+@property (nonatomic, readonly, assign) NSUInteger maximumConcurrentTasks;
+
+/// The number of tasks that may wait to be started
+@property (nonatomic, readonly, assign) NSUInteger capacity;
+
+/// The number of tasks waiting to be started
+@property (nonatomic, readonly, assign) NSUInteger waitingTaskCount;
+
+/// The number of tasks running
+@property (nonatomic, readonly, assign) NSUInteger runningTaskCount;
+
+/*!
+ Submits a block to run on one of the queue's workers.
+
+ @param priority The priority of the task
+ @param block The work to perform
+ @param cancellationHandler Called once if the task is cancelled before it finishes
+ @throws ASLEvaluationQueueErrorCodeFull if capacity tasks are already waiting
+ */
+- (ASLEvaluationTask * _Nullable)submitWithPriority:(ASLEvaluationPriority)priority
+                                              block:(void (^)(ASLEvaluationTask *task))block
+                                cancellationHandler:(void (^ _Nullable)(void))cancellationHandler
+                                              error:(NSError **)error;
+
+/// Cancels every waiting and running task
+- (void)cancelAllTasks;
+
+/// Blocks the calling thread until no task is waiting or running
+- (void)waitUntilAllTasksAreFinished;
+
+@end
+
+NS_ASSUME_NONNULL_END
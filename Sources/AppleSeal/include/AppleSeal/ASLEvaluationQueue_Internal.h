@@ -0,0 +1,24 @@
+//
+//  ASLEvaluationQueue_Internal.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLEvaluationQueue.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ASLEvaluationTask ()
+
+/// Marks a running task as finished so it can no longer be cancelled. Returns NO if the task
+/// was cancelled first, in which case its cancellation handler has been or is being called.
+- (BOOL)markFinished;
+
+@end
+
+/// Returns the error reported for a task that was cancelled.
+NSError *ASLEvaluationCancelledError(void);
+
+NS_ASSUME_NONNULL_END
@@ -13,9 +13,19 @@
 #import "ASLMemoryPoolHandle.h"
 #import "ASLRelinearizationKeys.h"
 #import "ASLGaloisKeys.h"
+#import "ASLPlainMatrix.h"
+#import "ASLPreparedPlainText.h"
+#import "ASLSlotPermutation.h"
+#import "ASLSignApproximation.h"
+#import "ASLInstrumentation.h"
+#import "ASLEvaluationQueue.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// Receives the result of an asynchronous operation, or the error that it threw or that
+/// cancelled it
+typedef void (^ASLEvaluationCompletionHandler)(ASLCipherText * _Nullable result, NSError * _Nullable error);
+
 /*!
  @class ASLEncryptor
  
@@ -59,6 +69,50 @@ NS_ASSUME_NONNULL_BEGIN
  rows cyclically left or right, and for rotating the columns (swapping the rows).
  Rotations require Galois keys to have been generated.
  
+ In-place Operations
+ Methods with an Inplace suffix operate directly on the ciphertext (or plaintext)
+ passed as their first argument. Its backing storage is updated without being
+ copied and the same instance is returned, so no new wrapper is allocated. Keep
+ a copy of the operand around if its original value is still needed.
+ 
+ Destination Operations
+ Methods with an into: argument write their result into a caller-supplied
+ ciphertext or plaintext and return whether they succeeded. The destination's
+ backing storage is reused when it is large enough, so a loop that writes into
+ the same destination only allocates on its first iteration.
+ 
+ Automatic Alignment
+ CKKS ciphertexts can only be combined at the same level, and added or subtracted
+ at the same scale. When automaticAlignmentEnabled is set, add, sub and multiply
+ bring their operands to a common level first by mod-switching the operand at the
+ higher level down. add and sub also match scales: an operand whose scale is one
+ rescale away from the other's is rescaled, and any other scale mismatch is
+ corrected with a multiplication by one that costs a level. A mismatch that would
+ need one to be encoded at a scale below 1 throws ASL_SealInvalidParameter. The
+ plain variants only bring the ciphertext and an NTT
+ form plaintext to the lower of their levels and make scales that differ by
+ rescaling error identical; other scale mismatches throw as in SEAL. Switched
+ copies of read-only operands are cached per operand and level, so reusing an
+ operand does not switch it again; the first operand of an Inplace method is
+ switched in place.
+ 
+ Batch Operations
+ Methods with a Batch suffix apply one operation to every ciphertext in an array.
+ The array is split into contiguous ranges that are evaluated concurrently on
+ up to batchConcurrency workers. Each worker allocates its temporaries from its
+ own memory pool, so workers do not contend on the global pool, and the results
+ are allocated from the global pool.
+ 
+ Asynchronous Operations
+ Methods with priority and completionHandler arguments submit the operation to
+ evaluationQueue and return immediately with a task that can cancel it. The
+ completion handler is called exactly once on a worker of the queue, with the
+ result or error of the operation, or with ASLEvaluationQueueErrorCodeCancelled
+ on the cancelling thread if the task is cancelled first. When the queue is
+ full the method returns nil with ASLEvaluationQueueErrorCodeFull and the
+ completion handler is never called. Operands are read when the operation
+ runs, so they must not be mutated until the completion handler is called.
+ 
  Other Operations
  We also provide operations for transforming ciphertexts to NTT form and back,
  and for transforming plaintext polynomials to NTT form. These can be used in
@@ -101,10 +155,63 @@ NS_ASSUME_NONNULL_BEGIN
 + (instancetype _Nullable)evaluatorWith:(ASLSealContext *)context
                                   error:(NSError **)error;
 
+/*!
+ The maximum number of workers that batch operations run on concurrently.
+ Defaults to the number of active processors. A value of 1 evaluates batches
+ serially on the calling thread.
+ */
+@property (nonatomic, assign) NSUInteger batchConcurrency;
+
+/*!
+ Whether add, sub, multiply and their plain variants bring their operands to a
+ common level and scale before evaluating, as described in Automatic Alignment.
+ Defaults to NO, in which case mismatched operands throw as in SEAL.
+ */
+@property (nonatomic, assign, getter=isAutomaticAlignmentEnabled) BOOL automaticAlignmentEnabled;
+
+/*!
+ The instrumentation that records the calls of the receiver's public methods, or nil
+ to record nothing. Defaults to nil. See ASLInstrumentation.
+ */
+@property (nonatomic, strong, nullable) ASLInstrumentation *instrumentation;
+
+/*!
+ The queue that asynchronous operations are submitted to. Defaults to nil, in which
+ case ASLEvaluationQueue.defaultQueue is used. See Asynchronous Operations.
+ */
+@property (nonatomic, strong, nullable) ASLEvaluationQueue *evaluationQueue;
+
+/// The number of switched copies kept by automatic alignment before the least recently
+/// used is evicted. Defaults to 16; 0 disables caching.
+@property (nonatomic, assign) NSUInteger alignedOperandCacheCapacity;
+
+/// The number of switched copies currently cached by automatic alignment
+@property (nonatomic, readonly, assign) NSUInteger alignedOperandCacheCount;
+
+/*!
+ Releases the switched copies of operands cached by automatic alignment. A cached
+ copy is never returned once its operand is modified or deallocated, and is
+ released when it is evicted.
+ */
+-(void)removeAllAlignedOperands;
 
+/*!
+ Negates a ciphertext and returns the result, leaving encrypted unchanged.
+ 
+ @param encrypted The ciphertext to negate
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption
+ parameters
+ */
 -(ASLCipherText * _Nullable)negate:(ASLCipherText *)encrypted
                              error:(NSError **)error;
 
+/*!
+ Same as negate:error:, writing the result into destination.
+ */
+-(BOOL)negate:(ASLCipherText *)encrypted
+         into:(ASLCipherText *)destination
+        error:(NSError **)error;
+
 /*!
  Negates a ciphertext.
  
@@ -149,9 +256,19 @@ NS_ASSUME_NONNULL_BEGIN
                      encrypted2:(ASLCipherText *)encrypted2
                           error:(NSError **)error;
 
+/*!
+ Same as add:encrypted2:error:, writing the result into destination.
+ */
+-(BOOL)add:(ASLCipherText *)encrypted1
+encrypted2:(ASLCipherText *)encrypted2
+      into:(ASLCipherText *)destination
+     error:(NSError **)error;
+
 /*!
  Adds together a vector of ciphertexts and stores the result in the destination
- parameter.
+ parameter. The ciphertexts are read without being copied: each of batchConcurrency
+ workers sums a contiguous run of them, and the partial sums are combined as a
+ balanced tree.
  
  @param encrypteds The ciphertexts to add
  @throws ASL_SealInvalidParameter if encrypteds is empty
@@ -165,6 +282,13 @@ NS_ASSUME_NONNULL_BEGIN
 -(ASLCipherText * _Nullable)addMany:(NSArray<ASLCipherText *> *)encrypteds
                               error:(NSError **)error;
 
+/*!
+ Same as addMany:error:, writing the result into destination.
+ */
+-(BOOL)addMany:(NSArray<ASLCipherText *> *)encrypteds
+          into:(ASLCipherText *)destination
+         error:(NSError **)error;
+
 /*!
  Subtracts two ciphertexts. This function computes the difference of encrypted1
  and encrypted2, and stores the result in encrypted1.
@@ -199,6 +323,14 @@ NS_ASSUME_NONNULL_BEGIN
                      encrypted2:(ASLCipherText *)encrypted2
                           error:(NSError **)error;
 
+/*!
+ Same as sub:encrypted2:error:, writing the result into destination.
+ */
+-(BOOL)sub:(ASLCipherText *)encrypted1
+encrypted2:(ASLCipherText *)encrypted2
+      into:(ASLCipherText *)destination
+     error:(NSError **)error;
+
 /*!
  Multiplies two ciphertexts. This functions computes the product of encrypted1
  and encrypted2 and stores the result in encrypted1. Dynamic memory allocations
@@ -260,6 +392,15 @@ NS_ASSUME_NONNULL_BEGIN
                                 pool:(ASLMemoryPoolHandle *)pool
                                error:(NSError **)error;
 
+/*!
+ Same as multiply:encrypted2:pool:error:, writing the result into destination.
+ */
+-(BOOL)multiply:(ASLCipherText *)encrypted1
+     encrypted2:(ASLCipherText *)encrypted2
+           into:(ASLCipherText *)destination
+           pool:(ASLMemoryPoolHandle *)pool
+          error:(NSError **)error;
+
 /*!
  Multiplies two ciphertexts. This functions computes the product of encrypted1
  and encrypted2 and stores the result in the destination parameter. Dynamic
@@ -280,6 +421,14 @@ NS_ASSUME_NONNULL_BEGIN
                           encrypted2:(ASLCipherText *)encrypted2
                                error:(NSError **)error;
 
+/*!
+ Same as multiply:encrypted2:error:, writing the result into destination.
+ */
+-(BOOL)multiply:(ASLCipherText *)encrypted1
+     encrypted2:(ASLCipherText *)encrypted2
+           into:(ASLCipherText *)destination
+          error:(NSError **)error;
+
 /*!
  Squares a ciphertext. This functions computes the square of encrypted. Dynamic
  memory allocations in the process are allocated from the memory pool pointed
@@ -335,6 +484,14 @@ NS_ASSUME_NONNULL_BEGIN
                               pool:(ASLMemoryPoolHandle *)pool
                              error:(NSError **)error;
 
+/*!
+ Same as square:pool:error:, writing the result into destination.
+ */
+-(BOOL)square:(ASLCipherText *)encrypted
+         into:(ASLCipherText *)destination
+         pool:(ASLMemoryPoolHandle *)pool
+        error:(NSError **)error;
+
 /*!
  Squares a ciphertext. This functions computes the square of encrypted and
  stores the result in the destination parameter. Dynamic memory allocations
@@ -352,6 +509,13 @@ NS_ASSUME_NONNULL_BEGIN
 -(ASLCipherText * _Nullable)square:(ASLCipherText *)encrypted
                              error:(NSError **)error;
 
+/*!
+ Same as square:error:, writing the result into destination.
+ */
+-(BOOL)square:(ASLCipherText *)encrypted
+         into:(ASLCipherText *)destination
+        error:(NSError **)error;
+
 /*!
  Relinearizes a ciphertext. This functions relinearizes encrypted, reducing
  its size down to 2. If the size of encrypted is K+1, the given relinearization
@@ -420,6 +584,14 @@ NS_ASSUME_NONNULL_BEGIN
                     relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
                                   error:(NSError **)error;
 
+/*!
+ Same as relinearize:relinearizationKeys:error:, writing the result into destination.
+ */
+-(BOOL)relinearize:(ASLCipherText *)encrypted
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+              into:(ASLCipherText *)destination
+             error:(NSError **)error;
+
 /*!
  Relinearizes a ciphertext. This functions relinearizes encrypted, reducing
  its size down to 2, and stores the result in the destination parameter.
@@ -445,6 +617,15 @@ NS_ASSUME_NONNULL_BEGIN
                                    pool:(ASLMemoryPoolHandle *)pool
                                   error:(NSError **)error;
 
+/*!
+ Same as relinearize:relinearizationKeys:pool:error:, writing the result into destination.
+ */
+-(BOOL)relinearize:(ASLCipherText *)encrypted
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+              into:(ASLCipherText *)destination
+              pool:(ASLMemoryPoolHandle *)pool
+             error:(NSError **)error;
+
 /*!
  Given a ciphertext encrypted modulo q_1...q_k, this function switches the
  modulus down to q_1...q_{k-1} and stores the result in the destination
@@ -462,6 +643,13 @@ NS_ASSUME_NONNULL_BEGIN
 -(ASLCipherText * _Nullable)modSwitchToNext:(ASLCipherText *)encrypted
                                       error:(NSError **)error;
 
+/*!
+ Same as modSwitchToNext:error:, writing the result into destination.
+ */
+-(BOOL)modSwitchToNext:(ASLCipherText *)encrypted
+                  into:(ASLCipherText *)destination
+                 error:(NSError **)error;
+
 /*!
  @param encrypted The ciphertext to be switched to a smaller modulus
  @param pool The MemoryPoolHandle pointing to a valid memory pool
@@ -477,6 +665,14 @@ NS_ASSUME_NONNULL_BEGIN
                                        pool:(ASLMemoryPoolHandle *)pool
                                       error:(NSError **)error;
 
+/*!
+ Same as modSwitchToNext:pool:error:, writing the result into destination.
+ */
+-(BOOL)modSwitchToNext:(ASLCipherText *)encrypted
+                  into:(ASLCipherText *)destination
+                  pool:(ASLMemoryPoolHandle *)pool
+                 error:(NSError **)error;
+
 /*!
  Given a ciphertext encrypted modulo q_1...q_k, this function switches the
  modulus down to q_1...q_{k-1}. Dynamic memory allocations in the process
@@ -594,6 +790,15 @@ NS_ASSUME_NONNULL_BEGIN
                                    pool:(ASLMemoryPoolHandle *)pool
                                   error:(NSError **)error;
 
+/*!
+ Same as modSwitchTo:parametersId:pool:error:, writing the result into destination.
+ */
+-(BOOL)modSwitchTo:(ASLCipherText *)encrypted
+      parametersId:(ASLParametersIdType)parametersId
+              into:(ASLCipherText *)destination
+              pool:(ASLMemoryPoolHandle *)pool
+             error:(NSError **)error;
+
 /*!
  Given a ciphertext encrypted modulo q_1...q_k, this function switches the
  modulus down until the parameters reach the given parms_id and stores the
@@ -615,6 +820,14 @@ NS_ASSUME_NONNULL_BEGIN
                            parametersId:(ASLParametersIdType)parametersId
                                   error:(NSError **)error;
 
+/*!
+ Same as modSwitchTo:parametersId:error:, writing the result into destination.
+ */
+-(BOOL)modSwitchTo:(ASLCipherText *)encrypted
+      parametersId:(ASLParametersIdType)parametersId
+              into:(ASLCipherText *)destination
+             error:(NSError **)error;
+
 /*!
  Given an NTT transformed plaintext modulo q_1...q_k, this function switches
  the modulus down until the parameters reach the given parms_id.
@@ -652,6 +865,14 @@ NS_ASSUME_NONNULL_BEGIN
                                    parametersId:(ASLParametersIdType)parametersId
                                           error:(NSError **)error;
 
+/*!
+ Same as modSwitchToWithPlain:parametersId:error:, writing the result into destination.
+ */
+-(BOOL)modSwitchToWithPlain:(ASLPlainText *)plain
+               parametersId:(ASLParametersIdType)parametersId
+                       into:(ASLPlainText *)destination
+                      error:(NSError **)error;
+
 /*!
  Given a ciphertext encrypted modulo q_1...q_k, this function switches the
  modulus down to q_1...q_{k-1}, scales the message down accordingly, and
@@ -672,6 +893,14 @@ NS_ASSUME_NONNULL_BEGIN
                                      pool:(ASLMemoryPoolHandle *)pool
                                     error:(NSError **)error;
 
+/*!
+ Same as rescaleToNext:pool:error:, writing the result into destination.
+ */
+-(BOOL)rescaleToNext:(ASLCipherText *)encrypted
+                into:(ASLCipherText *)destination
+                pool:(ASLMemoryPoolHandle *)pool
+               error:(NSError **)error;
+
 /*!
  Given a ciphertext encrypted modulo q_1...q_k, this function switches the
  modulus down to q_1...q_{k-1}, scales the message down accordingly, and
@@ -688,6 +917,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 -(ASLCipherText * _Nullable)rescaleToNext:(ASLCipherText *)encrypted
                                     error:(NSError **)error;
+
+/*!
+ Same as rescaleToNext:error:, writing the result into destination.
+ */
+-(BOOL)rescaleToNext:(ASLCipherText *)encrypted
+                into:(ASLCipherText *)destination
+               error:(NSError **)error;
 /*!
  Given a ciphertext encrypted modulo q_1...q_k, this function switches the
  modulus down to q_1...q_{k-1} and scales the message down accordingly. Dynamic
@@ -789,6 +1025,15 @@ NS_ASSUME_NONNULL_BEGIN
                                  pool:(ASLMemoryPoolHandle *)pool
                                 error:(NSError **)error;
 
+/*!
+ Same as rescaleTo:parametersId:pool:error:, writing the result into destination.
+ */
+-(BOOL)rescaleTo:(ASLCipherText *)encrypted
+    parametersId:(ASLParametersIdType)parametersId
+            into:(ASLCipherText *)destination
+            pool:(ASLMemoryPoolHandle *)pool
+           error:(NSError **)error;
+
 /*!
  Given a ciphertext encrypted modulo q_1...q_k, this function switches the
  modulus down until the parameters reach the given parms_id, scales the message
@@ -810,25 +1055,164 @@ NS_ASSUME_NONNULL_BEGIN
                          parametersId:(ASLParametersIdType)parametersId
                                 error:(NSError **)error;
 
+/*!
+ Same as rescaleTo:parametersId:error:, writing the result into destination.
+ */
+-(BOOL)rescaleTo:(ASLCipherText *)encrypted
+    parametersId:(ASLParametersIdType)parametersId
+            into:(ASLCipherText *)destination
+           error:(NSError **)error;
+
+/*!
+ Multiplies two ciphertexts, relinearizes the product and rescales it to the
+ next level in one call. This is the usual CKKS multiplication step, fused so
+ that a single destination buffer is allocated from the given memory pool and
+ reused by all three stages, and the relinearization keys are used in place
+ rather than copied.
+ 
+ @param encrypted1 The first ciphertext to multiply
+ @param encrypted2 The second ciphertext to multiply
+ @param relinearizationKeys The relinearization keys
+ @param pool The MemoryPoolHandle pointing to a valid memory pool
+ @throws ASL_SealInvalidParameter if encrypted1, encrypted2 or relinearizationKeys
+ is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted1 or encrypted2 is not in the default
+ NTT form
+ @throws ASL_SealInvalidParameter if the scheme is invalid for rescaling
+ @throws ASL_SealInvalidParameter if encrypted1 and encrypted2 are already at the
+ last level of the modulus chain
+ @throws ASL_SealInvalidParameter if pool is uninitialized
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)multiplyRelinearizeRescale:(ASLCipherText *)encrypted1
+                                            encrypted2:(ASLCipherText *)encrypted2
+                                   relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                                  pool:(ASLMemoryPoolHandle *)pool
+                                                 error:(NSError **)error;
+
+/*!
+ Same as multiplyRelinearizeRescale:encrypted2:relinearizationKeys:pool:error:, writing the result into destination.
+ */
+-(BOOL)multiplyRelinearizeRescale:(ASLCipherText *)encrypted1
+                       encrypted2:(ASLCipherText *)encrypted2
+              relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                             into:(ASLCipherText *)destination
+                             pool:(ASLMemoryPoolHandle *)pool
+                            error:(NSError **)error;
+
+/*!
+ Multiplies two ciphertexts, relinearizes the product and rescales it to the
+ next level in one call, using a single destination buffer for all three stages.
+ 
+ @param encrypted1 The first ciphertext to multiply
+ @param encrypted2 The second ciphertext to multiply
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if encrypted1, encrypted2 or relinearizationKeys
+ is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted1 or encrypted2 is not in the default
+ NTT form
+ @throws ASL_SealInvalidParameter if the scheme is invalid for rescaling
+ @throws ASL_SealInvalidParameter if encrypted1 and encrypted2 are already at the
+ last level of the modulus chain
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)multiplyRelinearizeRescale:(ASLCipherText *)encrypted1
+                                            encrypted2:(ASLCipherText *)encrypted2
+                                   relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                                 error:(NSError **)error;
+
+/*!
+ Same as multiplyRelinearizeRescale:encrypted2:relinearizationKeys:error:, writing the result into destination.
+ */
+-(BOOL)multiplyRelinearizeRescale:(ASLCipherText *)encrypted1
+                       encrypted2:(ASLCipherText *)encrypted2
+              relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                             into:(ASLCipherText *)destination
+                            error:(NSError **)error;
+
+/*!
+ Multiplies a ciphertext with a plaintext and rescales the product to the next
+ level in one call. Plain multiplication does not grow the ciphertext, so no
+ relinearization is needed. The destination buffer is allocated once from the
+ given memory pool and reused by both stages.
+ 
+ @param encrypted The ciphertext to multiply
+ @param plain The plaintext to multiply
+ @param pool The MemoryPoolHandle pointing to a valid memory pool
+ @throws ASL_SealInvalidParameter if encrypted or plain is not valid for the
+ encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted and plain are in different NTT forms
+ @throws ASL_SealInvalidParameter if the scheme is invalid for rescaling
+ @throws ASL_SealInvalidParameter if encrypted is already at the last level of the
+ modulus chain
+ @throws ASL_SealInvalidParameter if pool is uninitialized
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)multiplyPlainRescale:(ASLCipherText *)encrypted
+                                           plain:(ASLPlainText *)plain
+                                            pool:(ASLMemoryPoolHandle *)pool
+                                           error:(NSError **)error;
+
+/*!
+ Same as multiplyPlainRescale:plain:pool:error:, writing the result into destination.
+ */
+-(BOOL)multiplyPlainRescale:(ASLCipherText *)encrypted
+                      plain:(ASLPlainText *)plain
+                       into:(ASLCipherText *)destination
+                       pool:(ASLMemoryPoolHandle *)pool
+                      error:(NSError **)error;
+
+/*!
+ Multiplies a ciphertext with a plaintext and rescales the product to the next
+ level in one call, using a single destination buffer for both stages.
+ 
+ @param encrypted The ciphertext to multiply
+ @param plain The plaintext to multiply
+ @throws ASL_SealInvalidParameter if encrypted or plain is not valid for the
+ encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted and plain are in different NTT forms
+ @throws ASL_SealInvalidParameter if the scheme is invalid for rescaling
+ @throws ASL_SealInvalidParameter if encrypted is already at the last level of the
+ modulus chain
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)multiplyPlainRescale:(ASLCipherText *)encrypted
+                                           plain:(ASLPlainText *)plain
+                                           error:(NSError **)error;
+
+/*!
+ Same as multiplyPlainRescale:plain:error:, writing the result into destination.
+ */
+-(BOOL)multiplyPlainRescale:(ASLCipherText *)encrypted
+                      plain:(ASLPlainText *)plain
+                       into:(ASLCipherText *)destination
+                      error:(NSError **)error;
+
 /*!
  Multiplies several ciphertexts together. This function computes the product
  of several ciphertext given as an NSArray and stores the result in the
- destination parameter. The multiplication is done in a depth-optimal order,
- and relinearization is performed automatically after every multiplication
- in the process. In relinearization the given relinearization keys are used.
+ destination parameter. The ciphertexts are read without being copied and are
+ multiplied as a balanced tree, one tree level at a time across batchConcurrency
+ workers. Relinearization is performed automatically after every multiplication
+ using the given relinearization keys. When using scheme_type::CKKS every product
+ is also rescaled, so the result is ceil(log2(count)) levels below the inputs, and
+ inputs at different levels are switched to the lower level before they meet.
  Dynamic memory allocations in the process are allocated from the memory
  pool pointed to by the given MemoryPoolHandle.
  
  @param encrypteds The ciphertexts to multiply
  @param relinearizationKeys The relinearization keys
  @param pool The MemoryPoolHandle pointing to a valid memory pool
- @throws ASL_SealLogicError if scheme is not scheme_type::BFV
  @throws ASL_SealInvalidParameter if encrypteds is empty
  @throws ASL_SealInvalidParameter if the ciphertexts or relin_keys are not valid for
  the encryption parameters
  @throws ASL_SealInvalidParameter if encrypteds are not in the default NTT form
  @throws ASL_SealInvalidParameter if, when using scheme_type::CKKS, the output scale
  is too large for the encryption parameters
+ @throws ASL_SealInvalidParameter if, when using scheme_type::CKKS, the inputs do not
+ have enough levels left to rescale every product
  @throws ASL_SealInvalidParameter if the size of relin_keys is too small
  @throws ASL_SealInvalidParameter if pool is uninitialized
  @throws ASL_SealLogicError if keyswitching is not supported by the context
@@ -839,24 +1223,37 @@ NS_ASSUME_NONNULL_BEGIN
                                     pool:(ASLMemoryPoolHandle *)pool
                                    error:(NSError **)error;
 
+/*!
+ Same as multiplyMany:relinearizationKeys:pool:error:, writing the result into destination.
+ */
+-(BOOL)multiplyMany:(NSArray<ASLCipherText *> *)encrypteds
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+               into:(ASLCipherText *)destination
+               pool:(ASLMemoryPoolHandle *)pool
+              error:(NSError **)error;
+
 /*!
  Multiplies several ciphertexts together. This function computes the product
  of several ciphertext given as an NSArray and stores the result in the
- destination parameter. The multiplication is done in a depth-optimal order,
- and relinearization is performed automatically after every multiplication
- in the process. In relinearization the given relinearization keys are used.
+ destination parameter. The ciphertexts are read without being copied and are
+ multiplied as a balanced tree, one tree level at a time across batchConcurrency
+ workers. Relinearization is performed automatically after every multiplication
+ using the given relinearization keys. When using scheme_type::CKKS every product
+ is also rescaled, so the result is ceil(log2(count)) levels below the inputs, and
+ inputs at different levels are switched to the lower level before they meet.
  Dynamic memory allocations in the process are allocated from the memory
  pool pointed to by the given MemoryPoolHandle.
  
  @param encrypteds The ciphertexts to multiply
  @param relinearizationKeys The relinearization keys
- @throws ASL_SealLogicError if scheme is not scheme_type::BFV
  @throws ASL_SealInvalidParameter if encrypteds is empty
  @throws ASL_SealInvalidParameter if the ciphertexts or relin_keys are not valid for
  the encryption parameters
  @throws ASL_SealInvalidParameter if encrypteds are not in the default NTT form
  @throws ASL_SealInvalidParameter if, when using scheme_type::CKKS, the output scale
  is too large for the encryption parameters
+ @throws ASL_SealInvalidParameter if, when using scheme_type::CKKS, the inputs do not
+ have enough levels left to rescale every product
  @throws ASL_SealInvalidParameter if the size of relin_keys is too small
  @throws ASL_SealLogicError if keyswitching is not supported by the context
  @throws ASL_SealLogicError if result ciphertext is transparent
@@ -865,6 +1262,14 @@ NS_ASSUME_NONNULL_BEGIN
                      relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
                                    error:(NSError **)error;
 
+/*!
+ Same as multiplyMany:relinearizationKeys:error:, writing the result into destination.
+ */
+-(BOOL)multiplyMany:(NSArray<ASLCipherText *> *)encrypteds
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+               into:(ASLCipherText *)destination
+              error:(NSError **)error;
+
 /*!
  Exponentiates a ciphertext. This functions raises encrypted to a power.
  Dynamic memory allocations in the process are allocated from the memory
@@ -952,6 +1357,16 @@ NS_ASSUME_NONNULL_BEGIN
                                     pool:(ASLMemoryPoolHandle *)pool
                                    error:(NSError **)error;
 
+/*!
+ Same as exponentiate:exponent:relinearizationKeys:pool:error:, writing the result into destination.
+ */
+-(BOOL)exponentiate:(ASLCipherText *)encrypted
+           exponent:(uint64_t)exponent
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+               into:(ASLCipherText *)destination
+               pool:(ASLMemoryPoolHandle *)pool
+              error:(NSError **)error;
+
 /*!
  Exponentiates a ciphertext. This functions raises encrypted to a power and
  stores the result in the destination parameter. Dynamic memory allocations
@@ -979,6 +1394,15 @@ NS_ASSUME_NONNULL_BEGIN
                      relinearizationKeys:(ASLRelinearizationKeys*)relinearizationKeys
                                    error:(NSError **)error;
 
+/*!
+ Same as exponentiate:exponent:relinearizationKeys:error:, writing the result into destination.
+ */
+-(BOOL)exponentiate:(ASLCipherText *)encrypted
+           exponent:(uint64_t)exponent
+relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+               into:(ASLCipherText *)destination
+              error:(NSError **)error;
+
 /*!
  Adds a ciphertext and a plaintext. The plaintext must be valid for the current
  encryption parameters.
@@ -1010,6 +1434,14 @@ NS_ASSUME_NONNULL_BEGIN
                                plain:(ASLPlainText *)plain
                                error:(NSError **)error;
 
+/*!
+ Same as addPlain:plain:error:, writing the result into destination.
+ */
+-(BOOL)addPlain:(ASLCipherText *)encrypted
+          plain:(ASLPlainText *)plain
+           into:(ASLCipherText *)destination
+          error:(NSError **)error;
+
 /*!
  Subtracts a plaintext from a ciphertext. The plaintext must be valid for the
  current encryption parameters.
@@ -1041,6 +1473,14 @@ NS_ASSUME_NONNULL_BEGIN
                                plain:(ASLPlainText *)plain
                                error:(NSError **)error;
 
+/*!
+ Same as subPlain:plain:error:, writing the result into destination.
+ */
+-(BOOL)subPlain:(ASLCipherText *)encrypted
+          plain:(ASLPlainText *)plain
+           into:(ASLCipherText *)destination
+          error:(NSError **)error;
+
 /*!
  Multiplies a ciphertext with a plaintext. The plaintext must be valid for the
  current encryption parameters, and cannot be identially 0. Dynamic memory
@@ -1106,6 +1546,15 @@ NS_ASSUME_NONNULL_BEGIN
                                      pool:(ASLMemoryPoolHandle *)pool
                                     error:(NSError **)error;
 
+/*!
+ Same as multiplyPlain:plain:pool:error:, writing the result into destination.
+ */
+-(BOOL)multiplyPlain:(ASLCipherText *)encrypted
+               plain:(ASLPlainText *)plain
+                into:(ASLCipherText *)destination
+                pool:(ASLMemoryPoolHandle *)pool
+               error:(NSError **)error;
+
 /*!
  Multiplies a ciphertext with a plaintext. This function multiplies
  a ciphertext with a plaintext and stores the result in the destination
@@ -1127,6 +1576,99 @@ NS_ASSUME_NONNULL_BEGIN
                                     plain:(ASLPlainText *)plain
                                     error:(NSError **)error;
 
+/*!
+ Same as multiplyPlain:plain:error:, writing the result into destination.
+ */
+-(BOOL)multiplyPlain:(ASLCipherText *)encrypted
+               plain:(ASLPlainText *)plain
+                into:(ASLCipherText *)destination
+               error:(NSError **)error;
+
+/*!
+ Multiplies a ciphertext with a prepared plaintext. The plaintext is used in NTT
+ form at the level of the ciphertext, transformed or switched down the first time
+ that level is seen and reused afterwards. For BFV the ciphertext is transformed to
+ NTT form and back around the multiplication.
+ 
+ @param encrypted The ciphertext to multiply
+ @param plain The prepared plaintext to multiply
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if, for CKKS, encrypted is at a higher level than plain
+ @throws ASL_SealInvalidParameter if plain is zero
+ @throws ASL_SealInvalidParameter if, when using scheme_type::CKKS, the output
+ scale is too large for the encryption parameters
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)multiplyPlainInplace:(ASLCipherText *)encrypted
+                                        prepared:(ASLPreparedPlainText *)plain
+                                           error:(NSError **)error;
+
+/*!
+ Multiplies a ciphertext with a prepared plaintext and returns the product. The
+ plaintext is used in NTT form at the level of the ciphertext, transformed or
+ switched down the first time that level is seen and reused afterwards.
+ 
+ @param encrypted The ciphertext to multiply
+ @param plain The prepared plaintext to multiply
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if, for CKKS, encrypted is at a higher level than plain
+ @throws ASL_SealInvalidParameter if plain is zero
+ @throws ASL_SealInvalidParameter if, when using scheme_type::CKKS, the output
+ scale is too large for the encryption parameters
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)multiplyPlain:(ASLCipherText *)encrypted
+                                 prepared:(ASLPreparedPlainText *)plain
+                                    error:(NSError **)error;
+
+/*!
+ Same as multiplyPlain:prepared:error:, writing the result into destination.
+ */
+-(BOOL)multiplyPlain:(ASLCipherText *)encrypted
+            prepared:(ASLPreparedPlainText *)plain
+                into:(ASLCipherText *)destination
+               error:(NSError **)error;
+
+/*!
+ Adds a prepared plaintext to a ciphertext. For CKKS the plaintext is switched
+ down to the level of the ciphertext the first time that level is seen and reused
+ afterwards.
+ 
+ @param encrypted The ciphertext to add to
+ @param plain The prepared plaintext to add
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if, for CKKS, encrypted is at a higher level than plain
+ @throws ASL_SealInvalidParameter if, for CKKS, encrypted and plain have different scales
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)addPlainInplace:(ASLCipherText *)encrypted
+                                   prepared:(ASLPreparedPlainText *)plain
+                                      error:(NSError **)error;
+
+/*!
+ Adds a prepared plaintext to a ciphertext and returns the sum. For CKKS the
+ plaintext is switched down to the level of the ciphertext the first time that
+ level is seen and reused afterwards.
+ 
+ @param encrypted The ciphertext to add to
+ @param plain The prepared plaintext to add
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if, for CKKS, encrypted is at a higher level than plain
+ @throws ASL_SealInvalidParameter if, for CKKS, encrypted and plain have different scales
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)addPlain:(ASLCipherText *)encrypted
+                            prepared:(ASLPreparedPlainText *)plain
+                               error:(NSError **)error;
+
+/*!
+ Same as addPlain:prepared:error:, writing the result into destination.
+ */
+-(BOOL)addPlain:(ASLCipherText *)encrypted
+       prepared:(ASLPreparedPlainText *)plain
+           into:(ASLCipherText *)destination
+          error:(NSError **)error;
+
 /*!
  Transforms a plaintext to NTT domain. This functions applies the Number
  Theoretic Transform to a plaintext by first embedding integers modulo the
@@ -1200,6 +1742,15 @@ NS_ASSUME_NONNULL_BEGIN
                                       pool:(ASLMemoryPoolHandle *)pool
                                      error:(NSError **)error;
 
+/*!
+ Same as transformToNtt:parametersId:pool:error:, writing the result into destination.
+ */
+-(BOOL)transformToNtt:(ASLPlainText *)plain
+         parametersId:(ASLParametersIdType)parametersId
+                 into:(ASLPlainText *)destination
+                 pool:(ASLMemoryPoolHandle *)pool
+                error:(NSError **)error;
+
 /*!
  Transforms a plaintext to NTT domain. This functions applies the Number
  Theoretic Transform to a plaintext by first embedding integers modulo the
@@ -1223,6 +1774,14 @@ NS_ASSUME_NONNULL_BEGIN
                               parametersId:(ASLParametersIdType)parametersId
                                      error:(NSError **)error;
 
+/*!
+ Same as transformToNtt:parametersId:error:, writing the result into destination.
+ */
+-(BOOL)transformToNtt:(ASLPlainText *)plain
+         parametersId:(ASLParametersIdType)parametersId
+                 into:(ASLPlainText *)destination
+                error:(NSError **)error;
+
 /*!
  Transforms a ciphertext to NTT domain. This functions applies David Harvey's
  Number Theoretic Transform separately to each polynomial of a ciphertext.
@@ -1250,6 +1809,13 @@ NS_ASSUME_NONNULL_BEGIN
 -(ASLCipherText * _Nullable)transformToNtt:(ASLCipherText *)encrypted
                                      error:(NSError **)error;
 
+/*!
+ Same as transformToNtt:error:, writing the result into destination.
+ */
+-(BOOL)transformToNtt:(ASLCipherText *)encrypted
+                 into:(ASLCipherText *)destination
+                error:(NSError **)error;
+
 /*!
  Transforms a ciphertext back from NTT domain. This functions applies the
  inverse of David Harvey's Number Theoretic Transform separately to each
@@ -1278,6 +1844,13 @@ NS_ASSUME_NONNULL_BEGIN
 -(ASLCipherText * _Nullable)transformFromNtt:(ASLCipherText *)encryptedNtt
                                        error:(NSError **)error;
 
+/*!
+ Same as transformFromNtt:error:, writing the result into destination.
+ */
+-(BOOL)transformFromNtt:(ASLCipherText *)encryptedNtt
+                   into:(ASLCipherText *)destination
+                  error:(NSError **)error;
+
 /*!
  Applies a Galois automorphism to a ciphertext. To evaluate the Galois
  automorphism, an appropriate set of Galois keys must also be provided.
@@ -1387,6 +1960,16 @@ NS_ASSUME_NONNULL_BEGIN
                                    pool:(ASLMemoryPoolHandle *)pool
                                   error:(NSError **)error;
 
+/*!
+ Same as applyGalois:galoisElement:galoisKey:pool:error:, writing the result into destination.
+ */
+-(BOOL)applyGalois:(ASLCipherText *)encrypted
+     galoisElement:(uint64_t)galoisElement
+         galoisKey:(ASLGaloisKeys *)galoisKey
+              into:(ASLCipherText *)destination
+              pool:(ASLMemoryPoolHandle *)pool
+             error:(NSError **)error;
+
 /*!
  Applies a Galois automorphism to a ciphertext and writes the result to the
  destination parameter. To evaluate the Galois automorphism, an appropriate
@@ -1422,6 +2005,15 @@ NS_ASSUME_NONNULL_BEGIN
                               galoisKey:(ASLGaloisKeys *)galoisKey
                                   error:(NSError **)error;
 
+/*!
+ Same as applyGalois:galoisElement:galoisKey:error:, writing the result into destination.
+ */
+-(BOOL)applyGalois:(ASLCipherText *)encrypted
+     galoisElement:(uint64_t)galoisElement
+         galoisKey:(ASLGaloisKeys *)galoisKey
+              into:(ASLCipherText *)destination
+             error:(NSError **)error;
+
 /*!
  Rotates plaintext matrix rows cyclically. When batching is used with the
  BFV scheme, this function rotates the encrypted plaintext matrix rows
@@ -1521,6 +2113,16 @@ NS_ASSUME_NONNULL_BEGIN
                                   pool:(ASLMemoryPoolHandle *)pool
                                  error:(NSError **)error;
 
+/*!
+ Same as rotateRows:steps:galoisKey:pool:error:, writing the result into destination.
+ */
+-(BOOL)rotateRows:(ASLCipherText *)encrypted
+            steps:(int)steps
+        galoisKey:(ASLGaloisKeys *)galoisKey
+             into:(ASLCipherText *)destination
+             pool:(ASLMemoryPoolHandle *)pool
+            error:(NSError **)error;
+
 /*!
  Rotates plaintext matrix rows cyclically. When batching is used with the
  BFV scheme, this function rotates the encrypted plaintext matrix rows
@@ -1553,29 +2155,64 @@ NS_ASSUME_NONNULL_BEGIN
                                  error:(NSError **)error;
 
 /*!
- Rotates plaintext matrix columns cyclically. When batching is used with
- the BFV scheme, this function rotates the encrypted plaintext matrix
- columns cyclically. Since the size of the batched matrix is 2-by-(N/2),
- where N is the degree of the polynomial modulus, this means simply swapping
- the two rows. Dynamic memory allocations in the process are allocated from
- the memory pool pointed to by the given MemoryPoolHandle.
- 
+ Same as rotateRows:steps:galoisKey:error:, writing the result into destination.
+ */
+-(BOOL)rotateRows:(ASLCipherText *)encrypted
+            steps:(int)steps
+        galoisKey:(ASLGaloisKeys *)galoisKey
+             into:(ASLCipherText *)destination
+            error:(NSError **)error;
+
+/*!
+ Rotates the plaintext matrix rows cyclically by several step counts at once.
+ Each distinct step is rotated either from encrypted or from the result of an
+ earlier step, whichever needs the fewest key switches, so a step with its own
+ Galois key, or one keyed step away from another requested step, costs a single
+ key switch. Independent rotations run concurrently on up to batchConcurrency
+ workers. The results are returned in the order of steps.
  
  @param encrypted The ciphertext to rotate
+ @param steps The numbers of steps to rotate (negative left, positive right)
  @param galoisKey The Galois keys
- @param pool The MemoryPoolHandle pointing to a valid memory pool
  @throws ASL_SealLogicError if scheme is not scheme_type::BFV
  @throws ASL_SealLogicError if the encryption parameters do not support batching
  @throws ASL_SealInvalidParameter if encrypted or galois_keys is not valid for
  the encryption parameters
- @throws ASL_SealInvalidParameter if galois_keys do not correspond to the top
- level parameters in the current context
  @throws ASL_SealInvalidParameter if encrypted is in NTT form
  @throws ASL_SealInvalidParameter if encrypted has size larger than 2
+ @throws ASL_SealInvalidParameter if any step has too big absolute value
  @throws ASL_SealInvalidParameter if necessary Galois keys are not present
- @throws ASL_SealInvalidParameter if pool is uninitialized
  @throws ASL_SealLogicError if keyswitching is not supported by the context
- @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(NSArray<ASLCipherText *> * _Nullable)rotateRows:(ASLCipherText *)encrypted
+                                          bySteps:(NSArray<NSNumber *> *)steps
+                                        galoisKey:(ASLGaloisKeys *)galoisKey
+                                            error:(NSError **)error;
+
+/*!
+ Rotates plaintext matrix columns cyclically. When batching is used with
+ the BFV scheme, this function rotates the encrypted plaintext matrix
+ columns cyclically. Since the size of the batched matrix is 2-by-(N/2),
+ where N is the degree of the polynomial modulus, this means simply swapping
+ the two rows. Dynamic memory allocations in the process are allocated from
+ the memory pool pointed to by the given MemoryPoolHandle.
+ 
+ 
+ @param encrypted The ciphertext to rotate
+ @param galoisKey The Galois keys
+ @param pool The MemoryPoolHandle pointing to a valid memory pool
+ @throws ASL_SealLogicError if scheme is not scheme_type::BFV
+ @throws ASL_SealLogicError if the encryption parameters do not support batching
+ @throws ASL_SealInvalidParameter if encrypted or galois_keys is not valid for
+ the encryption parameters
+ @throws ASL_SealInvalidParameter if galois_keys do not correspond to the top
+ level parameters in the current context
+ @throws ASL_SealInvalidParameter if encrypted is in NTT form
+ @throws ASL_SealInvalidParameter if encrypted has size larger than 2
+ @throws ASL_SealInvalidParameter if necessary Galois keys are not present
+ @throws ASL_SealInvalidParameter if pool is uninitialized
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ @throws ASL_SealLogicError if result ciphertext is transparent
  */
 -(ASLCipherText * _Nullable)rotateColumnsInplace:(ASLCipherText *)encrypted
                                        galoisKey:(ASLGaloisKeys *)galoisKey
@@ -1639,6 +2276,15 @@ NS_ASSUME_NONNULL_BEGIN
                                      pool:(ASLMemoryPoolHandle *)pool
                                     error:(NSError **)error;
 
+/*!
+ Same as rotateColumns:galoisKey:pool:error:, writing the result into destination.
+ */
+-(BOOL)rotateColumns:(ASLCipherText *)encrypted
+           galoisKey:(ASLGaloisKeys *)galoisKey
+                into:(ASLCipherText *)destination
+                pool:(ASLMemoryPoolHandle *)pool
+               error:(NSError **)error;
+
 /*!
  Rotates plaintext matrix columns cyclically. When batching is used with
  the BFV scheme, this function rotates the encrypted plaintext matrix columns
@@ -1666,6 +2312,14 @@ NS_ASSUME_NONNULL_BEGIN
                                 galoisKey:(ASLGaloisKeys *)galoisKey
                                     error:(NSError **)error;
 
+/*!
+ Same as rotateColumns:galoisKey:error:, writing the result into destination.
+ */
+-(BOOL)rotateColumns:(ASLCipherText *)encrypted
+           galoisKey:(ASLGaloisKeys *)galoisKey
+                into:(ASLCipherText *)destination
+               error:(NSError **)error;
+
 /*!
  Rotates plaintext vector cyclically. When using the CKKS scheme, this function
  rotates the encrypted plaintext vector cyclically to the left (steps > 0)
@@ -1759,6 +2413,16 @@ NS_ASSUME_NONNULL_BEGIN
                                     pool:(ASLMemoryPoolHandle *)pool
                                    error:(NSError **)error;
 
+/*!
+ Same as rotateVector:steps:galoisKey:pool:error:, writing the result into destination.
+ */
+-(BOOL)rotateVector:(ASLCipherText *)encrypted
+              steps:(int)steps
+          galoisKey:(ASLGaloisKeys *)galoisKey
+               into:(ASLCipherText *)destination
+               pool:(ASLMemoryPoolHandle *)pool
+              error:(NSError **)error;
+
 /*!
  Rotates plaintext vector cyclically. When using the CKKS scheme, this function
  rotates the encrypted plaintext vector cyclically to the left (steps > 0)
@@ -1788,6 +2452,39 @@ NS_ASSUME_NONNULL_BEGIN
                                galoisKey:(ASLGaloisKeys *)galoisKey
                                    error:(NSError **)error;
 
+/*!
+ Same as rotateVector:steps:galoisKey:error:, writing the result into destination.
+ */
+-(BOOL)rotateVector:(ASLCipherText *)encrypted
+              steps:(int)steps
+          galoisKey:(ASLGaloisKeys *)galoisKey
+               into:(ASLCipherText *)destination
+              error:(NSError **)error;
+
+/*!
+ Rotates the plaintext vector cyclically by several step counts at once. Each
+ distinct step is rotated either from encrypted or from the result of an earlier
+ step, whichever needs the fewest key switches, so a step with its own Galois key,
+ or one keyed step away from another requested step, costs a single key switch.
+ Independent rotations run concurrently on up to batchConcurrency workers. The
+ results are returned in the order of steps.
+ 
+ @param encrypted The ciphertext to rotate
+ @param steps The numbers of steps to rotate (negative left, positive right)
+ @param galoisKey The Galois keys
+ @throws ASL_SealLogicError if scheme is not scheme_type::CKKS
+ @throws ASL_SealInvalidParameter if encrypted or galois_keys is not valid for
+ the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted has size larger than 2
+ @throws ASL_SealInvalidParameter if any step has too big absolute value
+ @throws ASL_SealInvalidParameter if necessary Galois keys are not present
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ */
+-(NSArray<ASLCipherText *> * _Nullable)rotateVector:(ASLCipherText *)encrypted
+                                            bySteps:(NSArray<NSNumber *> *)steps
+                                          galoisKey:(ASLGaloisKeys *)galoisKey
+                                              error:(NSError **)error;
+
 /*!
  Complex conjugates plaintext slot values. When using the CKKS scheme, this
  function complex conjugates all values in the underlying plaintext. Dynamic
@@ -1864,6 +2561,15 @@ NS_ASSUME_NONNULL_BEGIN
                                         pool:(ASLMemoryPoolHandle *)pool
                                        error:(NSError **)error;
 
+/*!
+ Same as complexConjugate:galoisKey:pool:error:, writing the result into destination.
+ */
+-(BOOL)complexConjugate:(ASLCipherText *)encrypted
+              galoisKey:(ASLGaloisKeys *)galoisKey
+                   into:(ASLCipherText *)destination
+                   pool:(ASLMemoryPoolHandle *)pool
+                  error:(NSError **)error;
+
 /*!
  Complex conjugates plaintext slot values. When using the CKKS scheme, this
  function complex conjugates all values in the underlying plaintext, and
@@ -1887,6 +2593,805 @@ NS_ASSUME_NONNULL_BEGIN
 -(ASLCipherText * _Nullable)complexConjugate:(ASLCipherText *)encrypted
                                    galoisKey:(ASLGaloisKeys *)galoisKey
                                        error:(NSError **)error;
+
+/*!
+ Same as complexConjugate:galoisKey:error:, writing the result into destination.
+ */
+-(BOOL)complexConjugate:(ASLCipherText *)encrypted
+              galoisKey:(ASLGaloisKeys *)galoisKey
+                   into:(ASLCipherText *)destination
+                  error:(NSError **)error;
+
+/*!
+ Sums all slots of a ciphertext. Every slot of the result holds the sum of all
+ slots of encrypted. For BFV the rows of the batching matrix are summed with
+ log2(N/2) row rotations and then added to each other with one column rotation.
+ For CKKS the N/2 slots are summed with log2(N/2) vector rotations.
+ 
+ @param encrypted The ciphertext to sum
+ @param galoisKey The Galois keys, which need the steps in galoisStepsForSumSlots
+ @throws ASL_SealInvalidParameter if encrypted or galois_keys is not valid for
+ the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted has size larger than 2
+ @throws ASL_SealInvalidParameter if necessary Galois keys are not present
+ @throws ASL_SealLogicError if the encryption parameters do not support batching
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ */
+-(ASLCipherText * _Nullable)sumSlots:(ASLCipherText *)encrypted
+                           galoisKey:(ASLGaloisKeys *)galoisKey
+                               error:(NSError **)error;
+
+/*!
+ Sums all slots of a ciphertext in place. Every slot of encrypted is replaced by
+ the sum of all of its slots. A single rotation temporary is reused throughout.
+ 
+ @param encrypted The ciphertext to sum
+ @param galoisKey The Galois keys, which need the steps in galoisStepsForSumSlots
+ @throws ASL_SealInvalidParameter if encrypted or galois_keys is not valid for
+ the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted has size larger than 2
+ @throws ASL_SealInvalidParameter if necessary Galois keys are not present
+ @throws ASL_SealLogicError if the encryption parameters do not support batching
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ */
+-(ASLCipherText * _Nullable)sumSlotsInplace:(ASLCipherText *)encrypted
+                                  galoisKey:(ASLGaloisKeys *)galoisKey
+                                      error:(NSError **)error;
+
+/*!
+ Sums a range of slots of a ciphertext. Slot range.location of the result holds
+ the sum of the slots in range; every other slot i holds the sum of the
+ range.length slots starting at i, wrapping around within its row. Needs one
+ rotation per bit of range.length plus one per additional set bit. For BFV the
+ range must lie within one row of the batching matrix.
+ 
+ @param encrypted The ciphertext to sum
+ @param range The slots to sum
+ @param galoisKey The Galois keys, which need the steps in galoisStepsForSumSlotsInRange
+ @throws ASL_SealInvalidParameter if range is empty, out of bounds, or crosses a
+ row of the BFV batching matrix
+ @throws ASL_SealInvalidParameter if encrypted or galois_keys is not valid for
+ the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted has size larger than 2
+ @throws ASL_SealInvalidParameter if necessary Galois keys are not present
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ */
+-(ASLCipherText * _Nullable)sumSlots:(ASLCipherText *)encrypted
+                             inRange:(NSRange)range
+                           galoisKey:(ASLGaloisKeys *)galoisKey
+                               error:(NSError **)error;
+
+/*!
+ Sums a range of slots of a ciphertext in place. Slot range.location of encrypted
+ is replaced by the sum of the slots in range, as described in sumSlots:inRange:.
+ 
+ @param encrypted The ciphertext to sum
+ @param range The slots to sum
+ @param galoisKey The Galois keys, which need the steps in galoisStepsForSumSlotsInRange
+ @throws ASL_SealInvalidParameter if range is empty, out of bounds, or crosses a
+ row of the BFV batching matrix
+ @throws ASL_SealInvalidParameter if encrypted or galois_keys is not valid for
+ the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted has size larger than 2
+ @throws ASL_SealInvalidParameter if necessary Galois keys are not present
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ */
+-(ASLCipherText * _Nullable)sumSlotsInplace:(ASLCipherText *)encrypted
+                                    inRange:(NSRange)range
+                                  galoisKey:(ASLGaloisKeys *)galoisKey
+                                      error:(NSError **)error;
+
+/*!
+ Computes the inner product of two packed vectors. The ciphertexts are multiplied
+ slot-wise and relinearized; with CKKS the product is also rescaled to the next
+ level. The slots of the product are then summed as in sumSlots, so every slot of
+ the result holds the inner product.
+ 
+ @param encrypted1 The first vector
+ @param encrypted2 The second vector
+ @param relinearizationKeys The relinearization keys
+ @param galoisKey The Galois keys, which need the steps in galoisStepsForSumSlots
+ @throws ASL_SealInvalidParameter if encrypted1 or encrypted2 is not valid for
+ the encryption parameters, or they are at different levels or scales
+ @throws ASL_SealInvalidParameter if relin_keys or galois_keys is not valid for
+ the encryption parameters
+ @throws ASL_SealInvalidParameter if necessary Galois keys are not present
+ @throws ASL_SealInvalidParameter if, for CKKS, encrypted1 is already at the last level
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)innerProduct:(ASLCipherText *)encrypted1
+                                    with:(ASLCipherText *)encrypted2
+                     relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                               galoisKey:(ASLGaloisKeys *)galoisKey
+                                   error:(NSError **)error;
+
+/*!
+ The rotation steps used by sumSlots and innerProduct:with:. Generating Galois
+ keys for exactly these steps gives the smallest key set these operations accept.
+ For BFV the steps include 0, which stands for the column rotation.
+ */
+-(NSArray<NSNumber *> *)galoisStepsForSumSlots;
+
+/*!
+ The rotation steps used by sumSlots:inRange:. Generating Galois keys for exactly
+ these steps gives the smallest key set the operation accepts.
+ 
+ @param range The slots to sum
+ */
+-(NSArray<NSNumber *> *)galoisStepsForSumSlotsInRange:(NSRange)range;
+
+/*!
+ Computes the sum of the products encrypteds1[i] * encrypteds2[i] and returns it.
+ The products are added while they still have size 3, and the sum is relinearized
+ once at the end, so a sum of k products costs one relinearization instead of k.
+ Products are accumulated across batchConcurrency workers. For CKKS the scale of
+ the result is the product of the input scales; it is not rescaled.
+ 
+ @param encrypteds1 The first factors of each product
+ @param encrypteds2 The second factors of each product
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if encrypteds1 and encrypteds2 have different counts
+ @throws ASL_SealInvalidParameter if encrypteds1 is empty
+ @throws ASL_SealInvalidParameter if any input is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if the inputs are at different levels or, for CKKS,
+ the products have different scales
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)multiplyAccumulate:(NSArray<ASLCipherText *> *)encrypteds1
+                                    encrypted2:(NSArray<ASLCipherText *> *)encrypteds2
+                           relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                         error:(NSError **)error;
+
+/*!
+ Multiplies a plaintext matrix with an encrypted vector using the baby-step
+ giant-step method, and returns the product. The encrypted vector must repeat
+ with period matrix.dimension across its slots, as described in ASLPlainMatrix,
+ and must be at the level the matrix was encoded at. For CKKS the scale of the
+ product is the scale of the vector times the scale of the matrix; it is not
+ rescaled. Groups of diagonals are accumulated across batchConcurrency workers.
+ 
+ @param matrix The plaintext matrix
+ @param encrypted The encrypted vector to multiply
+ @param galoisKey The Galois keys, containing at least matrix.galoisSteps
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted is at a different level than matrix
+ @throws ASL_SealInvalidParameter if the matrix has no non-zero diagonals
+ @throws ASL_SealInvalidParameter if the Galois keys do not contain a required step
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)multiplyMatrix:(ASLPlainMatrix *)matrix
+                                    vector:(ASLCipherText *)encrypted
+                                 galoisKey:(ASLGaloisKeys *)galoisKey
+                                     error:(NSError **)error;
+
+/*!
+ Rearranges the slots of a ciphertext with a compiled permutation, so output slot i
+ holds input slot indices[i], and returns the result. The ciphertext must be at the
+ level the permutation was encoded at. The masked baby steps of each giant step are
+ accumulated across batchConcurrency workers. For CKKS the scale of the result is the
+ scale of the input times the scale of the masks; it is not rescaled.
+ 
+ @param encrypted The ciphertext to permute
+ @param permutation The compiled permutation
+ @param galoisKey The Galois keys, containing at least permutation.galoisSteps
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted is at a different level than permutation
+ @throws ASL_SealInvalidParameter if the Galois keys do not contain a required step
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)permuteSlots:(ASLCipherText *)encrypted
+                             permutation:(ASLSlotPermutation *)permutation
+                               galoisKey:(ASLGaloisKeys *)galoisKey
+                                   error:(NSError **)error;
+
+/*!
+ Evaluates a polynomial on a CKKS ciphertext and returns the result. The powers of
+ encrypted are computed with baby-step giant-step splitting, which needs about
+ 2√d non-scalar multiplications for degree d and consumes about log2(d) + 1 levels.
+ Levels and scales are aligned automatically: every intermediate is relinearized and
+ rescaled, operands are switched to a common level before they are combined, and the
+ coefficients are encoded at the scales that keep all terms equal. The result has the
+ scale of encrypted.
+ 
+ @param encrypted The ciphertext to evaluate the polynomial on
+ @param coefficients The coefficients of the polynomial, constant term first
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if the scheme is not CKKS
+ @throws ASL_SealInvalidParameter if the polynomial has degree less than one
+ @throws ASL_SealInvalidParameter if encrypted does not have enough levels left for the
+ degree of the polynomial
+ @throws ASL_SealInvalidParameter if relinearizationKeys is not valid for the encryption parameters
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)evaluatePolynomial:(ASLCipherText *)encrypted
+                                  coefficients:(NSArray<NSNumber *> *)coefficients
+                           relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                         error:(NSError **)error;
+
+/*!
+ Approximates the sign of every slot of a CKKS ciphertext with a composite polynomial,
+ returning a value close to 1 for positive slots and -1 for negative slots. The slots
+ must lie in [-1, 1]; the error for a slot x depends on |x| as described in
+ ASLSignApproximation. The result has the scale of encrypted.
+ 
+ @param encrypted The ciphertext to take the sign of
+ @param approximation The composite polynomial to evaluate
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if the scheme is not CKKS
+ @throws ASL_SealInvalidParameter if encrypted does not have approximation.depth levels left
+ @throws ASL_SealInvalidParameter if relinearizationKeys is not valid for the encryption parameters
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)sign:(ASLCipherText *)encrypted
+                   approximation:(ASLSignApproximation *)approximation
+             relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                           error:(NSError **)error;
+
+/*!
+ Approximates the step function (1 + sign(x)) / 2 on every slot of a CKKS ciphertext,
+ returning a value close to 1 for positive slots and 0 for negative slots. Subtracting
+ a threshold first compares the slots against it. The slots must lie in [-1, 1], and
+ the depth and precision are those of sign:approximation:relinearizationKeys:.
+ 
+ @param encrypted The ciphertext to threshold
+ @param approximation The composite polynomial to evaluate
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if the scheme is not CKKS
+ @throws ASL_SealInvalidParameter if encrypted does not have approximation.depth levels left
+ @throws ASL_SealInvalidParameter if relinearizationKeys is not valid for the encryption parameters
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)step:(ASLCipherText *)encrypted
+                   approximation:(ASLSignApproximation *)approximation
+             relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                           error:(NSError **)error;
+
+/*!
+ Approximates the slot-wise maximum of two CKKS ciphertexts as
+ (a + b) / 2 + (a - b) sign(a - b) / 2. The differences a - b must lie in [-1, 1].
+ This consumes one level more than the approximation, and the result is not rescaled
+ to the scale of the inputs.
+ 
+ @param encrypted1 The first ciphertext to compare
+ @param encrypted2 The second ciphertext to compare
+ @param approximation The composite polynomial used for the sign
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if encrypted1 or encrypted2 is not valid for the
+ encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted1 and encrypted2 are at different level or scale
+ @throws ASL_SealInvalidParameter if the scheme is not CKKS
+ @throws ASL_SealInvalidParameter if the inputs do not have approximation.depth + 1 levels left
+ @throws ASL_SealInvalidParameter if relinearizationKeys is not valid for the encryption parameters
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)max:(ASLCipherText *)encrypted1
+                           with:(ASLCipherText *)encrypted2
+                  approximation:(ASLSignApproximation *)approximation
+            relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                          error:(NSError **)error;
+
+/*!
+ Approximates the slot-wise minimum of two CKKS ciphertexts as
+ (a + b) / 2 - (a - b) sign(a - b) / 2. The differences a - b must lie in [-1, 1].
+ This consumes one level more than the approximation, and the result is not rescaled
+ to the scale of the inputs.
+ 
+ @param encrypted1 The first ciphertext to compare
+ @param encrypted2 The second ciphertext to compare
+ @param approximation The composite polynomial used for the sign
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if encrypted1 or encrypted2 is not valid for the
+ encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted1 and encrypted2 are at different level or scale
+ @throws ASL_SealInvalidParameter if the scheme is not CKKS
+ @throws ASL_SealInvalidParameter if the inputs do not have approximation.depth + 1 levels left
+ @throws ASL_SealInvalidParameter if relinearizationKeys is not valid for the encryption parameters
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)min:(ASLCipherText *)encrypted1
+                           with:(ASLCipherText *)encrypted2
+                  approximation:(ASLSignApproximation *)approximation
+            relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                          error:(NSError **)error;
+
+/*!
+ Approximates max(x, 0) on every slot of a CKKS ciphertext as (x + x sign(x)) / 2.
+ The slots must lie in [-1, 1]. This consumes one level more than the approximation,
+ and the result is not rescaled to the scale of encrypted.
+ 
+ @param encrypted The ciphertext to rectify
+ @param approximation The composite polynomial used for the sign
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if the scheme is not CKKS
+ @throws ASL_SealInvalidParameter if encrypted does not have approximation.depth + 1 levels left
+ @throws ASL_SealInvalidParameter if relinearizationKeys is not valid for the encryption parameters
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)relu:(ASLCipherText *)encrypted
+                   approximation:(ASLSignApproximation *)approximation
+             relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                           error:(NSError **)error;
+
+/*!
+ Tests two BFV ciphertexts for equality slot by slot. Each slot of the result is 1
+ where encrypted1 and encrypted2 hold the same value and 0 elsewhere, computed as
+ 1 - (encrypted1 - encrypted2)^(t - 1) for a prime plain modulus t. The power is
+ taken by repeated squaring: about 2 log2(t) relinearized multiplications at depth
+ ceil(log2(t - 1)). The slots are those of the batching matrix; for ciphertexts that
+ are not batched only the constant coefficient follows this rule.
+ 
+ @param encrypted1 The first ciphertext to compare
+ @param encrypted2 The second ciphertext to compare
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if encrypted1 or encrypted2 is not valid for the
+ encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted1 and encrypted2 are at different level
+ @throws ASL_SealInvalidParameter if relinearizationKeys is not valid for the encryption parameters
+ @throws ASL_SealLogicError if the scheme is not BFV
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)isEqual:(ASLCipherText *)encrypted1
+                                 to:(ASLCipherText *)encrypted2
+                relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                              error:(NSError **)error;
+
+/*!
+ Tests a BFV ciphertext for membership in a set of ciphertexts slot by slot. Each slot
+ of the result is 1 where encrypted equals the value held in that slot by one of the
+ set members and 0 elsewhere, however many members match. The differences from the
+ members are multiplied as a balanced tree across batchConcurrency workers and the
+ product is raised to t - 1 once, so a set of n members costs n - 1 multiplications
+ and a single equality test, at a depth ceil(log2(n)) levels above it.
+ 
+ @param encrypted The ciphertext to look up
+ @param encrypteds The members of the set
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if encrypteds is empty
+ @throws ASL_SealInvalidParameter if any ciphertext is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if the ciphertexts are at different levels
+ @throws ASL_SealInvalidParameter if relinearizationKeys is not valid for the encryption parameters
+ @throws ASL_SealLogicError if the scheme is not BFV
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+-(ASLCipherText * _Nullable)isMember:(ASLCipherText *)encrypted
+                               ofSet:(NSArray<ASLCipherText *> *)encrypteds
+                 relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                               error:(NSError **)error;
+
+/*!
+ Multiplies a BFV ciphertext by an integer constant in place. This matches
+ multiplyPlainInplace:plain: with a constant plaintext, but the constant is reduced
+ modulo each prime of the coefficient modulus and multiplied into the ciphertext
+ directly, with no plaintext to encode.
+ 
+ @param encrypted The ciphertext to multiply
+ @param value The constant to multiply by, taken modulo the plain modulus
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealLogicError if the scheme is not BFV
+ @throws ASL_SealLogicError if value is a multiple of the plain modulus, which makes the
+ result ciphertext transparent
+ */
+-(ASLCipherText * _Nullable)multiplyScalarInplace:(ASLCipherText *)encrypted
+                                     integerValue:(int64_t)value
+                                            error:(NSError **)error;
+
+/*!
+ Multiplies a BFV ciphertext by an integer constant and returns the product, leaving
+ encrypted unchanged. See multiplyScalarInplace:integerValue:.
+ 
+ @param encrypted The ciphertext to multiply
+ @param value The constant to multiply by, taken modulo the plain modulus
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealLogicError if the scheme is not BFV
+ @throws ASL_SealLogicError if value is a multiple of the plain modulus, which makes the
+ result ciphertext transparent
+ */
+-(ASLCipherText * _Nullable)multiplyScalar:(ASLCipherText *)encrypted
+                              integerValue:(int64_t)value
+                                     error:(NSError **)error;
+
+/*!
+ Adds an integer constant to every slot of a BFV ciphertext in place. The constant is
+ added as a plaintext with a single coefficient, so nothing is encoded.
+ 
+ @param encrypted The ciphertext to add to
+ @param value The constant to add, taken modulo the plain modulus
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted is in NTT form
+ @throws ASL_SealLogicError if the scheme is not BFV
+ */
+-(ASLCipherText * _Nullable)addScalarInplace:(ASLCipherText *)encrypted
+                                integerValue:(int64_t)value
+                                       error:(NSError **)error;
+
+/*!
+ Adds an integer constant to every slot of a BFV ciphertext and returns the sum,
+ leaving encrypted unchanged. See addScalarInplace:integerValue:.
+ 
+ @param encrypted The ciphertext to add to
+ @param value The constant to add, taken modulo the plain modulus
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted is in NTT form
+ @throws ASL_SealLogicError if the scheme is not BFV
+ */
+-(ASLCipherText * _Nullable)addScalar:(ASLCipherText *)encrypted
+                         integerValue:(int64_t)value
+                                error:(NSError **)error;
+
+/*!
+ Multiplies every slot of a CKKS ciphertext by a real constant in place. The constant
+ is encoded at scale as the integer round(value * scale), which is reduced modulo each
+ prime of the coefficient modulus and multiplied into the ciphertext directly, with no
+ FFT or NTT. The scale of the result is the scale of encrypted times scale; a scale of
+ 1 multiplies by an integer without growing the scale.
+ 
+ @param encrypted The ciphertext to multiply
+ @param value The constant to multiply by
+ @param scale Scaling parameter defining the precision of the constant
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted is not in NTT form
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if the output scale is too large for the encryption parameters
+ @throws ASL_SealInvalidParameter if value * scale is too large for the encryption parameters
+ @throws ASL_SealLogicError if the scheme is not CKKS
+ @throws ASL_SealLogicError if value * scale rounds to zero, which makes the result
+ ciphertext transparent
+ */
+-(ASLCipherText * _Nullable)multiplyScalarInplace:(ASLCipherText *)encrypted
+                                      doubleValue:(double)value
+                                            scale:(double)scale
+                                            error:(NSError **)error;
+
+/*!
+ Multiplies every slot of a CKKS ciphertext by a real constant and returns the product,
+ leaving encrypted unchanged. See multiplyScalarInplace:doubleValue:scale:.
+ 
+ @param encrypted The ciphertext to multiply
+ @param value The constant to multiply by
+ @param scale Scaling parameter defining the precision of the constant
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted is not in NTT form
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ @throws ASL_SealInvalidParameter if the output scale is too large for the encryption parameters
+ @throws ASL_SealInvalidParameter if value * scale is too large for the encryption parameters
+ @throws ASL_SealLogicError if the scheme is not CKKS
+ @throws ASL_SealLogicError if value * scale rounds to zero, which makes the result
+ ciphertext transparent
+ */
+-(ASLCipherText * _Nullable)multiplyScalar:(ASLCipherText *)encrypted
+                               doubleValue:(double)value
+                                     scale:(double)scale
+                                     error:(NSError **)error;
+
+/*!
+ Adds a real constant to every slot of a CKKS ciphertext in place. The constant is
+ encoded at the scale of encrypted and added to the ciphertext directly, with no FFT
+ or NTT.
+ 
+ @param encrypted The ciphertext to add to
+ @param value The constant to add
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted is not in NTT form
+ @throws ASL_SealInvalidParameter if value at the scale of encrypted is too large for
+ the encryption parameters
+ @throws ASL_SealLogicError if the scheme is not CKKS
+ */
+-(ASLCipherText * _Nullable)addScalarInplace:(ASLCipherText *)encrypted
+                                 doubleValue:(double)value
+                                       error:(NSError **)error;
+
+/*!
+ Adds a real constant to every slot of a CKKS ciphertext and returns the sum, leaving
+ encrypted unchanged. See addScalarInplace:doubleValue:.
+ 
+ @param encrypted The ciphertext to add to
+ @param value The constant to add
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted is not in NTT form
+ @throws ASL_SealInvalidParameter if value at the scale of encrypted is too large for
+ the encryption parameters
+ @throws ASL_SealLogicError if the scheme is not CKKS
+ */
+-(ASLCipherText * _Nullable)addScalar:(ASLCipherText *)encrypted
+                          doubleValue:(double)value
+                                error:(NSError **)error;
+
+/*!
+ Adds two arrays of ciphertexts element-wise. The ciphertexts at each index of
+ encrypteds1 and encrypteds2 are added together, and the sums are returned in
+ the same order. The work is split across batchConcurrency workers.
+ 
+ @param encrypteds1 The first ciphertexts to add
+ @param encrypteds2 The second ciphertexts to add
+ @throws ASL_SealInvalidParameter if encrypteds1 and encrypteds2 have different counts
+ @throws ASL_SealInvalidParameter if any pair of ciphertexts is not valid for the
+ encryption parameters, or is at different level or scale
+ @throws ASL_SealLogicError if a result ciphertext is transparent
+ */
+-(NSArray<ASLCipherText *> * _Nullable)addBatch:(NSArray<ASLCipherText *> *)encrypteds1
+                                     encrypted2:(NSArray<ASLCipherText *> *)encrypteds2
+                                          error:(NSError **)error;
+
+/*!
+ Multiplies each ciphertext in an array with a plaintext. When plains contains a
+ single plaintext it multiplies every ciphertext; otherwise the plaintext at each
+ index multiplies the ciphertext at the same index. The products are returned in
+ the same order. The work is split across batchConcurrency workers.
+ 
+ @param encrypteds The ciphertexts to multiply
+ @param plains The plaintexts to multiply with
+ @throws ASL_SealInvalidParameter if plains does not contain one plaintext or one
+ plaintext per ciphertext
+ @throws ASL_SealInvalidParameter if any ciphertext or plaintext is not valid for
+ the encryption parameters, or is in a different NTT form
+ @throws ASL_SealInvalidParameter if an output scale is too large for the
+ encryption parameters
+ @throws ASL_SealLogicError if a result ciphertext is transparent
+ */
+-(NSArray<ASLCipherText *> * _Nullable)multiplyPlainBatch:(NSArray<ASLCipherText *> *)encrypteds
+                                                   plains:(NSArray<ASLPlainText *> *)plains
+                                                    error:(NSError **)error;
+
+/*!
+ Rotates each ciphertext in an array by the same number of steps. With the BFV
+ scheme the rows of the batched plaintext matrix are rotated as in rotateRows;
+ with the CKKS scheme the plaintext vector is rotated as in rotateVector. The
+ rotated ciphertexts are returned in the same order. The work is split across
+ batchConcurrency workers.
+ 
+ @param encrypteds The ciphertexts to rotate
+ @param steps The number of steps to rotate (negative left, positive right)
+ @param galoisKey The Galois keys
+ @throws ASL_SealInvalidParameter if any ciphertext or galois_keys is not valid for
+ the encryption parameters
+ @throws ASL_SealInvalidParameter if any ciphertext is in a different NTT form than
+ the scheme requires, or has size larger than 2
+ @throws ASL_SealInvalidParameter if steps has too big absolute value
+ @throws ASL_SealInvalidParameter if necessary Galois keys are not present
+ @throws ASL_SealLogicError if the encryption parameters do not support batching
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ */
+-(NSArray<ASLCipherText *> * _Nullable)rotateBatch:(NSArray<ASLCipherText *> *)encrypteds
+                                             steps:(int)steps
+                                         galoisKey:(ASLGaloisKeys *)galoisKey
+                                             error:(NSError **)error;
+
+/*!
+ Relinearizes each ciphertext in an array, reducing its size down to 2. The
+ relinearized ciphertexts are returned in the same order. The work is split
+ across batchConcurrency workers.
+ 
+ @param encrypteds The ciphertexts to relinearize
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if any ciphertext or relin_keys is not valid for
+ the encryption parameters
+ @throws ASL_SealInvalidParameter if relin_keys do not correspond to the top
+ level parameters in the current context
+ @throws ASL_SealInvalidParameter if the size of relin_keys is too small
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ @throws ASL_SealLogicError if a result ciphertext is transparent
+ */
+-(NSArray<ASLCipherText *> * _Nullable)relinearizeBatch:(NSArray<ASLCipherText *> *)encrypteds
+                                    relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                                  error:(NSError **)error;
+
+/*!
+ Runs an operation with the receiver on evaluationQueue and passes its result to
+ completionHandler.
+ 
+ @param priority The priority of the task
+ @param operation The work to perform with the receiver
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)submitWithPriority:(ASLEvaluationPriority)priority
+                                         operation:(ASLCipherText * _Nullable (^)(ASLEvaluator *evaluator, NSError **error))operation
+                                 completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                             error:(NSError **)error;
+
+/*!
+ Negates a ciphertext asynchronously. See negate:error:.
+ 
+ @param encrypted The ciphertext to negate
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)negate:(ASLCipherText *)encrypted
+                              priority:(ASLEvaluationPriority)priority
+                     completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                 error:(NSError **)error;
+
+/*!
+ Adds two ciphertexts asynchronously. See add:encrypted2:error:.
+ 
+ @param encrypted1 The first ciphertext to add
+ @param encrypted2 The second ciphertext to add
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)add:(ASLCipherText *)encrypted1
+                         encrypted2:(ASLCipherText *)encrypted2
+                           priority:(ASLEvaluationPriority)priority
+                  completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                              error:(NSError **)error;
+
+/*!
+ Subtracts two ciphertexts asynchronously. See sub:encrypted2:error:.
+ 
+ @param encrypted1 The ciphertext to subtract from
+ @param encrypted2 The ciphertext to subtract
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)sub:(ASLCipherText *)encrypted1
+                         encrypted2:(ASLCipherText *)encrypted2
+                           priority:(ASLEvaluationPriority)priority
+                  completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                              error:(NSError **)error;
+
+/*!
+ Multiplies two ciphertexts asynchronously. See multiply:encrypted2:error:.
+ 
+ @param encrypted1 The first ciphertext to multiply
+ @param encrypted2 The second ciphertext to multiply
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)multiply:(ASLCipherText *)encrypted1
+                              encrypted2:(ASLCipherText *)encrypted2
+                                priority:(ASLEvaluationPriority)priority
+                       completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                   error:(NSError **)error;
+
+/*!
+ Squares a ciphertext asynchronously. See square:error:.
+ 
+ @param encrypted The ciphertext to square
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)square:(ASLCipherText *)encrypted
+                              priority:(ASLEvaluationPriority)priority
+                     completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                 error:(NSError **)error;
+
+/*!
+ Adds a ciphertext and a plaintext asynchronously. See addPlain:plain:error:.
+ 
+ @param encrypted The ciphertext to add
+ @param plain The plaintext to add
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)addPlain:(ASLCipherText *)encrypted
+                                   plain:(ASLPlainText *)plain
+                                priority:(ASLEvaluationPriority)priority
+                       completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                   error:(NSError **)error;
+
+/*!
+ Multiplies a ciphertext with a plaintext asynchronously. See
+ multiplyPlain:plain:error:.
+ 
+ @param encrypted The ciphertext to multiply
+ @param plain The plaintext to multiply
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)multiplyPlain:(ASLCipherText *)encrypted
+                                        plain:(ASLPlainText *)plain
+                                     priority:(ASLEvaluationPriority)priority
+                            completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                        error:(NSError **)error;
+
+/*!
+ Relinearizes a ciphertext asynchronously. See
+ relinearize:relinearizationKeys:error:.
+ 
+ @param encrypted The ciphertext to relinearize
+ @param relinearizationKeys The relinearization keys
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)relinearize:(ASLCipherText *)encrypted
+                        relinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                   priority:(ASLEvaluationPriority)priority
+                          completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                      error:(NSError **)error;
+
+/*!
+ Switches a ciphertext to the next modulus asynchronously. See
+ modSwitchToNext:error:.
+ 
+ @param encrypted The ciphertext to be switched to a smaller modulus
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)modSwitchToNext:(ASLCipherText *)encrypted
+                                       priority:(ASLEvaluationPriority)priority
+                              completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                          error:(NSError **)error;
+
+/*!
+ Rescales a ciphertext to the next modulus asynchronously. See
+ rescaleToNext:error:.
+ 
+ @param encrypted The ciphertext to be switched to a smaller modulus
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)rescaleToNext:(ASLCipherText *)encrypted
+                                     priority:(ASLEvaluationPriority)priority
+                            completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                        error:(NSError **)error;
+
+/*!
+ Rotates the plaintext matrix rows of a ciphertext asynchronously. See
+ rotateRows:steps:galoisKey:error:.
+ 
+ @param encrypted The ciphertext to rotate
+ @param steps The number of steps to rotate (negative left, positive right)
+ @param galoisKey The Galois keys
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)rotateRows:(ASLCipherText *)encrypted
+                                     steps:(int)steps
+                                 galoisKey:(ASLGaloisKeys *)galoisKey
+                                  priority:(ASLEvaluationPriority)priority
+                         completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                     error:(NSError **)error;
+
+/*!
+ Rotates the plaintext vector of a ciphertext asynchronously. See
+ rotateVector:steps:galoisKey:error:.
+ 
+ @param encrypted The ciphertext to rotate
+ @param steps The number of steps to rotate (negative left, positive right)
+ @param galoisKey The Galois keys
+ @param priority The priority of the task
+ @param completionHandler Called once with the result, the error, or the
+ cancellation of the operation
+ @throws ASLEvaluationQueueErrorCodeFull if evaluationQueue is full
+ */
+-(ASLEvaluationTask * _Nullable)rotateVector:(ASLCipherText *)encrypted
+                                       steps:(int)steps
+                                   galoisKey:(ASLGaloisKeys *)galoisKey
+                                    priority:(ASLEvaluationPriority)priority
+                           completionHandler:(ASLEvaluationCompletionHandler)completionHandler
+                                       error:(NSError **)error;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,76 @@
+//
+//  ASLEvaluator_Internal.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLEvaluator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include "seal/evaluator.h"
+#include "seal/memorymanager.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ASLEvaluator ()
+
+/// Returns a reference to the evaluator backing the receiver.
+- (seal::Evaluator &)sealEvaluatorReference;
+
+/// Returns the context the receiver was created with.
+- (std::shared_ptr<seal::SEALContext>)sealContext;
+
+@end
+
+/// Runs body(index, pool) for every index in [0, count) on up to workerCount concurrent
+/// workers. Each worker handles a contiguous range of indices and allocates from its own
+/// memory pool, so workers never contend on the global pool's lock. The worker pool is meant
+/// for temporaries: anything allocated from it keeps the whole pool alive, so results that
+/// outlive the call must be allocated from the global pool or a pool of the caller. The first
+/// exception thrown by any worker is rethrown on the calling thread once every worker has
+/// finished.
+template <typename Body>
+inline void ASLParallelFor(size_t count, size_t workerCount, Body body) {
+    if (count == 0) {
+        return;
+    }
+    workerCount = std::max<size_t>(1, std::min(workerCount, count));
+    
+    std::exception_ptr firstException = nullptr;
+    std::mutex exceptionMutex;
+    std::atomic<bool> failed(false);
+    
+    // Blocks cannot capture non-copyable C++ objects, so the workers share state through pointers.
+    Body * const sharedBody = &body;
+    std::exception_ptr * const sharedException = &firstException;
+    std::mutex * const sharedMutex = &exceptionMutex;
+    std::atomic<bool> * const sharedFailed = &failed;
+    
+    dispatch_queue_t const queue = dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0);
+    dispatch_apply(workerCount, queue, ^(size_t worker) {
+        size_t const begin = count * worker / workerCount;
+        size_t const end = count * (worker + 1) / workerCount;
+        seal::MemoryPoolHandle pool = seal::MemoryManager::GetPool(seal::mm_prof_opt::FORCE_NEW);
+        try {
+            for (size_t index = begin; index < end && !sharedFailed->load(std::memory_order_relaxed); ++index) {
+                (*sharedBody)(index, pool);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(*sharedMutex);
+            if (!sharedFailed->exchange(true)) {
+                *sharedException = std::current_exception();
+            }
+        }
+    });
+    
+    if (firstException != nullptr) {
+        std::rethrow_exception(firstException);
+    }
+}
+
+NS_ASSUME_NONNULL_END
@@ -19,6 +19,9 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)initWithGaloisKeys:(seal::GaloisKeys)sealGaloisKeys;
 
+/// Returns a reference to the Galois keys backing the receiver without copying them.
+- (seal::GaloisKeys const &)sealGaloisKeysReference;
+
 @end
 
 @interface ASLSerializableGaloisKeys ()
@@ -0,0 +1,118 @@
+//
+//  ASLInstrumentation.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "ASLSealContext.h"
+#import "ASLParametersIdType.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+ @class ASLOperationStatistics
+
+ @brief The counters recorded for one operation at one input level
+
+ @discussion A snapshot of the calls an ASLInstrumentation has recorded for one method
+ of one class, restricted to calls whose input was at the given level. Input and output
+ sizes are the number of polynomials in the ciphertexts, and are 0 for plaintexts.
+ */
+@interface ASLOperationStatistics : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The name of the class that performed the operation, such as ASLEvaluator
+@property (nonatomic, readonly, copy) NSString *componentName;
+
+/// The selector of the operation, such as multiply:encrypted2:error:
+@property (nonatomic, readonly, copy) NSString *operation;
+
+/// The chain index of the input, or -1 when the input has no level (BFV plaintexts)
+@property (nonatomic, readonly, assign) NSInteger level;
+
+/// The parametersId of the input level, or the zero parametersId when level is -1
+@property (nonatomic, readonly, assign) ASLParametersIdType parametersId;
+
+/// The number of calls, including failed ones
+@property (nonatomic, readonly, assign) uint64_t callCount;
+
+/// The number of calls that returned an error
+@property (nonatomic, readonly, assign) uint64_t failureCount;
+
+/// The time spent in all calls, in nanoseconds
+@property (nonatomic, readonly, assign) uint64_t totalNanoseconds;
+
+/// The time spent in the slowest call, in nanoseconds
+@property (nonatomic, readonly, assign) uint64_t maximumNanoseconds;
+
+/// Element i counts the calls that took at least 2^i and less than 2^(i + 1) nanoseconds
+@property (nonatomic, readonly, copy) NSArray<NSNumber *> *latencyHistogram;
+
+/// The mean size of the inputs
+@property (nonatomic, readonly, assign) double averageInputSize;
+
+/// The mean size of the outputs of the successful calls
+@property (nonatomic, readonly, assign) double averageOutputSize;
+
+/// The number of successful calls per output chain index, with -1 for outputs without a level
+@property (nonatomic, readonly, copy) NSDictionary<NSNumber *, NSNumber *> *outputLevelCounts;
+
+@end
+
+/*!
+ @class ASLInstrumentation
+
+ @brief Records call counts, latencies, levels and sizes of homomorphic operations
+
+ @discussion Assign an instrumentation to the instrumentation property of ASLEvaluator,
+ ASLEncryptor or ASLDecryptor to record every public operation they perform. The
+ instrumentation property is nil by default, and an operation then pays only for a nil
+ check. One instrumentation may be shared by any number of objects created with the
+ same context. The asynchronous evaluator methods are recorded under the synchronous
+ operation they perform, and an ASLEvaluationGraph built on an instrumented evaluator
+ records each evaluation as a single operation.
+
+ Counters are kept per class, operation and input level in a fixed table allocated as
+ operations are first seen. Recording a call takes two clock reads and a few relaxed
+ atomic additions with no locks, so any number of threads may record concurrently.
+ snapshot and reset also take no locks; calls that finish while they run may be only
+ partially included.
+ */
+@interface ASLInstrumentation : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ Creates an enabled instrumentation that resolves the levels of ciphertexts and
+ plaintexts in the given context.
+
+ @param context The context of the instrumented objects
+ */
++ (instancetype)instrumentationWithContext:(ASLSealContext *)context;
+
+/// Whether calls are recorded. Defaults to YES and may be changed from any thread.
+/// Disabling keeps the counters recorded so far.
+@property (nonatomic, assign, getter=isEnabled) BOOL enabled;
+
+/// Returns the counters of every operation and level with at least one call
+- (NSArray<ASLOperationStatistics *> *)snapshot;
+
+/// Sets every counter to zero
+- (void)reset;
+
+/// Returns the snapshot as a table with one line per operation and level
+- (NSString *)textReport;
+
+/// Returns the snapshot as a JSON array with one object per operation and level
+- (NSData *)JSONReport;
+
+@end
+
+NS_ASSUME_NONNULL_END
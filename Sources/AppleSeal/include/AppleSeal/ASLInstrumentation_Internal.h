@@ -0,0 +1,72 @@
+//
+//  ASLInstrumentation_Internal.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLInstrumentation.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#import "ASLCipherText.h"
+#import "ASLPlainText.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+class ASLInstrumentationRecorder;
+
+@interface ASLInstrumentation ()
+
+/// Returns the lock-free counter table backing the receiver.
+- (std::shared_ptr<ASLInstrumentationRecorder>)recorder;
+
+@end
+
+/// Records one call of an instrumented method. Construct it at the top of the method with the
+/// method's input and pass each successful result through complete; a scope destroyed without
+/// a completed result counts as a failure. With a nil or disabled instrumentation every member
+/// returns after a single check.
+class ASLInstrumentationScope {
+public:
+    ASLInstrumentationScope(ASLInstrumentation * _Nullable instrumentation, id owner, SEL operation, ASLCipherText * _Nullable input);
+    ASLInstrumentationScope(ASLInstrumentation * _Nullable instrumentation, id owner, SEL operation, ASLPlainText * _Nullable input);
+    ASLInstrumentationScope(ASLInstrumentation * _Nullable instrumentation, id owner, SEL operation, NSArray<ASLCipherText *> * _Nullable inputs);
+    ~ASLInstrumentationScope();
+
+    ASLInstrumentationScope(ASLInstrumentationScope const &) = delete;
+    ASLInstrumentationScope &operator=(ASLInstrumentationScope const &) = delete;
+
+    /// Records output as the result of the call and returns it.
+    ASLCipherText * _Nullable complete(ASLCipherText * _Nullable output);
+
+    /// Records output as the result of the call and returns it.
+    ASLPlainText * _Nullable complete(ASLPlainText * _Nullable output);
+
+    /// Records the first of outputs as the result of the call and returns them.
+    NSArray<ASLCipherText *> * _Nullable complete(NSArray<ASLCipherText *> * _Nullable outputs);
+
+    /// Records the call as successful for methods whose result has no level.
+    void complete();
+
+private:
+    ASLInstrumentationScope(ASLInstrumentation * _Nullable instrumentation, id owner, SEL operation);
+
+    void setInput(ASLCipherText * _Nullable input);
+    void setOutput(ASLCipherText * _Nullable output);
+
+    std::shared_ptr<ASLInstrumentationRecorder> _recorder;
+    __unsafe_unretained Class _owner;
+    SEL _operation;
+    std::chrono::steady_clock::time_point _start;
+    std::size_t _inputLevel = 0;
+    std::size_t _inputSize = 0;
+    std::size_t _outputLevel = 0;
+    std::size_t _outputSize = 0;
+    bool _completed = false;
+};
+
+NS_ASSUME_NONNULL_END
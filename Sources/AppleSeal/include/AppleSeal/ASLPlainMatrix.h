@@ -0,0 +1,108 @@
+//
+//  ASLPlainMatrix.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "ASLPlainText.h"
+#import "ASLParametersIdType.h"
+#import "ASLCKKSEncoder.h"
+#import "ASLBatchEncoder.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ASLEvaluator;
+
+/*!
+ @class ASLPlainMatrix
+
+ @brief A plaintext matrix pre-encoded for multiplication with encrypted vectors
+
+ @discussion Stores the generalized diagonals of a square matrix, encoded once
+ at a fixed level and in NTT form, so that ASLEvaluator's multiplyMatrix:vector:
+ can multiply it with many encrypted vectors without re-encoding. Diagonal k holds
+ M[i][(i + k) mod n] in slot i. Diagonals that are entirely zero are not stored and
+ cost nothing at multiplication time.
+
+ The diagonals are pre-rotated for a baby-step giant-step schedule: the product
+ needs babyStepCount - 1 rotations of the vector and giantStepCount - 1 rotations
+ of partial sums, about 2√n rotations for an n-by-n matrix instead of n.
+
+ Slot Layout
+ The dimension n must divide the number of slots in a row: N/2 for both CKKS and
+ BFV. The encrypted vector must repeat with period n across its slots (for BFV,
+ across each row of the batching matrix), and the product repeats the same way.
+ A matrix with fewer rows than columns is padded with zero rows.
+ */
+@interface ASLPlainMatrix : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ Encodes a matrix of real numbers for the CKKS scheme.
+
+ @param rows The rows of the matrix, each with the same number of columns
+ @param encoder The CKKSEncoder
+ @param parametersId The parametersId of the vectors the matrix will multiply
+ @param scale Scaling parameter defining encoding precision
+ @throws ASL_SealInvalidParameter if the matrix has more rows than columns or
+ ragged rows
+ @throws ASL_SealInvalidParameter if the number of columns does not divide the
+ number of slots
+ @throws ASL_SealInvalidParameter if parametersId is not valid for the encryption
+ parameters
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ */
++ (instancetype _Nullable)matrixWithRows:(NSArray<NSArray<NSNumber *> *> *)rows
+                             ckksEncoder:(ASLCKKSEncoder *)encoder
+                            parametersId:(ASLParametersIdType)parametersId
+                                   scale:(double)scale
+                                   error:(NSError **)error;
+
+/*!
+ Encodes a matrix of signed integers for the BFV scheme. The diagonals are
+ transformed to NTT form at parametersId using the evaluator.
+
+ @param rows The rows of the matrix, each with the same number of columns
+ @param encoder The BatchEncoder
+ @param evaluator The evaluator used to transform the diagonals to NTT form
+ @param parametersId The parametersId of the vectors the matrix will multiply
+ @throws ASL_SealInvalidParameter if the matrix has more rows than columns or
+ ragged rows
+ @throws ASL_SealInvalidParameter if the number of columns does not divide the
+ number of slots in a row
+ @throws ASL_SealInvalidParameter if parametersId is not valid for the encryption
+ parameters
+ */
++ (instancetype _Nullable)matrixWithRows:(NSArray<NSArray<NSNumber *> *> *)rows
+                            batchEncoder:(ASLBatchEncoder *)encoder
+                               evaluator:(ASLEvaluator *)evaluator
+                            parametersId:(ASLParametersIdType)parametersId
+                                   error:(NSError **)error;
+
+/// The number of columns n of the square matrix
+@property (nonatomic, readonly, assign) NSUInteger dimension;
+
+/// The number of vector rotations in each baby step group, about √n
+@property (nonatomic, readonly, assign) NSUInteger babyStepCount;
+
+/// The number of baby step groups, about n / babyStepCount
+@property (nonatomic, readonly, assign) NSUInteger giantStepCount;
+
+/// The number of diagonals that are not entirely zero
+@property (nonatomic, readonly, assign) NSUInteger diagonalCount;
+
+/// The parametersId the diagonals were encoded at
+@property (nonatomic, readonly, assign) ASLParametersIdType parametersId;
+
+/// The rotation steps a multiplication performs. Galois keys for exactly these steps suffice.
+@property (nonatomic, readonly, copy) NSArray<NSNumber *> *galoisSteps;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,20 @@
+//
+//  ASLPlainMatrix_Internal.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLPlainMatrix.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ASLPlainMatrix ()
+
+/// Returns the encoded, pre-rotated diagonal k, or nil if diagonal k is entirely zero.
+- (ASLPlainText * _Nullable)diagonalAtIndex:(NSUInteger)index;
+
+@end
+
+NS_ASSUME_NONNULL_END
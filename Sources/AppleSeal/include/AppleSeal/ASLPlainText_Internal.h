@@ -19,6 +19,15 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)initWithPlainText:(seal::Plaintext)plainText;
 
+/// Returns a reference to the plaintext backing the receiver without copying it.
+- (seal::Plaintext const &)sealPlainTextReference;
+
+/// Returns a mutable reference to the plaintext backing the receiver.
+- (seal::Plaintext &)mutableSealPlainText;
+
+/// Incremented whenever the plaintext backing the receiver may have been modified, so
+/// values derived from it can be recognised as stale.
+@property (nonatomic, readonly, assign) NSUInteger mutationCount;
 
 @end
 
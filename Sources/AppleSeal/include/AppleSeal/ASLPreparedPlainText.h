@@ -0,0 +1,70 @@
+//
+//  ASLPreparedPlainText.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "ASLPlainText.h"
+#import "ASLParametersIdType.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ASLEvaluator;
+
+/*!
+ @class ASLPreparedPlainText
+
+ @brief A plaintext operand kept in NTT form at every level it is used at
+
+ @discussion Multiplying a ciphertext by a plaintext that is not in NTT form
+ transforms the plaintext on every call. A prepared plaintext performs that work
+ once per level: the first time it is used with a ciphertext at a given parametersId
+ it is transformed to NTT form (BFV) or switched down to that level (CKKS), and the
+ result is cached for every later use. ASLEvaluator's multiplyPlain:prepared: and
+ addPlain:prepared: methods accept it directly.
+
+ For BFV the plaintext must not be in NTT form. A ciphertext multiplied by it is
+ transformed to NTT form and back around the multiplication, so only the
+ ciphertext is transformed per call. Addition uses the plaintext as given.
+
+ For CKKS the plaintext is in NTT form at the level it was encoded at, and can be
+ used with ciphertexts at that level or any lower level.
+
+ The receiver copies the plaintext it is created from, so later changes to that
+ plaintext do not affect it. The cache holds at most one plaintext per level.
+
+ Thread Safety
+ A prepared plaintext may be used by any number of threads at once.
+ */
+@interface ASLPreparedPlainText : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ Creates a prepared plaintext and prepares it for the first level it can be used
+ at: the first data level for BFV, and the level of the plaintext for CKKS.
+
+ @param plain The plaintext to prepare
+ @param evaluator The evaluator used to transform the plaintext
+ @throws ASL_SealInvalidParameter if plain is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if, for BFV, plain is in NTT form
+ @throws ASL_SealInvalidParameter if, for CKKS, plain is not in NTT form
+ */
++ (instancetype _Nullable)preparedPlainTextWithPlainText:(ASLPlainText *)plain
+                                               evaluator:(ASLEvaluator *)evaluator
+                                                   error:(NSError **)error;
+
+/// The plaintext the receiver was created from
+@property (nonatomic, readonly, copy) ASLPlainText *plainText;
+
+/// The number of levels the receiver has been prepared for so far
+@property (nonatomic, readonly, assign) NSUInteger preparedLevelCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
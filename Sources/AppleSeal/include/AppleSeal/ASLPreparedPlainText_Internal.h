@@ -0,0 +1,27 @@
+//
+//  ASLPreparedPlainText_Internal.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLPreparedPlainText.h"
+
+#include <memory>
+#include "seal/plaintext.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ASLPreparedPlainText ()
+
+/// Returns a reference to the plaintext the receiver was created from without copying it.
+- (seal::Plaintext const &)sealPlainTextReference;
+
+/// Returns the plaintext in NTT form at the given parms_id, preparing and caching it
+/// on first use. Throws std::invalid_argument if it cannot be used at that level.
+- (std::shared_ptr<seal::Plaintext const>)nttPlainTextForParametersId:(seal::parms_id_type const &)parametersId;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,98 @@
+//
+//  ASLProductAccumulator.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "ASLCipherText.h"
+#import "ASLEvaluator.h"
+#import "ASLRelinearizationKeys.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+ @class ASLProductAccumulator
+
+ @brief Accumulates a sum of ciphertext products with a single relinearization
+
+ @discussion Relinearization is linear, so relinearizing every product of a dot
+ product and then adding gives the same result as adding the size 3 products and
+ relinearizing the sum once. The accumulator keeps its running sum at size 3 and
+ multiplies into a scratch ciphertext reserved for size 3, so accumulating a product
+ performs no allocation after the first one. The key switch runs once, when the sum
+ is requested.
+
+ All accumulated terms must be at the same level and, for CKKS, have the same scale.
+ The sum is not rescaled.
+
+ Thread Safety
+ An accumulator is not thread-safe. Use one accumulator per thread and add the
+ results, or use ASLEvaluator's multiplyAccumulate:encrypted2:relinearizationKeys:.
+ */
+@interface ASLProductAccumulator : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ Creates an empty accumulator that multiplies and adds with the given evaluator.
+
+ @param evaluator The evaluator used for every operation
+ */
++ (instancetype)accumulatorWithEvaluator:(ASLEvaluator *)evaluator;
+
+/// The number of terms accumulated since the accumulator was created or last reset
+@property (nonatomic, readonly, assign) NSUInteger termCount;
+
+/*!
+ Adds the product of two ciphertexts to the sum without relinearizing it.
+
+ @param encrypted1 The first ciphertext to multiply
+ @param encrypted2 The second ciphertext to multiply
+ @throws ASL_SealInvalidParameter if encrypted1 or encrypted2 is not valid for the
+ encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted1 and encrypted2 are at different level
+ or scale
+ @throws ASL_SealInvalidParameter if the product is at a different level or scale
+ than the sum
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+- (BOOL)multiply:(ASLCipherText *)encrypted1
+      encrypted2:(ASLCipherText *)encrypted2
+           error:(NSError **)error;
+
+/*!
+ Adds a ciphertext of size 2 or 3 to the sum.
+
+ @param encrypted The ciphertext to add
+ @throws ASL_SealInvalidParameter if encrypted is not valid for the encryption parameters
+ @throws ASL_SealInvalidParameter if encrypted is at a different level or scale than
+ the sum
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+- (BOOL)add:(ASLCipherText *)encrypted
+      error:(NSError **)error;
+
+/*!
+ Relinearizes the accumulated sum, returns it, and resets the accumulator.
+
+ @param relinearizationKeys The relinearization keys
+ @throws ASL_SealInvalidParameter if no terms have been accumulated
+ @throws ASL_SealInvalidParameter if relinearizationKeys is not valid for the
+ encryption parameters
+ @throws ASL_SealLogicError if keyswitching is not supported by the context
+ @throws ASL_SealLogicError if result ciphertext is transparent
+ */
+- (ASLCipherText * _Nullable)relinearizedSumWithRelinearizationKeys:(ASLRelinearizationKeys *)relinearizationKeys
+                                                              error:(NSError **)error;
+
+/// Discards the accumulated sum. The scratch memory is kept for reuse.
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
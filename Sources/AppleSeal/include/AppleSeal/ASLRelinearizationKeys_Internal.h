@@ -19,6 +19,9 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)initWithRelinearizationKeys:(seal::RelinKeys)RelinearizationKeys;
 
+/// Returns a reference to the relinearization keys backing the receiver without copying them.
+- (seal::RelinKeys const &)sealRelinKeysReference;
+
 @end
 
 @interface ASLSerializableRelineraizationKeys ()
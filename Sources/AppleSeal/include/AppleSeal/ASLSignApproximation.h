@@ -0,0 +1,118 @@
+//
+//  ASLSignApproximation.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+ @class ASLSignApproximation
+
+ @brief A composite polynomial approximating the sign function on [-1, 1]
+
+ @discussion CKKS can only evaluate polynomials, so ASLEvaluator's sign, step, max,
+ min and relu methods approximate sign(x) by composing a low-degree odd polynomial
+ with itself. An approximation of degree 2n + 1 first applies acceleratedIterations
+ iterations of g_n, which pull small inputs towards ±1 quickly, and then iterations
+ iterations of
+
+     f_n(x) = Σ_{i=0}^{n} 4^-i C(2i, i) x (1 - x^2)^i
+
+ which converge to ±1 with an error that roughly squares with every iteration
+ (Cheon, Kim, Kim, Lee and Lee, "Efficient Homomorphic Comparison Methods with
+ Optimal Complexity").
+
+ Precision
+ Inputs must lie in [-1, 1]. The error is bounded for inputs at least gap away from
+ zero, where gap is the smallest difference the caller needs to resolve, and grows
+ as gap shrinks. maximumErrorForInputGap: returns a guaranteed upper bound on the
+ error of an approximation, and cheapestApproximationForInputGap:maximumError:
+ returns the approximation of least depth whose bound meets the requirement. For
+ reference, the cheapest approximations for some common requirements are:
+
+     gap     error    degree  accelerated  iterations  depth
+     2^-4    2^-8       5          2            2         12
+     2^-4    2^-20      5          2            3         15
+     2^-8    2^-8       5          5            2         21
+     2^-8    2^-20      3          8            4         24
+     2^-12   2^-8       5          7            2         27
+     2^-12   2^-20      5          7            3         30
+
+ Depth is the number of levels sign and step consume; max, min and relu consume
+ one more.
+ */
+@interface ASLSignApproximation : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ Creates an approximation with the given polynomials.
+
+ @param degree The degree of each polynomial, one of 3, 5 or 7
+ @param acceleratedIterations The number of iterations of g_n
+ @param iterations The number of iterations of f_n
+ @throws ASL_SealInvalidParameter if degree is not 3, 5 or 7
+ @throws ASL_SealInvalidParameter if there are no iterations
+ */
++ (instancetype _Nullable)approximationWithDegree:(NSUInteger)degree
+                            acceleratedIterations:(NSUInteger)acceleratedIterations
+                                       iterations:(NSUInteger)iterations
+                                            error:(NSError **)error;
+
+/*!
+ Returns the approximation of least depth, and then of fewest multiplications, whose
+ error is at most maximumError for inputs at least gap away from zero, or nil if no
+ approximation of depth at most 48 meets the bound.
+
+ @param gap The smallest absolute input that must be resolved, in (0, 1]
+ @param maximumError The largest acceptable difference from sign(x)
+ */
++ (instancetype _Nullable)cheapestApproximationForInputGap:(double)gap
+                                              maximumError:(double)maximumError;
+
+/*!
+ Returns, for every depth up to maximumDepth that improves on the depths below it, the
+ approximation with the smallest error for inputs at least gap away from zero, ordered
+ by depth.
+
+ @param gap The smallest absolute input that must be resolved, in (0, 1]
+ @param maximumDepth The largest depth to include
+ */
++ (NSArray<ASLSignApproximation *> *)approximationsForInputGap:(double)gap
+                                                  maximumDepth:(NSUInteger)maximumDepth;
+
+/// The degree of each polynomial
+@property (nonatomic, readonly, assign) NSUInteger degree;
+
+/// The number of iterations of g_n
+@property (nonatomic, readonly, assign) NSUInteger acceleratedIterations;
+
+/// The number of iterations of f_n
+@property (nonatomic, readonly, assign) NSUInteger iterations;
+
+/// The number of levels evaluating sign consumes
+@property (nonatomic, readonly, assign) NSUInteger depth;
+
+/// The number of ciphertext multiplications evaluating sign performs
+@property (nonatomic, readonly, assign) NSUInteger multiplicationCount;
+
+/*!
+ Returns an upper bound on the difference between the approximation and sign(x) over
+ the inputs x with gap ≤ |x| ≤ 1. The range is split into cells whose images are
+ enclosed by interval arithmetic, and cells are bisected until every bound is within
+ 1/64 of the largest error found at a point, so the bound never underestimates the
+ error and rarely exceeds it by more than that.
+
+ @param gap The smallest absolute input, in (0, 1]
+ */
+- (double)maximumErrorForInputGap:(double)gap;
+
+@end
+
+NS_ASSUME_NONNULL_END
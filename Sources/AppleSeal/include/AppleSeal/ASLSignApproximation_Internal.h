@@ -0,0 +1,22 @@
+//
+//  ASLSignApproximation_Internal.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLSignApproximation.h"
+
+#include <vector>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ASLSignApproximation ()
+
+/// The coefficients of each polynomial in the order they are applied, constant term first.
+- (std::vector<std::vector<double>> const &)polynomials;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,107 @@
+//
+//  ASLSlotPermutation.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "ASLParametersIdType.h"
+#import "ASLCKKSEncoder.h"
+#import "ASLBatchEncoder.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class ASLEvaluator;
+
+/*!
+ @class ASLSlotPermutation
+
+ @brief A slot permutation compiled to a rotate-and-mask schedule
+
+ @discussion Describes a rearrangement of the slots of an encrypted vector in
+ which output slot i takes the value of input slot indices[i]. The indices may
+ describe any permutation, such as a transpose or shuffle, and may also repeat
+ an input slot, as in a gather. ASLEvaluator's permuteSlots:permutation:galoisKey:
+ applies it.
+
+ Compilation
+ Every output slot i reads the input rotated by some offset k, so the permutation
+ is the sum over the distinct offsets k of the input rotated by k and multiplied by
+ a mask selecting the output slots that use k. The offsets are split into baby
+ steps and giant steps, choosing the split that needs the fewest rotations: each
+ distinct baby step rotates the input once, and each distinct giant step rotates
+ one partial sum of masked baby steps once. The masks are encoded once, pre-rotated
+ for their giant step, so a compiled permutation is meant to be created once and
+ applied to many ciphertexts.
+
+ For BFV the slots form a 2-by-(N/2) matrix. Output slots that read from the other
+ row share the baby steps and are added after a single column rotation.
+ */
+@interface ASLSlotPermutation : NSObject
+
++ (instancetype)new NS_UNAVAILABLE;
+- (instancetype)init NS_UNAVAILABLE;
+
+/*!
+ Compiles a slot permutation for the CKKS scheme.
+
+ @param indices For each output slot, the input slot it takes its value from
+ @param encoder The CKKSEncoder
+ @param parametersId The parametersId of the ciphertexts the permutation will apply to
+ @param scale Scaling parameter of the masks
+ @throws ASL_SealInvalidParameter if indices does not have slotCount elements
+ @throws ASL_SealInvalidParameter if an index is not less than slotCount
+ @throws ASL_SealInvalidParameter if parametersId is not valid for the encryption
+ parameters
+ @throws ASL_SealInvalidParameter if scale is not strictly positive
+ */
++ (instancetype _Nullable)permutationWithIndices:(NSArray<NSNumber *> *)indices
+                                     ckksEncoder:(ASLCKKSEncoder *)encoder
+                                    parametersId:(ASLParametersIdType)parametersId
+                                           scale:(double)scale
+                                           error:(NSError **)error;
+
+/*!
+ Compiles a slot permutation for the BFV scheme. The masks are transformed to NTT
+ form at parametersId using the evaluator.
+
+ @param indices For each output slot, the input slot it takes its value from
+ @param encoder The BatchEncoder
+ @param evaluator The evaluator used to transform the masks to NTT form
+ @param parametersId The parametersId of the ciphertexts the permutation will apply to
+ @throws ASL_SealInvalidParameter if indices does not have slotCount elements
+ @throws ASL_SealInvalidParameter if an index is not less than slotCount
+ @throws ASL_SealInvalidParameter if parametersId is not valid for the encryption
+ parameters
+ */
++ (instancetype _Nullable)permutationWithIndices:(NSArray<NSNumber *> *)indices
+                                    batchEncoder:(ASLBatchEncoder *)encoder
+                                       evaluator:(ASLEvaluator *)evaluator
+                                    parametersId:(ASLParametersIdType)parametersId
+                                           error:(NSError **)error;
+
+/// The number of slots the permutation rearranges
+@property (nonatomic, readonly, assign) NSUInteger slotCount;
+
+/// The number of masks, one for each distinct rotation offset the permutation uses
+@property (nonatomic, readonly, assign) NSUInteger maskCount;
+
+/// The number of rotations applying the permutation performs
+@property (nonatomic, readonly, assign) NSUInteger rotationCount;
+
+/// The parametersId the masks were encoded at
+@property (nonatomic, readonly, assign) ASLParametersIdType parametersId;
+
+/*!
+ The rotation steps applying the permutation performs. Galois keys for exactly these
+ steps suffice. For BFV the steps include 0, which stands for the column rotation,
+ when any output slot reads from the other row.
+ */
+@property (nonatomic, readonly, copy) NSArray<NSNumber *> *galoisSteps;
+
+@end
+
+NS_ASSUME_NONNULL_END
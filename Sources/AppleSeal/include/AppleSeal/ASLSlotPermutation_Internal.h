@@ -0,0 +1,38 @@
+//
+//  ASLSlotPermutation_Internal.h
+//  AppleSeal
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+#import "ASLSlotPermutation.h"
+
+#include <utility>
+#include <vector>
+#include "seal/plaintext.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The masked baby steps that are summed and rotated together by one giant step.
+struct ASLSlotPermutationGroup {
+    /// The rotation applied to the partial sum of the group
+    int giantStep = 0;
+    /// Whether the partial sum belongs to output slots that read from the other row
+    bool swapsRows = false;
+    /// Pairs of an index into babySteps and the mask it is multiplied with, in NTT form
+    /// for BFV
+    std::vector<std::pair<size_t, seal::Plaintext>> terms;
+};
+
+@interface ASLSlotPermutation ()
+
+/// The distinct baby steps, each of which rotates the input once. Step 0 is the input itself.
+- (std::vector<int> const &)babySteps;
+
+/// The groups of masked baby steps, one per distinct giant step and row choice.
+- (std::vector<ASLSlotPermutationGroup> const &)groups;
+
+@end
+
+NS_ASSUME_NONNULL_END
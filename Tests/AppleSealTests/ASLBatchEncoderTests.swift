@@ -14,6 +14,7 @@ final class ASLBatchEncoderTests: XCTestCase {
     private var batchEncoder: ASLBatchEncoder!
     private var encryptor: ASLEncryptor!
     private var decryptor: ASLDecryptor!
+    private var plainModulus: UInt64 = 0
     
     override func setUp() {
         super.setUp()
@@ -22,7 +23,9 @@ final class ASLBatchEncoderTests: XCTestCase {
         let polyModulusDegree = 8192
         try! parms.setPolynomialModulusDegree(polyModulusDegree)
         try! parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
-        try! parms.setPlainModulus(ASLPlainModulus.batching(polyModulusDegree, bitSize: 20))
+        let modulus = try! ASLPlainModulus.batching(polyModulusDegree, bitSize: 20)
+        try! parms.setPlainModulus(modulus)
+        plainModulus = modulus.uint64Value
         
         let context = try! ASLSealContext(parms)
         let keygen = try! ASLKeyGenerator(context: context)
@@ -101,4 +104,90 @@ final class ASLBatchEncoderTests: XCTestCase {
         let decoded = try batchEncoder.decode(with: encodedPlainText, pool: ASLMemoryPoolHandle.global())
         XCTAssertEqual(try ASLPlainText(coefficientCount: 2), decoded)
     }
+    
+    func testEncodeWithUnsignedValuesDoesNotTruncate() throws {
+        XCTAssertThrowsError(try batchEncoder.encode(withUnsignedValues: [NSNumber(value: UInt64(1) << 32 | 5)]))
+    }
+    
+    func testDecodeSignedValuesReturnsNegatives() throws {
+        let encodedPlainText = try batchEncoder.encode(withSignedValues: [NSNumber(-4), NSNumber(9)])
+        let decoded = try batchEncoder.decodeSignedValues(with: encodedPlainText)
+        XCTAssertEqual(decoded[0], NSNumber(-4))
+        XCTAssertEqual(decoded[1], NSNumber(9))
+    }
+    
+    func testEncodeUInt64BufferMatchesArrayEncoding() throws {
+        let values = (0..<UInt64(batchEncoder.slotCount)).map { $0 * 7919 % plainModulus }
+        
+        let encoded = try batchEncoder.encodeUInt64Buffer(values, count: values.count)
+        
+        XCTAssertEqual(encoded, try batchEncoder.encode(withUnsignedValues: values.map { NSNumber(value: $0) }))
+        var decoded = [UInt64](repeating: 0, count: values.count)
+        try batchEncoder.decode(encoded, intoUInt64Buffer: &decoded, count: decoded.count)
+        XCTAssertEqual(decoded, values)
+    }
+    
+    func testEncodeUInt64BufferReducesValues() throws {
+        let values: [UInt64] = [plainModulus + 5, UInt64.max, 7]
+        
+        let encoded = try batchEncoder.encodeUInt64Buffer(values, count: values.count)
+        
+        var decoded = [UInt64](repeating: 1, count: 4)
+        try batchEncoder.decode(encoded, intoUInt64Buffer: &decoded, count: decoded.count)
+        XCTAssertEqual(decoded, [5, UInt64.max % plainModulus, 7, 0])
+    }
+    
+    func testEncodeInt64BufferRoundTrips() throws {
+        let values: [Int64] = [-3, 4, -Int64(plainModulus) - 2, Int64.min]
+        
+        let encoded = try batchEncoder.encodeInt64Buffer(values, count: values.count)
+        
+        XCTAssertEqual(try batchEncoder.decodeSignedValues(with: encoded).prefix(2), [NSNumber(-3), NSNumber(4)])
+        var decoded = [Int64](repeating: 0, count: values.count)
+        try batchEncoder.decode(encoded, intoInt64Buffer: &decoded, count: decoded.count)
+        XCTAssertEqual(decoded[0...2], [-3, 4, -2])
+        XCTAssertEqual((decoded[3] - Int64.min % Int64(plainModulus)) % Int64(plainModulus), 0)
+    }
+    
+    func testBufferCountLargerThanSlotCountThrows() throws {
+        let values = [UInt64](repeating: 1, count: batchEncoder.slotCount + 1)
+        XCTAssertThrowsError(try batchEncoder.encodeUInt64Buffer(values, count: values.count))
+        
+        var decoded = [UInt64](repeating: 0, count: values.count)
+        let encoded = try batchEncoder.encodeUInt64Buffer(values, count: batchEncoder.slotCount)
+        XCTAssertThrowsError(try batchEncoder.decode(encoded, intoUInt64Buffer: &decoded, count: decoded.count))
+    }
+    
+    func testEncodeBatchUInt64BufferMatchesChunkedEncoding() throws {
+        let slotCount = batchEncoder.slotCount
+        let values = (0..<UInt64(2 * slotCount + 3)).map { $0 % plainModulus }
+        
+        let encoded = try batchEncoder.encodeBatchUInt64Buffer(values, count: values.count)
+        
+        XCTAssertEqual(encoded.count, 3)
+        try values.withUnsafeBufferPointer { buffer in
+            for (chunk, plain) in encoded.enumerated() {
+                let begin = chunk * slotCount
+                let count = min(slotCount, values.count - begin)
+                XCTAssertEqual(plain, try batchEncoder.encodeUInt64Buffer(buffer.baseAddress! + begin, count: count))
+            }
+        }
+        var decoded = [UInt64](repeating: 1, count: 4)
+        try batchEncoder.decode(encoded[2], intoUInt64Buffer: &decoded, count: decoded.count)
+        XCTAssertEqual(decoded, Array(values[(2 * slotCount)...]) + [0])
+    }
+    
+    func testEncodeBatchInt64BufferIsIndependentOfConcurrency() throws {
+        let values = (0..<Int64(3 * batchEncoder.slotCount)).map { $0 % 2 == 0 ? -$0 : $0 }
+        
+        let concurrent = try batchEncoder.encodeBatchInt64Buffer(values, count: values.count)
+        batchEncoder.batchConcurrency = 1
+        let serial = try batchEncoder.encodeBatchInt64Buffer(values, count: values.count)
+        
+        XCTAssertEqual(concurrent, serial)
+    }
+    
+    func testEncodeBatchOfEmptyBufferIsEmpty() throws {
+        XCTAssertEqual(try batchEncoder.encodeBatchUInt64Buffer([], count: 0).count, 0)
+    }
 }
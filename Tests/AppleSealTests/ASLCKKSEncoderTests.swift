@@ -192,11 +192,203 @@ class ASLCKKSEncoderTests: XCTestCase {
         }
     }
     
+    func testEncodeDoublesMatchesEncodeDoubleValues() throws {
+        let encoder = try createEncoder()
+        let scale = Double(pow((2.0), 30))
+        let values = [0.0, 1.1, 2.2, 3.3]
+        
+        let fromBuffer = try encoder.encodeDoubles(values, count: values.count, scale: scale)
+        let fromArray = try encoder.encode(withDoubleValues: values.map { NSNumber(value: $0) }, scale: scale)
+        
+        XCTAssertEqual(fromBuffer, fromArray)
+    }
+    
+    func testEncodeDoublesWithParams() throws {
+        let encoder = try createEncoder()
+        let values = [2.0]
+        let params = ASLParametersIdType(block: (40, 40, 40, 40))
+        
+        XCTAssertThrowsError(try encoder.encodeDoubles(values, count: values.count, scale: 2.0, parametersId: params))
+    }
+    
+    func testEncodeDoublesBeyondSlotCountThrows() throws {
+        let encoder = try createEncoder()
+        let values = [Double](repeating: 1.0, count: encoder.slotCount + 1)
+        
+        XCTAssertThrowsError(try encoder.encodeDoubles(values, count: values.count, scale: 2.0))
+    }
+    
+    func testDecodeDoubles() throws {
+        let encoder = try createEncoder()
+        let plain = try encoder.encodeDoubles([0.0, 1.1, 2.2, 3.3], count: 4, scale: Double(pow((2.0), 30)))
+        
+        var result = [Double](repeating: .nan, count: encoder.slotCount + 1)
+        try encoder.decodeDoubles(plain, into: &result, capacity: result.count)
+        
+        XCTAssertEqual(result[0], 0.0, accuracy: 0.0000001);
+        XCTAssertEqual(result[1], 1.1, accuracy: 0.0000001);
+        XCTAssertEqual(result[2], 2.2, accuracy: 0.0000001);
+        XCTAssertEqual(result[3], 3.3, accuracy: 0.0000001);
+        
+        for value in result[4 ..< encoder.slotCount] {
+            XCTAssertEqual(value, 0.0, accuracy: 0.0000001);
+        }
+        XCTAssertTrue(result[encoder.slotCount].isNaN)
+    }
+    
+    func testDecodeDoublesWritesAtMostCapacity() throws {
+        let encoder = try createEncoder()
+        let plain = try encoder.encodeDoubles([1.1, 2.2], count: 2, scale: Double(pow((2.0), 30)))
+        
+        var result = [Double](repeating: .nan, count: 2)
+        try encoder.decodeDoubles(plain, into: &result, capacity: 1)
+        
+        XCTAssertEqual(result[0], 1.1, accuracy: 0.0000001);
+        XCTAssertTrue(result[1].isNaN)
+    }
+    
+    func testEncodeAndDecodeComplexDoubles() throws {
+        let encoder = try createEncoder()
+        let scale = Double(pow((2.0), 30))
+        let interleaved = [1.0, -1.0, 2.5, 0.5]
+        
+        let plain = try encoder.encodeComplexDoubles(interleaved, count: 2, scale: scale)
+        let fromArray = try encoder.encode(withComplexValues: [ASLComplexType(real: 1.0, imaginary: -1.0),
+                                                               ASLComplexType(real: 2.5, imaginary: 0.5)], scale: scale)
+        XCTAssertEqual(plain, fromArray)
+        
+        var result = [Double](repeating: .nan, count: 2 * encoder.slotCount)
+        try encoder.decodeComplexDoubles(plain, into: &result, capacity: encoder.slotCount)
+        
+        for (index, value) in interleaved.enumerated() {
+            XCTAssertEqual(result[index], value, accuracy: 0.0000001);
+        }
+        for value in result[interleaved.count ..< result.endIndex] {
+            XCTAssertEqual(value, 0.0, accuracy: 0.0000001);
+        }
+    }
+    
+    func testEncodeBatchDoublesMatchesChunkedEncoding() throws {
+        let context = try createContext()
+        let encoder = try ASLCKKSEncoder(context: context)
+        let scale = Double(pow((2.0), 30))
+        let slotCount = encoder.slotCount
+        let values = (0..<(slotCount + 5)).map { Double($0) / 16 }
+        
+        let encoded = try encoder.encodeBatchDoubles(values, count: values.count, scale: scale, parametersId: context.lastParameterIds)
+        
+        XCTAssertEqual(encoded.count, 2)
+        try values.withUnsafeBufferPointer { buffer in
+            XCTAssertEqual(encoded[0], try encoder.encodeDoubles(buffer.baseAddress!, count: slotCount, scale: scale, parametersId: context.lastParameterIds))
+            XCTAssertEqual(encoded[1], try encoder.encodeDoubles(buffer.baseAddress! + slotCount, count: 5, scale: scale, parametersId: context.lastParameterIds))
+        }
+        XCTAssertEqual(try encoder.encodeBatchDoubles(values, count: values.count, scale: scale).count, 2)
+    }
+    
+    func testEncodeBatchDoublesWithInvalidParamsThrows() throws {
+        let encoder = try createEncoder()
+        let values = [Double](repeating: 1.0, count: 2 * encoder.slotCount)
+        let params = ASLParametersIdType(block: (40, 40, 40, 40))
+        
+        XCTAssertThrowsError(try encoder.encodeBatchDoubles(values, count: values.count, scale: 2.0, parametersId: params))
+    }
+    
+    func testPreparedPlainForValueIsCached() throws {
+        let context = try createContext()
+        let encoder = try ASLCKKSEncoder(context: context)
+        let scale = Double(pow((2.0), 30))
+        
+        let first = try encoder.preparedPlain(forValue: 1.5, scale: scale, parametersId: context.firstParameterIds)
+        let second = try encoder.preparedPlain(forValue: 1.5, scale: scale, parametersId: context.firstParameterIds)
+        
+        XCTAssertTrue(first === second)
+        XCTAssertEqual(first.scale, scale)
+        XCTAssertEqual(first, try encoder.encode(withDoubleValue: 1.5, parametersId: context.firstParameterIds, scale: scale))
+        XCTAssertEqual(encoder.preparedPlainCacheHitCount, 1)
+        XCTAssertEqual(encoder.preparedPlainCacheMissCount, 1)
+    }
+    
+    func testPreparedPlainKeysOnValuesScaleAndLevel() throws {
+        let context = try createContext()
+        let encoder = try ASLCKKSEncoder(context: context)
+        let scale = Double(pow((2.0), 30))
+        
+        let scalar = try encoder.preparedPlain(forValue: 1.5, scale: scale, parametersId: context.firstParameterIds)
+        let vector = try encoder.preparedPlain(forValues: [1.5], scale: scale, parametersId: context.firstParameterIds)
+        let buffer = try encoder.preparedPlain(forDoubles: [1.5], count: 1, scale: scale, parametersId: context.firstParameterIds)
+        let rescaled = try encoder.preparedPlain(forValue: 1.5, scale: scale * 2, parametersId: context.firstParameterIds)
+        let lastLevel = try encoder.preparedPlain(forValue: 1.5, scale: scale, parametersId: context.lastParameterIds)
+        
+        XCTAssertFalse(scalar === vector)
+        XCTAssertTrue(vector === buffer)
+        XCTAssertFalse(scalar === rescaled)
+        XCTAssertFalse(scalar === lastLevel)
+        XCTAssertEqual(encoder.preparedPlainCacheCount, 4)
+        XCTAssertEqual(encoder.preparedPlainCacheHitCount, 1)
+    }
+    
+    func testPreparedPlainEvictsLeastRecentlyUsed() throws {
+        let context = try createContext()
+        let encoder = try ASLCKKSEncoder(context: context)
+        encoder.preparedPlainCacheCapacity = 2
+        let scale = Double(pow((2.0), 30))
+        
+        let one = try encoder.preparedPlain(forValue: 1, scale: scale, parametersId: context.firstParameterIds)
+        let two = try encoder.preparedPlain(forValue: 2, scale: scale, parametersId: context.firstParameterIds)
+        XCTAssertTrue(one === (try encoder.preparedPlain(forValue: 1, scale: scale, parametersId: context.firstParameterIds)))
+        _ = try encoder.preparedPlain(forValue: 3, scale: scale, parametersId: context.firstParameterIds)
+        
+        XCTAssertEqual(encoder.preparedPlainCacheCount, 2)
+        XCTAssertTrue(one === (try encoder.preparedPlain(forValue: 1, scale: scale, parametersId: context.firstParameterIds)))
+        XCTAssertFalse(two === (try encoder.preparedPlain(forValue: 2, scale: scale, parametersId: context.firstParameterIds)))
+        
+        encoder.removeAllPreparedPlains()
+        XCTAssertEqual(encoder.preparedPlainCacheCount, 0)
+    }
+    
+    func testPreparedPlainZeroCapacityDisablesCaching() throws {
+        let context = try createContext()
+        let encoder = try ASLCKKSEncoder(context: context)
+        encoder.preparedPlainCacheCapacity = 0
+        let scale = Double(pow((2.0), 30))
+        
+        let first = try encoder.preparedPlain(forValue: 1.5, scale: scale, parametersId: context.firstParameterIds)
+        let second = try encoder.preparedPlain(forValue: 1.5, scale: scale, parametersId: context.firstParameterIds)
+        
+        XCTAssertFalse(first === second)
+        XCTAssertEqual(first, second)
+        XCTAssertEqual(encoder.preparedPlainCacheCount, 0)
+    }
+    
+    func testPreparedPlainModifiedIsEncodedAgain() throws {
+        let context = try createContext()
+        let encoder = try ASLCKKSEncoder(context: context)
+        let scale = Double(pow((2.0), 30))
+        
+        let first = try encoder.preparedPlain(forValue: 1.5, scale: scale, parametersId: context.firstParameterIds)
+        first.setZero()
+        let second = try encoder.preparedPlain(forValue: 1.5, scale: scale, parametersId: context.firstParameterIds)
+        
+        XCTAssertFalse(first === second)
+        XCTAssertEqual(encoder.preparedPlainCacheHitCount, 0)
+    }
+    
+    func testPreparedPlainWithInvalidParamsThrows() throws {
+        let encoder = try createEncoder()
+        let params = ASLParametersIdType(block: (40, 40, 40, 40))
+        
+        XCTAssertThrowsError(try encoder.preparedPlain(forValue: 1.5, scale: 2.0, parametersId: params))
+        XCTAssertEqual(encoder.preparedPlainCacheCount, 0)
+    }
+    
     func createEncoder() throws -> ASLCKKSEncoder {
+        return try ASLCKKSEncoder(context: createContext())
+    }
+    
+    func createContext() throws -> ASLSealContext {
         let params = ASLEncryptionParameters(schemeType: .CKKS)
         try params.setPolynomialModulusDegree(8192)
         try params.setCoefficientModulus(ASLCoefficientModulus.create(8192, bitSizes: [40, 40, 40, 40, 40]))
-        let context = try ASLSealContext(encrytionParameters: params, expandModChain: true, securityLevel: .None, memoryPoolHandle: ASLMemoryPoolHandle(clearOnDestruction: true))
-        return try ASLCKKSEncoder(context: context)
+        return try ASLSealContext(encrytionParameters: params, expandModChain: true, securityLevel: .None, memoryPoolHandle: ASLMemoryPoolHandle(clearOnDestruction: true))
     }
 }
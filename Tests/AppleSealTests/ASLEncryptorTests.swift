@@ -93,6 +93,74 @@ class ASLEncryptorTests: XCTestCase {
         XCTAssertNoThrow(try encryptor.setSecretKey(otherSecretKey))
     }
     
+    func testEncryptUInt64BufferRoundTrips() throws {
+        let context = try batchingContext()
+        let keygen = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keygen.publicKey, secretKey: keygen.secretKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keygen.secretKey)
+        let batchEncoder = try ASLBatchEncoder(context: context)
+        let values: [UInt64] = [1, 2, 3, 4]
+        let destination = ASLCipherText()
+        
+        for symmetric in [false, true] {
+            if symmetric {
+                try encryptor.encryptSymmetricUInt64Buffer(values, count: values.count, encoder: batchEncoder, into: destination)
+            } else {
+                try encryptor.encryptUInt64Buffer(values, count: values.count, encoder: batchEncoder, into: destination)
+            }
+            
+            var decoded = [UInt64](repeating: 1, count: values.count + 1)
+            try batchEncoder.decode(decryptor.decrypt(destination), intoUInt64Buffer: &decoded, count: decoded.count)
+            XCTAssertEqual(decoded, values + [0])
+        }
+    }
+    
+    func testEncryptDoublesRoundTrips() throws {
+        let parms = ASLEncryptionParameters(schemeType: .CKKS)
+        try parms.setPolynomialModulusDegree(8192)
+        try parms.setCoefficientModulus(ASLCoefficientModulus.create(8192, bitSizes: [60, 40, 40, 60]))
+        let context = try ASLSealContext(parms)
+        let keygen = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keygen.publicKey, secretKey: keygen.secretKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keygen.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let values = [0.5, -1.25, 3.0]
+        let destination = ASLCipherText()
+        
+        for symmetric in [false, true] {
+            if symmetric {
+                try encryptor.encryptSymmetricDoubles(values, count: values.count, scale: pow(2.0, 40), encoder: ckksEncoder, into: destination)
+            } else {
+                try encryptor.encryptDoubles(values, count: values.count, scale: pow(2.0, 40), encoder: ckksEncoder, into: destination)
+            }
+            
+            var decoded = [Double](repeating: .nan, count: values.count)
+            try ckksEncoder.decodeDoubles(decryptor.decrypt(destination), into: &decoded, capacity: decoded.count)
+            for (value, expected) in zip(decoded, values) {
+                XCTAssertEqual(value, expected, accuracy: 0.0001)
+            }
+        }
+    }
+    
+    func testEncryptBufferFailures() throws {
+        let context = try batchingContext()
+        let keygen = try ASLKeyGenerator(context: context)
+        let publicOnly = try ASLEncryptor(context: context, publicKey: keygen.publicKey)
+        let batchEncoder = try ASLBatchEncoder(context: context)
+        let values = [UInt64](repeating: 1, count: batchEncoder.slotCount + 1)
+        
+        XCTAssertThrowsError(try publicOnly.encryptSymmetricUInt64Buffer(values, count: 1, encoder: batchEncoder, into: ASLCipherText()))
+        XCTAssertThrowsError(try publicOnly.encryptUInt64Buffer(values, count: values.count, encoder: batchEncoder, into: ASLCipherText()))
+    }
+    
+    private func batchingContext() throws -> ASLSealContext {
+        let parms = ASLEncryptionParameters(schemeType: .BFV)
+        try parms.setPolynomialModulusDegree(4096)
+        try parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(4096))
+        try parms.setPlainModulus(ASLPlainModulus.batching(4096, bitSize: 20))
+        return try ASLSealContext(parms)
+    }
+    
     private func createEncryptor() -> ASLEncryptor {
         let context = ASLSealContext.bfvDefault()
         let keygen = try! ASLKeyGenerator(context: context)
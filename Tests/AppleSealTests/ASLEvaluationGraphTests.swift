@@ -0,0 +1,123 @@
+//
+//  ASLEvaluationGraphTests.swift
+//  AppleSealTests
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+import AppleSeal
+import XCTest
+
+class ASLEvaluationGraphTests: XCTestCase {
+
+    var context: ASLSealContext!
+    var keyGenerator: ASLKeyGenerator!
+    var encryptor: ASLEncryptor!
+    var decryptor: ASLDecryptor!
+    var encoder: ASLIntegerEncoder!
+    var evaluator: ASLEvaluator!
+
+    override func setUp() {
+        super.setUp()
+        let parms = ASLEncryptionParameters(schemeType: .BFV)
+        let polyModulusDegree = 4096
+        try! parms.setPolynomialModulusDegree(polyModulusDegree)
+        try! parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        try! parms.setPlainModulus(ASLModulus(value: 512))
+        context = try! ASLSealContext(parms)
+        keyGenerator = try! ASLKeyGenerator(context: context)
+        encryptor = try! ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        decryptor = try! ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        encoder = try! ASLIntegerEncoder(context: context)
+        evaluator = try! ASLEvaluator(context)
+    }
+
+    override func tearDown() {
+        super.tearDown()
+        context = nil
+        keyGenerator = nil
+        encryptor = nil
+        decryptor = nil
+        encoder = nil
+        evaluator = nil
+    }
+
+    func testNodeCount() throws {
+        let graph = ASLEvaluationGraph(evaluator: evaluator)
+        let x = graph.input(try encrypt(3))
+        _ = graph.add(x, encrypted2: x)
+        XCTAssertEqual(graph.nodeCount, 2)
+    }
+
+    func testSumOfRelinearizedProducts() throws {
+        let graph = ASLEvaluationGraph(evaluator: evaluator)
+        graph.relinearizationKeys = try keyGenerator.relinearizationKeysLocal()
+        let a = graph.input(try encrypt(2))
+        let b = graph.input(try encrypt(3))
+        let c = graph.input(try encrypt(4))
+        let ab = graph.relinearize(graph.multiply(a, encrypted2: b))
+        let bc = graph.relinearize(graph.multiply(b, encrypted2: c))
+        let cc = graph.relinearize(graph.square(c))
+        let sum = graph.add(graph.add(ab, encrypted2: bc), encrypted2: cc)
+
+        let result = try graph.evaluate(sum)
+        XCTAssertEqual(result.size, 2)
+        XCTAssertEqual(try decrypt(result), 2 * 3 + 3 * 4 + 4 * 4)
+    }
+
+    func testOptimizedAndUnoptimizedResultsMatch() throws {
+        for optimizationEnabled in [true, false] {
+            let graph = ASLEvaluationGraph(evaluator: evaluator)
+            graph.optimizationEnabled = optimizationEnabled
+            graph.relinearizationKeys = try keyGenerator.relinearizationKeysLocal()
+            let a = graph.input(try encrypt(5))
+            let b = graph.input(try encrypt(7))
+            let product = graph.relinearize(graph.multiply(a, encrypted2: b))
+            let difference = graph.sub(product, encrypted2: graph.relinearize(graph.square(a)))
+            let shifted = graph.addPlain(graph.modSwitchToNext(difference), plain: encoder.encodeInt64Value(1))
+
+            let results = try graph.evaluateOutputs([shifted, product])
+            XCTAssertEqual(try decrypt(results[0]), 5 * 7 - 5 * 5 + 1)
+            XCTAssertEqual(try decrypt(results[1]), 5 * 7)
+        }
+    }
+
+    func testInputsAreNotMutated() throws {
+        let encrypted = try encrypt(6)
+        let graph = ASLEvaluationGraph(evaluator: evaluator)
+        let x = graph.input(encrypted)
+        let doubled = graph.add(x, encrypted2: x)
+        let output = graph.negate(doubled)
+
+        XCTAssertEqual(try decrypt(try graph.evaluate(output)), -12)
+        XCTAssertEqual(try decrypt(encrypted), 6)
+        XCTAssertEqual(try decrypt(try graph.evaluate(x)), 6)
+    }
+
+    func testDeadNodesAreNotEvaluated() throws {
+        let graph = ASLEvaluationGraph(evaluator: evaluator)
+        let x = graph.input(try encrypt(4))
+        // Would fail without Galois keys, but nothing requested depends on it.
+        _ = graph.rotateRows(x, steps: 1)
+        let output = graph.multiplyPlain(x, plain: encoder.encodeInt64Value(3))
+
+        XCTAssertEqual(try decrypt(try graph.evaluate(output)), 12)
+    }
+
+    func testRelinearizeWithoutKeysThrows() throws {
+        let graph = ASLEvaluationGraph(evaluator: evaluator)
+        let x = graph.input(try encrypt(2))
+        let output = graph.relinearize(graph.square(x))
+        XCTAssertThrowsError(try graph.evaluate(output))
+    }
+
+    private func encrypt(_ value: Int64) throws -> ASLCipherText {
+        try encryptor.encrypt(with: encoder.encodeInt64Value(value))
+    }
+
+    private func decrypt(_ encrypted: ASLCipherText) throws -> Int32 {
+        let decrypted = try decryptor.decrypt(encrypted)
+        return try encoder.decodeInt32(withPlain: decrypted).int32Value
+    }
+}
@@ -0,0 +1,115 @@
+//
+//  ASLEvaluationQueueTests.swift
+//  AppleSealTests
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+import AppleSeal
+import XCTest
+
+class ASLEvaluationQueueTests: XCTestCase {
+
+    // MARK: - Tests
+
+    func testRunsHighestPriorityFirst() throws {
+        let queue = ASLEvaluationQueue(maximumConcurrentTasks: 1, capacity: 10)
+        let release = try occupy(queue)
+        var order: [ASLEvaluationPriority] = []
+
+        for priority in [ASLEvaluationPriority.low, .high, .normal, .high] {
+            try queue.submit(with: priority, block: { _ in order.append(priority) }, cancellationHandler: nil)
+        }
+        XCTAssertEqual(queue.waitingTaskCount, 4)
+        XCTAssertEqual(queue.runningTaskCount, 1)
+
+        release.signal()
+        queue.waitUntilAllTasksAreFinished()
+
+        XCTAssertEqual(order, [.high, .high, .normal, .low])
+        XCTAssertEqual(queue.waitingTaskCount, 0)
+        XCTAssertEqual(queue.runningTaskCount, 0)
+    }
+
+    func testSubmitBeyondCapacityThrows() throws {
+        let queue = ASLEvaluationQueue(maximumConcurrentTasks: 1, capacity: 1)
+        let release = try occupy(queue)
+
+        let task = try queue.submit(with: .normal, block: { _ in }, cancellationHandler: nil)
+        XCTAssertThrowsError(try queue.submit(with: .high, block: { _ in }, cancellationHandler: nil)) { error in
+            XCTAssertEqual((error as NSError).domain, ASLEvaluationQueueErrorDomain)
+            XCTAssertEqual((error as NSError).code, ASLEvaluationQueueErrorCode.full.rawValue)
+        }
+
+        release.signal()
+        queue.waitUntilAllTasksAreFinished()
+        XCTAssertTrue(task.isFinished)
+    }
+
+    func testCancelWaitingTask() throws {
+        let queue = ASLEvaluationQueue(maximumConcurrentTasks: 1, capacity: 10)
+        let release = try occupy(queue)
+        var ran = false
+        var cancellations = 0
+
+        let task = try queue.submit(with: .normal, block: { _ in ran = true }, cancellationHandler: { cancellations += 1 })
+        XCTAssertTrue(task.cancel())
+        XCTAssertFalse(task.cancel())
+        XCTAssertEqual(queue.waitingTaskCount, 0)
+
+        release.signal()
+        queue.waitUntilAllTasksAreFinished()
+
+        XCTAssertFalse(ran)
+        XCTAssertEqual(cancellations, 1)
+        XCTAssertTrue(task.isCancelled)
+        XCTAssertFalse(task.isFinished)
+    }
+
+    func testCancelFinishedTaskHasNoEffect() throws {
+        let queue = ASLEvaluationQueue(maximumConcurrentTasks: 2, capacity: 10)
+        var cancellations = 0
+
+        let task = try queue.submit(with: .normal, block: { _ in }, cancellationHandler: { cancellations += 1 })
+        queue.waitUntilAllTasksAreFinished()
+
+        XCTAssertFalse(task.cancel())
+        XCTAssertTrue(task.isFinished)
+        XCTAssertEqual(cancellations, 0)
+    }
+
+    func testCancelAllTasks() throws {
+        let queue = ASLEvaluationQueue(maximumConcurrentTasks: 1, capacity: 10)
+        let started = DispatchSemaphore(value: 0)
+        let release = DispatchSemaphore(value: 0)
+        let running = try queue.submit(with: .normal, block: { task in
+            started.signal()
+            release.wait()
+            XCTAssertTrue(task.isCancelled)
+        }, cancellationHandler: nil)
+        started.wait()
+        let waiting = try (0..<3).map { _ in try queue.submit(with: .low, block: { _ in }, cancellationHandler: nil) }
+
+        queue.cancelAllTasks()
+        release.signal()
+        queue.waitUntilAllTasksAreFinished()
+
+        XCTAssertTrue(running.isCancelled)
+        XCTAssertTrue(waiting.allSatisfy { $0.isCancelled })
+    }
+
+    // MARK: - Helpers
+
+    /// Submits a task that occupies a worker of queue until the returned semaphore is signalled.
+    private func occupy(_ queue: ASLEvaluationQueue) throws -> DispatchSemaphore {
+        let started = DispatchSemaphore(value: 0)
+        let release = DispatchSemaphore(value: 0)
+        try queue.submit(with: .low, block: { _ in
+            started.signal()
+            release.wait()
+        }, cancellationHandler: nil)
+        started.wait()
+        return release
+    }
+}
@@ -83,14 +83,75 @@ class ASLEvaluatorTests: XCTestCase {
         XCTAssertNoThrow(try evaluator.addInplace(encryptedFive, encrypted2: encryptedFive))
     }
     
+    func testInplaceOperationsMutateOperand() throws {
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let encrypted = try encryptor.encrypt(with: plainFive)
+        
+        let added = try evaluator.addInplace(encrypted, encrypted2: encrypted)
+        XCTAssertTrue(added === encrypted)
+        
+        let negated = try evaluator.negateInplace(encrypted)
+        XCTAssertTrue(negated === encrypted)
+        
+        let decrypted = try decryptor.decrypt(encrypted)
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decrypted), -10)
+    }
+    
     func testAdd() throws {
         XCTAssertNoThrow(try evaluator.add(encryptedFive, encrypted2: encryptedFive))
     }
+
+    func testAddIntoDestination() throws {
+        let destination = ASLCipherText()
+        XCTAssertNoThrow(try evaluator.add(encryptedFive, encrypted2: encryptedFive, into: destination))
+        XCTAssertEqual(destination.size, 2)
+    }
+
+    func testIntoDestinationDoesNotGrowPool() throws {
+        let pool = ASLMemoryPoolHandle(clearOnDestruction: false)
+        let evaluator = self.evaluator
+        let encrypted1 = encryptedFive
+        let encrypted2 = encryptedSeven
+        let destination = try ASLCipherText(context: context, parametersId: params, sizeCapacity: 3, pool: pool)
+
+        // Warm up so the destination and the pool's scratch buffers reach their steady-state size.
+        try evaluator.multiply(encrypted1, encrypted2: encrypted2, into: destination, pool: pool)
+        try evaluator.add(encrypted1, encrypted2: encrypted2, into: destination)
+        let allocatedByteCount = pool.allocatedByteCount
+        let sizeCapacity = destination.sizeCapacity
+
+        for _ in 0..<10 {
+            try evaluator.multiply(encrypted1, encrypted2: encrypted2, into: destination, pool: pool)
+            try evaluator.add(encrypted1, encrypted2: encrypted2, into: destination)
+            try evaluator.negate(encrypted1, into: destination)
+        }
+
+        XCTAssertEqual(pool.allocatedByteCount, allocatedByteCount)
+        XCTAssertEqual(destination.sizeCapacity, sizeCapacity)
+    }
     
     func testAddMany() throws {
         XCTAssertNoThrow(try evaluator.addMany([encryptedFive, encryptedFive, encryptedFive]))
     }
     
+    func testAddManySumsEveryInput() throws {
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let encrypteds = try (0..<37).map { _ in try encryptor.encrypt(with: plainFive) }
+
+        let sum = try evaluator.addMany(encrypteds)
+
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(sum)), 185)
+    }
+    
+    func testAddManyIntoInputThrows() throws {
+        let encrypted = encryptedFive
+        XCTAssertThrowsError(try evaluator.addMany([encrypted, encryptedSeven], into: encrypted))
+    }
+    
     func testSubInplace() throws {
         XCTAssertNoThrow(try evaluator.subInplace(encryptedSeven, encrypted2: encryptedFive))
     }
@@ -242,6 +303,36 @@ class ASLEvaluatorTests: XCTestCase {
         XCTAssertNoThrow(try evaluator.rescale(to: five, parametersId: params, pool: .global()))
     }
     
+    func testMultiplyRelinearizeRescale() throws {
+        let fixture = try fusedFixture()
+        let fused = try evaluator.multiplyRelinearizeRescale(fixture.encrypted1, encrypted2: fixture.encrypted2, relinearizationKeys: fixture.relinKeys)
+        let product = try evaluator.multiply(fixture.encrypted1, encrypted2: fixture.encrypted2)
+        let unfused = try evaluator.rescale(toNext: evaluator.relinearize(product, relinearizationKeys: fixture.relinKeys))
+        try assertFused(fused, matches: unfused, fixture: fixture)
+    }
+    
+    func testMultiplyRelinearizeRescaleWithPool() throws {
+        let fixture = try fusedFixture()
+        let fused = try evaluator.multiplyRelinearizeRescale(fixture.encrypted1, encrypted2: fixture.encrypted2, relinearizationKeys: fixture.relinKeys, pool: .global())
+        let product = try evaluator.multiply(fixture.encrypted1, encrypted2: fixture.encrypted2)
+        let unfused = try evaluator.rescale(toNext: evaluator.relinearize(product, relinearizationKeys: fixture.relinKeys))
+        try assertFused(fused, matches: unfused, fixture: fixture)
+    }
+    
+    func testMultiplyPlainRescale() throws {
+        let fixture = try fusedFixture()
+        let fused = try evaluator.multiplyPlainRescale(fixture.encrypted1, plain: fixture.plain2)
+        let unfused = try evaluator.rescale(toNext: evaluator.multiplyPlain(fixture.encrypted1, plain: fixture.plain2))
+        try assertFused(fused, matches: unfused, fixture: fixture)
+    }
+    
+    func testMultiplyPlainRescaleWithPool() throws {
+        let fixture = try fusedFixture()
+        let fused = try evaluator.multiplyPlainRescale(fixture.encrypted1, plain: fixture.plain2, pool: .global())
+        let unfused = try evaluator.rescale(toNext: evaluator.multiplyPlain(fixture.encrypted1, plain: fixture.plain2))
+        try assertFused(fused, matches: unfused, fixture: fixture)
+    }
+    
     func testMultiplyMany() throws {
         context = standardContext()
         XCTAssertNoThrow(try evaluator.multiplyMany([encryptedFive, encryptedFive], relinearizationKeys: relinKeys))
@@ -252,6 +343,23 @@ class ASLEvaluatorTests: XCTestCase {
         XCTAssertNoThrow(try evaluator.multiplyMany([encryptedFive, encryptedSeven], relinearizationKeys: relinKeys, pool: .global()))
     }
     
+    func testMultiplyManyRescalesEachTreeLevel() throws {
+        context = deepCkksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let encrypteds = try (0..<5).map { _ in
+            try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 0.9, scale: pow(2.0, 40)))
+        }
+
+        let product = try evaluator.multiplyMany(encrypteds, relinearizationKeys: keyGenerator.relinearizationKeysLocal())
+
+        XCTAssertEqual(product.size, 2)
+        let decoded = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(product))
+        XCTAssertEqual(decoded[0].doubleValue, pow(0.9, 5), accuracy: 0.001)
+    }
+    
     func testExponentiateInplace() throws {
         XCTAssertNoThrow(try evaluator.exponentiateInplace(encryptedFive, exponent: 2, relinearizationKeys: relinKeys))
     }
@@ -269,6 +377,23 @@ class ASLEvaluatorTests: XCTestCase {
         XCTAssertNoThrow(try evaluator.exponentiate(encryptedFive, exponent: 2, relinearizationKeys: relinKeys))
     }
     
+    func testExponentiateMatchesRepeatedMultiplication() throws {
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let encoder = self.encoder
+        let encrypted = try encryptor.encrypt(with: encoder.encodeInt64Value(3))
+
+        let power = try evaluator.exponentiate(encrypted, exponent: 5, relinearizationKeys: keyGenerator.relinearizationKeysLocal())
+
+        XCTAssertEqual(power.size, 2)
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(power)), 243)
+    }
+    
+    func testExponentiateWithZeroExponentThrows() throws {
+        XCTAssertThrowsError(try evaluator.exponentiate(encryptedFive, exponent: 0, relinearizationKeys: relinKeys))
+    }
+    
     func testAddPlainInplace() throws {
         XCTAssertNoThrow(try evaluator.addPlainInplace(encryptedFive, plain: plainFive))
     }
@@ -449,6 +574,33 @@ class ASLEvaluatorTests: XCTestCase {
         XCTAssertNoThrow(try evaluator.rotateVectorInplace(cipher, steps: 1, galoisKey: key))
     }
     
+    func testRotateVectorBySteps() throws {
+        context = ckksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let values = (0..<ckksEncoder.slotCount).map { NSNumber(value: Double($0 % 16)) }
+        let cipher = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValues: values, scale: pow(2.0, 30)))
+        let key = try keyGenerator.galoisKeysLocal()
+
+        let steps = [1, 2, 3, 5, 7, 0, -1, 3]
+        let rotated = try evaluator.rotateVector(cipher, bySteps: steps.map { NSNumber(value: $0) }, galoisKey: key)
+
+        XCTAssertEqual(rotated.count, steps.count)
+        for (step, encrypted) in zip(steps, rotated) {
+            let decoded = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(encrypted))
+            let expected = Double(((step % 16) + 16) % 16)
+            XCTAssertEqual(decoded[0].doubleValue, expected, accuracy: 0.001)
+        }
+    }
+
+    func testRotateRowsBySteps() throws {
+        context = galoisContext()
+        let key = try keyGen.galoisKeysLocal()
+        XCTAssertEqual(try evaluator.rotateRows(encryptedSeven, bySteps: [1, 2, 3], galoisKey: key).count, 3)
+    }
+
     func testRotateVectorWithPool() throws {
         context = ckksContext()
         let key = try keyGen.galoisKeysLocal(withGaloisElements: [1, 3, 5, 15])
@@ -492,12 +644,591 @@ class ASLEvaluatorTests: XCTestCase {
         let cipher = try encryptor.encrypt(with: encrypted)
         XCTAssertNoThrow(try evaluator.complexConjugate(cipher, galoisKey: key, pool: .global()))
     }
-    
+
+    func testSumSlots() throws {
+        context = batchingContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let batchEncoder = try ASLBatchEncoder(context: context)
+        let evaluator = self.evaluator
+        let galoisKeys = try keyGenerator.galoisKeysLocal(withSteps: evaluator.galoisStepsForSumSlots())
+        let values = (0..<batchEncoder.slotCount).map { _ in NSNumber(value: 1) }
+        let encrypted = try encryptor.encrypt(with: batchEncoder.encode(withUnsignedValues: values))
+
+        let sum = try evaluator.sumSlots(encrypted, galoisKey: galoisKeys)
+
+        let decoded = try batchEncoder.decodeUnsignedValues(with: decryptor.decrypt(sum))
+        XCTAssertEqual(decoded[0].intValue, batchEncoder.slotCount)
+        XCTAssertEqual(decoded[batchEncoder.slotCount - 1].intValue, batchEncoder.slotCount)
+    }
+
+    func testSumSlotsInplaceInRange() throws {
+        context = batchingContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let batchEncoder = try ASLBatchEncoder(context: context)
+        let evaluator = self.evaluator
+        let range = NSRange(location: 3, length: 5)
+        let galoisKeys = try keyGenerator.galoisKeysLocal(withSteps: evaluator.galoisStepsForSumSlots(inRange: range))
+        let values = (0..<batchEncoder.slotCount).map { NSNumber(value: $0 % 8) }
+        let encrypted = try encryptor.encrypt(with: batchEncoder.encode(withUnsignedValues: values))
+
+        let sum = try evaluator.sumSlotsInplace(encrypted, inRange: range, galoisKey: galoisKeys)
+
+        XCTAssertTrue(sum === encrypted)
+        let decoded = try batchEncoder.decodeUnsignedValues(with: decryptor.decrypt(sum))
+        XCTAssertEqual(decoded[3].intValue, 3 + 4 + 5 + 6 + 7)
+    }
+
+    func testSumSlotsInRangeCrossingRowThrows() throws {
+        context = batchingContext()
+        let galoisKeys = try keyGen.galoisKeysLocal()
+        let rowSize = try ASLBatchEncoder(context: context).slotCount / 2
+        let range = NSRange(location: rowSize - 1, length: 2)
+        XCTAssertThrowsError(try evaluator.sumSlots(encryptedSeven, inRange: range, galoisKey: galoisKeys))
+    }
+
+    func testInnerProduct() throws {
+        context = ckksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = self.evaluator
+        let galoisKeys = try keyGenerator.galoisKeysLocal(withSteps: evaluator.galoisStepsForSumSlots())
+        let values = (0..<ckksEncoder.slotCount).map { _ in NSNumber(value: 0.5) }
+        let encrypted = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValues: values, scale: pow(2.0, 30)))
+
+        let product = try evaluator.innerProduct(encrypted,
+                                                 with: encrypted,
+                                                 relinearizationKeys: keyGenerator.relinearizationKeysLocal(),
+                                                 galoisKey: galoisKeys)
+
+        let decoded = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(product))
+        XCTAssertEqual(decoded[0].doubleValue, 0.25 * Double(ckksEncoder.slotCount), accuracy: 0.1)
+    }
+
+    func testMultiplyAccumulate() throws {
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let encoder = self.encoder
+        let encrypteds1 = try (1...9).map { try encryptor.encrypt(with: encoder.encodeInt64Value($0)) }
+        let encrypteds2 = try (1...9).map { _ in try encryptor.encrypt(with: encoder.encodeInt64Value(2)) }
+
+        let sum = try evaluator.multiplyAccumulate(encrypteds1,
+                                                   encrypted2: encrypteds2,
+                                                   relinearizationKeys: keyGenerator.relinearizationKeysLocal())
+
+        XCTAssertEqual(sum.size, 2)
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(sum)), 90)
+    }
+
+    func testMultiplyAccumulateWithMismatchedCountsThrows() throws {
+        XCTAssertThrowsError(try evaluator.multiplyAccumulate([encryptedFive, encryptedSeven],
+                                                              encrypted2: [encryptedFive],
+                                                              relinearizationKeys: relinKeys))
+    }
+
+    func testMultiplyMatrix() throws {
+        context = ckksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = self.evaluator
+        let rows: [[NSNumber]] = [[1, 2, 0, 0],
+                                  [0, 3, 4, 0],
+                                  [0, 0, 5, 6],
+                                  [7, 0, 0, 8]]
+        let matrix = try ASLPlainMatrix(rows: rows,
+                                        ckksEncoder: ckksEncoder,
+                                        parametersId: context.firstParameterIds,
+                                        scale: pow(2.0, 30))
+        let galoisKeys = try keyGenerator.galoisKeysLocal(withSteps: matrix.galoisSteps)
+        let vector: [Double] = [1, 2, 3, 4]
+        let values = (0..<ckksEncoder.slotCount).map { NSNumber(value: vector[$0 % 4]) }
+        let encrypted = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValues: values, scale: pow(2.0, 30)))
+
+        let product = try evaluator.multiplyMatrix(matrix, vector: encrypted, galoisKey: galoisKeys)
+
+        let decoded = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(product))
+        let expected: [Double] = [5, 18, 39, 39]
+        for slot in 0..<8 {
+            XCTAssertEqual(decoded[slot].doubleValue, expected[slot % 4], accuracy: 0.01)
+        }
+    }
+
+    func testMultiplyBatchEncodedMatrix() throws {
+        context = batchingContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let batchEncoder = try ASLBatchEncoder(context: context)
+        let evaluator = self.evaluator
+        let rows: [[NSNumber]] = [[1, -2, 0, 0],
+                                  [0, 3, 4, 0],
+                                  [0, 0, -5, 6],
+                                  [7, 0, 0, 8]]
+        let matrix = try ASLPlainMatrix(rows: rows,
+                                        batchEncoder: batchEncoder,
+                                        evaluator: evaluator,
+                                        parametersId: context.firstParameterIds)
+        let galoisKeys = try keyGenerator.galoisKeysLocal(withSteps: matrix.galoisSteps)
+        let vector: [Int] = [1, 2, 3, -4]
+        let values = (0..<batchEncoder.slotCount).map { NSNumber(value: vector[$0 % 4]) }
+        let encrypted = try encryptor.encrypt(with: batchEncoder.encode(withSignedValues: values))
+
+        let product = try evaluator.multiplyMatrix(matrix, vector: encrypted, galoisKey: galoisKeys)
+
+        let decoded = try batchEncoder.decodeSignedValues(with: try decryptor.decrypt(product))
+        let expected = rows.map { row in
+            zip(row, vector).reduce(0) { $0 + $1.0.intValue * $1.1 }
+        }
+        for slot in 0..<batchEncoder.slotCount {
+            XCTAssertEqual(decoded[slot].intValue, expected[slot % 4])
+        }
+    }
+
+    func testEvaluatePolynomial() throws {
+        context = deepCkksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = self.evaluator
+        let coefficients: [Double] = [0.5, -1, 0.25, 2, 0, -0.75, 0.125, 1]
+        let values = (0..<ckksEncoder.slotCount).map { NSNumber(value: Double($0 % 16) / 8 - 1) }
+        let encrypted = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValues: values, scale: pow(2.0, 40)))
+
+        let result = try evaluator.evaluatePolynomial(encrypted,
+                                                      coefficients: coefficients.map { NSNumber(value: $0) },
+                                                      relinearizationKeys: keyGenerator.relinearizationKeysLocal())
+
+        XCTAssertEqual(result.scale, pow(2.0, 40))
+        let decoded = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(result))
+        for slot in 0..<16 {
+            let x = values[slot].doubleValue
+            let expected = coefficients.reversed().reduce(0) { $0 * x + $1 }
+            XCTAssertEqual(decoded[slot].doubleValue, expected, accuracy: 0.001)
+        }
+    }
+
+    func testEvaluateConstantPolynomialThrows() throws {
+        context = deepCkksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let encrypted = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 1, scale: pow(2.0, 40)))
+        XCTAssertThrowsError(try evaluator.evaluatePolynomial(encrypted,
+                                                              coefficients: [3, 0],
+                                                              relinearizationKeys: keyGenerator.relinearizationKeysLocal()))
+    }
+
+    func testSignAndStep() throws {
+        context = comparisonContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let approximation = try ASLSignApproximation(degree: 5, acceleratedIterations: 1, iterations: 1)
+        let values: [NSNumber] = [0.5, -0.5, 0.75, -0.25]
+        let encrypted = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValues: values, scale: pow(2.0, 40)))
+        let relinKeys = try keyGenerator.relinearizationKeysLocal()
+
+        let sign = try evaluator.sign(encrypted, approximation: approximation, relinearizationKeys: relinKeys)
+        let step = try evaluator.step(encrypted, approximation: approximation, relinearizationKeys: relinKeys)
+
+        let decodedSign = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(sign))
+        let decodedStep = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(step))
+        for (slot, expected) in [1.0, -1.0, 1.0, -1.0].enumerated() {
+            XCTAssertEqual(decodedSign[slot].doubleValue, expected, accuracy: 0.05)
+            XCTAssertEqual(decodedStep[slot].doubleValue, (1 + expected) / 2, accuracy: 0.03)
+        }
+    }
+
+    func testMaxMinAndRelu() throws {
+        context = comparisonContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = self.evaluator
+        let approximation = try ASLSignApproximation(degree: 5, acceleratedIterations: 1, iterations: 1)
+        let a = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValues: [0.5, -0.25], scale: pow(2.0, 40)))
+        let b = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValues: [0.25, 0.25], scale: pow(2.0, 40)))
+        let relinKeys = try keyGenerator.relinearizationKeysLocal()
+
+        let maximum = try evaluator.max(a, with: b, approximation: approximation, relinearizationKeys: relinKeys)
+        let minimum = try evaluator.min(a, with: b, approximation: approximation, relinearizationKeys: relinKeys)
+        let rectified = try evaluator.relu(a, approximation: approximation, relinearizationKeys: relinKeys)
+
+        let decodedMaximum = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(maximum))
+        let decodedMinimum = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(minimum))
+        let decodedRectified = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(rectified))
+        XCTAssertEqual(decodedMaximum[0].doubleValue, 0.5, accuracy: 0.02)
+        XCTAssertEqual(decodedMaximum[1].doubleValue, 0.25, accuracy: 0.02)
+        XCTAssertEqual(decodedMinimum[0].doubleValue, 0.25, accuracy: 0.02)
+        XCTAssertEqual(decodedMinimum[1].doubleValue, -0.25, accuracy: 0.02)
+        XCTAssertEqual(decodedRectified[0].doubleValue, 0.5, accuracy: 0.02)
+        XCTAssertEqual(decodedRectified[1].doubleValue, 0, accuracy: 0.02)
+    }
+
+    func testSignOfBfvThrows() throws {
+        let approximation = try ASLSignApproximation(degree: 3, acceleratedIterations: 0, iterations: 1)
+        XCTAssertThrowsError(try evaluator.sign(encryptedFive, approximation: approximation, relinearizationKeys: relinKeys))
+    }
+
+    func testIsEqual() throws {
+        context = equalityContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let evaluator = self.evaluator
+        let relinKeys = try keyGenerator.relinearizationKeysLocal()
+        let five = try encryptor.encrypt(with: ASLPlainText(polynomialString: "5"))
+        let otherFive = try encryptor.encrypt(with: ASLPlainText(polynomialString: "5"))
+        let seven = try encryptor.encrypt(with: ASLPlainText(polynomialString: "7"))
+
+        let equal = try evaluator.isEqual(five, to: otherFive, relinearizationKeys: relinKeys)
+        let different = try evaluator.isEqual(five, to: seven, relinearizationKeys: relinKeys)
+
+        XCTAssertEqual(try decryptor.decrypt(equal).description, "1")
+        XCTAssertTrue(try decryptor.decrypt(different).isZero)
+    }
+
+    func testIsMember() throws {
+        context = equalityContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let evaluator = self.evaluator
+        evaluator.batchConcurrency = 2
+        let relinKeys = try keyGenerator.relinearizationKeysLocal()
+        let set = try ["3", "5", "9"].map { try encryptor.encrypt(with: ASLPlainText(polynomialString: $0)) }
+        let member = try encryptor.encrypt(with: ASLPlainText(polynomialString: "9"))
+        let nonMember = try encryptor.encrypt(with: ASLPlainText(polynomialString: "4"))
+
+        let found = try evaluator.isMember(member, ofSet: set, relinearizationKeys: relinKeys)
+        let missing = try evaluator.isMember(nonMember, ofSet: set, relinearizationKeys: relinKeys)
+
+        XCTAssertEqual(try decryptor.decrypt(found).description, "1")
+        XCTAssertTrue(try decryptor.decrypt(missing).isZero)
+    }
+
+    func testIsMemberOfSetWithDuplicates() throws {
+        context = equalityContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let evaluator = self.evaluator
+        let relinKeys = try keyGenerator.relinearizationKeysLocal()
+        let set = try ["5", "5", "9"].map { try encryptor.encrypt(with: ASLPlainText(polynomialString: $0)) }
+        let member = try encryptor.encrypt(with: ASLPlainText(polynomialString: "5"))
+
+        let found = try evaluator.isMember(member, ofSet: set, relinearizationKeys: relinKeys)
+
+        XCTAssertEqual(try decryptor.decrypt(found).description, "1")
+    }
+
+    func testIsMemberOfEmptySetThrows() throws {
+        XCTAssertThrowsError(try evaluator.isMember(encryptedFive, ofSet: [], relinearizationKeys: relinKeys))
+    }
+
+    func testScalarOperationsOnBfv() throws {
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let encoder = self.encoder
+        let evaluator = self.evaluator
+        let encrypted = try encryptor.encrypt(with: encoder.encodeInt64Value(5))
+
+        let tripled = try evaluator.multiplyScalar(encrypted, integerValue: 3)
+        let negated = try evaluator.multiplyScalar(encrypted, integerValue: -2)
+        let shifted = try evaluator.addScalarInplace(try evaluator.addScalar(encrypted, integerValue: 4), integerValue: -1)
+
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(tripled)), 15)
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(negated)), -10)
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(shifted)), 8)
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(encrypted)), 5)
+    }
+
+    func testMultiplyScalarByPlainModulusThrows() throws {
+        XCTAssertThrowsError(try evaluator.multiplyScalarInplace(encryptedFive, integerValue: 512))
+    }
+
+    func testScalarOperationsOnCkks() throws {
+        context = ckksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = self.evaluator
+        let encrypted = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValues: [2.0, -0.5], scale: pow(2.0, 30)))
+
+        let scaled = try evaluator.multiplyScalar(encrypted, doubleValue: 1.5, scale: pow(2.0, 30))
+        let doubled = try evaluator.multiplyScalarInplace(try evaluator.addScalar(encrypted, doubleValue: 0.25), doubleValue: -2, scale: 1)
+
+        XCTAssertEqual(scaled.scale, pow(2.0, 60))
+        XCTAssertEqual(doubled.scale, pow(2.0, 30))
+        let decodedScaled = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(scaled))
+        let decodedDoubled = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(doubled))
+        XCTAssertEqual(decodedScaled[0].doubleValue, 3.0, accuracy: 0.001)
+        XCTAssertEqual(decodedScaled[1].doubleValue, -0.75, accuracy: 0.001)
+        XCTAssertEqual(decodedDoubled[0].doubleValue, -4.5, accuracy: 0.001)
+        XCTAssertEqual(decodedDoubled[1].doubleValue, 0.5, accuracy: 0.001)
+    }
+
+    func testMultiplyScalarOfBfvByDoubleThrows() throws {
+        XCTAssertThrowsError(try evaluator.multiplyScalar(encryptedFive, doubleValue: 2, scale: 1))
+    }
+
+    func testAsyncMultiplyMatchesSynchronous() throws {
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let encoder = self.encoder
+        let evaluator = self.evaluator
+        evaluator.evaluationQueue = ASLEvaluationQueue(maximumConcurrentTasks: 2, capacity: 8)
+        let encrypted = try encryptor.encrypt(with: encoder.encodeInt64Value(5))
+        let finished = expectation(description: "multiply finished")
+
+        try evaluator.multiply(encrypted, encrypted2: encrypted, priority: .high) { result, error in
+            XCTAssertNil(error)
+            XCTAssertEqual(try? encoder.decodeInt32(withPlain: decryptor.decrypt(XCTUnwrap(result))), 25)
+            finished.fulfill()
+        }
+
+        wait(for: [finished], timeout: 10)
+    }
+
+    func testAsyncOperationReportsError() throws {
+        let evaluator = self.evaluator
+        let finished = expectation(description: "add finished")
+
+        try evaluator.add(encryptedFive, encrypted2: ASLCipherText(), priority: .normal) { result, error in
+            XCTAssertNil(result)
+            XCTAssertEqual((error as NSError?)?.domain, "ASLSealErrorErrorDomain")
+            finished.fulfill()
+        }
+
+        wait(for: [finished], timeout: 10)
+    }
+
+    func testCancelledAsyncOperationReportsCancellation() throws {
+        let evaluator = self.evaluator
+        let queue = ASLEvaluationQueue(maximumConcurrentTasks: 1, capacity: 8)
+        evaluator.evaluationQueue = queue
+        let started = DispatchSemaphore(value: 0)
+        let release = DispatchSemaphore(value: 0)
+        try queue.submit(with: .high, block: { _ in
+            started.signal()
+            release.wait()
+        }, cancellationHandler: nil)
+        started.wait()
+        var reported: [NSError?] = []
+
+        let task = try evaluator.negate(encryptedFive, priority: .normal) { result, error in
+            XCTAssertNil(result)
+            reported.append(error as NSError?)
+        }
+        XCTAssertTrue(task.cancel())
+        release.signal()
+        queue.waitUntilAllTasksAreFinished()
+
+        XCTAssertEqual(reported.count, 1)
+        XCTAssertEqual(reported.first??.domain, ASLEvaluationQueueErrorDomain)
+        XCTAssertEqual(reported.first??.code, ASLEvaluationQueueErrorCode.cancelled.rawValue)
+    }
+
+    func testAutomaticAlignmentAddsAcrossLevels() throws {
+        context = deepCkksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = self.evaluator
+        let a = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 1.5, scale: pow(2.0, 40)))
+        let b = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 2, scale: pow(2.0, 40)))
+        let product = try evaluator.rescaleToNext(try evaluator.relinearize(try evaluator.multiply(a, encrypted2: a),
+                                                                           relinearizationKeys: keyGenerator.relinearizationKeysLocal()))
+        XCTAssertThrowsError(try evaluator.add(product, encrypted2: b))
+
+        evaluator.automaticAlignmentEnabled = true
+        let sum = try evaluator.add(product, encrypted2: b)
+        let again = try evaluator.add(product, encrypted2: b)
+
+        XCTAssertEqual(sum.parametersId, product.parametersId)
+        XCTAssertEqual(b.parametersId, context.firstParameterIds)
+        for result in [sum, again] {
+            let decoded = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(result))
+            XCTAssertEqual(decoded[0].doubleValue, 4.25, accuracy: 0.001)
+        }
+    }
+
+    func testAutomaticAlignmentCacheIsBounded() throws {
+        context = deepCkksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = self.evaluator
+        evaluator.automaticAlignmentEnabled = true
+        evaluator.alignedOperandCacheCapacity = 1
+        let low = try evaluator.modSwitchToNext(try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 1, scale: pow(2.0, 40))))
+        let operands = try [2.0, 3.0].map { try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: $0, scale: pow(2.0, 40))) }
+
+        let sums = try operands.map { try evaluator.add(low, encrypted2: $0) }
+
+        XCTAssertEqual(evaluator.alignedOperandCacheCount, 1)
+        for (sum, expected) in zip(sums, [3.0, 4.0]) {
+            let decoded = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(sum))
+            XCTAssertEqual(decoded[0].doubleValue, expected, accuracy: 0.001)
+        }
+        evaluator.removeAllAlignedOperands()
+        XCTAssertEqual(evaluator.alignedOperandCacheCount, 0)
+    }
+
+    func testAutomaticAlignmentRescalesLargerScale() throws {
+        context = deepCkksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = self.evaluator
+        evaluator.automaticAlignmentEnabled = true
+        let a = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 1.5, scale: pow(2.0, 40)))
+        let b = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 2, scale: pow(2.0, 40)))
+        let product = try evaluator.relinearize(try evaluator.multiply(a, encrypted2: a),
+                                                relinearizationKeys: keyGenerator.relinearizationKeysLocal())
+
+        let difference = try evaluator.subInplace(b, encrypted2: product)
+
+        XCTAssertTrue(difference === b)
+        let decoded = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(difference))
+        XCTAssertEqual(decoded[0].doubleValue, -0.25, accuracy: 0.001)
+    }
+
+    func testAutomaticAlignmentRejectsUnreachableScale() throws {
+        context = deepCkksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = self.evaluator
+        let relinKeys = try keyGenerator.relinearizationKeysLocal()
+        let a = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 1.5, scale: pow(2.0, 40)))
+        let square = try evaluator.relinearize(try evaluator.multiply(a, encrypted2: a), relinearizationKeys: relinKeys)
+        let cube = try evaluator.relinearize(try evaluator.multiply(square, encrypted2: a), relinearizationKeys: relinKeys)
+        let b = try evaluator.modSwitchToNext(try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 2, scale: pow(2.0, 40))))
+        evaluator.automaticAlignmentEnabled = true
+
+        XCTAssertThrowsError(try evaluator.add(cube, encrypted2: b)) { error in
+            XCTAssertEqual((error as NSError).domain, "ASLSealErrorErrorDomain")
+            XCTAssertEqual((error as NSError).code, 1)
+        }
+    }
+
+    func testAutomaticAlignmentSwitchesPlainText() throws {
+        context = deepCkksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = self.evaluator
+        evaluator.automaticAlignmentEnabled = true
+        let encrypted = try evaluator.modSwitchToNext(try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 3, scale: pow(2.0, 40))))
+        let plain = try ckksEncoder.encode(withDoubleValue: 0.5, scale: pow(2.0, 40))
+
+        let product = try evaluator.multiplyPlain(encrypted, plain: plain)
+
+        XCTAssertEqual(plain.parametersId, context.firstParameterIds)
+        let decoded = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(try evaluator.rescaleToNext(product)))
+        XCTAssertEqual(decoded[0].doubleValue, 1.5, accuracy: 0.001)
+    }
+
+    func testAddBatch() throws {
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let encrypteds1 = try (0..<8).map { try encryptor.encrypt(with: encoder.encodeInt64Value(Int64($0))) }
+        let encrypteds2 = try (0..<8).map { _ in try encryptor.encrypt(with: plainFive) }
+
+        let evaluator = self.evaluator
+        evaluator.batchConcurrency = 3
+        let sums = try evaluator.addBatch(encrypteds1, encrypted2: encrypteds2)
+
+        XCTAssertEqual(sums.count, 8)
+        for (index, sum) in sums.enumerated() {
+            let decrypted = try decryptor.decrypt(sum)
+            XCTAssertEqual(try encoder.decodeInt32(withPlain: decrypted).intValue, index + 5)
+        }
+    }
+
+    func testAddBatchWithMismatchedCounts() throws {
+        XCTAssertThrowsError(try evaluator.addBatch([encryptedFive, encryptedFive], encrypted2: [encryptedFive]))
+    }
+
+    func testMultiplyPlainBatch() throws {
+        let encrypteds = [encryptedFive, encryptedSeven, encryptedFive]
+        XCTAssertEqual(try evaluator.multiplyPlainBatch(encrypteds, plains: [plainFive]).count, 3)
+        XCTAssertEqual(try evaluator.multiplyPlainBatch(encrypteds, plains: [plainFive, plainFive, plainFive]).count, 3)
+        XCTAssertThrowsError(try evaluator.multiplyPlainBatch(encrypteds, plains: [plainFive, plainFive]))
+    }
+
+    func testRotateBatch() throws {
+        context = galoisContext()
+        let key = try keyGen.galoisKeysLocal()
+        XCTAssertEqual(try evaluator.rotateBatch([encryptedSeven, encryptedFive], steps: 1, galoisKey: key).count, 2)
+    }
+
+    func testRelinearizeBatch() throws {
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let relinKeys = try keyGenerator.relinearizationKeysLocal()
+        let squares = try [encryptedFive, encryptedSeven].map { try evaluator.square($0) }
+        let relinearized = try evaluator.relinearizeBatch(squares, relinearizationKeys: relinKeys)
+        XCTAssertEqual(relinearized.map { $0.size }, [2, 2])
+    }
+
     private func decode(_ cipher: ASLCipherText) -> NSNumber {
         let decrypted = try! decryptor.decrypt(cipher)
         return try! encoder.decodeInt32(withPlain: decrypted)
     }
     
+    /// Ciphertexts from one key generator, with the products they should decrypt to
+    private typealias FusedFixture = (decryptor: ASLDecryptor, encoder: ASLCKKSEncoder, relinKeys: ASLRelinearizationKeys,
+                                      encrypted1: ASLCipherText, encrypted2: ASLCipherText, plain2: ASLPlainText,
+                                      expected: [Double])
+    
+    private func fusedFixture() throws -> FusedFixture {
+        context = ckksContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let values1 = (0..<ckksEncoder.slotCount).map { Double($0 % 8) / 4 - 1 }
+        let values2 = (0..<ckksEncoder.slotCount).map { Double($0 % 5) / 2 + 0.5 }
+        let plain1 = try ckksEncoder.encode(withDoubleValues: values1.map { NSNumber(value: $0) }, scale: pow(2.0, 30))
+        let plain2 = try ckksEncoder.encode(withDoubleValues: values2.map { NSNumber(value: $0) }, scale: pow(2.0, 30))
+        return (decryptor, ckksEncoder, try keyGenerator.relinearizationKeysLocal(),
+                try encryptor.encrypt(with: plain1), try encryptor.encrypt(with: plain2), plain2,
+                zip(values1, values2).map { $0 * $1 })
+    }
+    
+    private func assertFused(_ fused: ASLCipherText, matches unfused: ASLCipherText,
+                             fixture: FusedFixture,
+                             file: StaticString = #file, line: UInt = #line) throws {
+        XCTAssertEqual(fused.scale, unfused.scale, file: file, line: line)
+        XCTAssertEqual(fused.size, unfused.size, file: file, line: line)
+        let decodedFused = try fixture.encoder.decodeDoubleValues(try fixture.decryptor.decrypt(fused))
+        let decodedUnfused = try fixture.encoder.decodeDoubleValues(try fixture.decryptor.decrypt(unfused))
+        for slot in 0..<40 {
+            XCTAssertEqual(decodedFused[slot].doubleValue, decodedUnfused[slot].doubleValue, accuracy: 0.01, file: file, line: line)
+            XCTAssertEqual(decodedFused[slot].doubleValue, fixture.expected[slot], accuracy: 0.01, file: file, line: line)
+        }
+    }
+    
     private func galoisContext() -> ASLSealContext {
         let params = ASLEncryptionParameters(schemeType: .BFV)
         let plainModulus = try! ASLModulus(value: 257)
@@ -525,6 +1256,31 @@ class ASLEvaluatorTests: XCTestCase {
         return try! ASLSealContext(parms)
     }
     
+    private func deepCkksContext() -> ASLSealContext {
+        let parms = ASLEncryptionParameters(schemeType: .CKKS)
+        let polyModulusDegree = 16384
+        try! parms.setPolynomialModulusDegree(polyModulusDegree)
+        try! parms.setCoefficientModulus(ASLCoefficientModulus.create(polyModulusDegree, bitSizes: [60, 40, 40, 40, 40, 60]))
+        return try! ASLSealContext(parms)
+    }
+    
+    private func comparisonContext() -> ASLSealContext {
+        let parms = ASLEncryptionParameters(schemeType: .CKKS)
+        let polyModulusDegree = 16384
+        try! parms.setPolynomialModulusDegree(polyModulusDegree)
+        try! parms.setCoefficientModulus(ASLCoefficientModulus.create(polyModulusDegree, bitSizes: [60, 40, 40, 40, 40, 40, 40, 40, 60]))
+        return try! ASLSealContext(parms)
+    }
+    
+    private func equalityContext() -> ASLSealContext {
+        let parms = ASLEncryptionParameters(schemeType: .BFV)
+        let polyModulusDegree = 8192
+        try! parms.setPolynomialModulusDegree(polyModulusDegree)
+        try! parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        try! parms.setPlainModulus(ASLModulus(value: 17))
+        return try! ASLSealContext(parms)
+    }
+    
     private func ckksContext() -> ASLSealContext {
         let parms = ASLEncryptionParameters(schemeType: .CKKS)
         let polyModulusDegree = 4096
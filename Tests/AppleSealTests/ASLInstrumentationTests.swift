@@ -0,0 +1,156 @@
+//
+//  ASLInstrumentationTests.swift
+//  AppleSealTests
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+import AppleSeal
+import XCTest
+
+class ASLInstrumentationTests: XCTestCase {
+
+    private var context: ASLSealContext! = nil
+    private var encryptor: ASLEncryptor! = nil
+    private var decryptor: ASLDecryptor! = nil
+    private var evaluator: ASLEvaluator! = nil
+    private var instrumentation: ASLInstrumentation! = nil
+
+    override func setUp() {
+        super.setUp()
+        let parms = ASLEncryptionParameters(schemeType: .BFV)
+        let polyModulusDegree = 4096
+        try! parms.setPolynomialModulusDegree(polyModulusDegree)
+        try! parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        try! parms.setPlainModulus(ASLModulus(value: 1024))
+        context = try! ASLSealContext(parms)
+
+        let keyGenerator = try! ASLKeyGenerator(context: context)
+        encryptor = try! ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        decryptor = try! ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        evaluator = try! ASLEvaluator(context)
+
+        instrumentation = ASLInstrumentation(context: context)
+        encryptor.instrumentation = instrumentation
+        decryptor.instrumentation = instrumentation
+        evaluator.instrumentation = instrumentation
+    }
+
+    override func tearDown() {
+        super.tearDown()
+        instrumentation = nil
+        evaluator = nil
+        decryptor = nil
+        encryptor = nil
+        context = nil
+    }
+
+    // MARK: - Tests
+
+    func testRecordsCallsAndFailures() throws {
+        let encrypted = try encryptor.encrypt(with: ASLPlainText(polynomialString: "3"))
+        _ = try evaluator.add(encrypted, encrypted2: encrypted)
+        _ = try evaluator.add(encrypted, encrypted2: encrypted)
+        let product = try evaluator.multiply(encrypted, encrypted2: encrypted)
+        XCTAssertThrowsError(try evaluator.multiply(encrypted, encrypted2: ASLCipherText()))
+
+        let add = try XCTUnwrap(statistics("add:encrypted2:error:"))
+        XCTAssertEqual(add.componentName, "ASLEvaluator")
+        XCTAssertEqual(add.callCount, 2)
+        XCTAssertEqual(add.failureCount, 0)
+        XCTAssertEqual(add.averageInputSize, 2)
+        XCTAssertEqual(add.averageOutputSize, 2)
+        XCTAssertEqual(add.latencyHistogram.reduce(0) { $0 + $1.uint64Value }, 2)
+        XCTAssertGreaterThanOrEqual(add.totalNanoseconds, add.maximumNanoseconds)
+
+        let multiply = try XCTUnwrap(statistics("multiply:encrypted2:error:"))
+        XCTAssertEqual(multiply.callCount, 2)
+        XCTAssertEqual(multiply.failureCount, 1)
+        XCTAssertEqual(multiply.averageOutputSize, Double(product.size))
+    }
+
+    func testRecordsLevels() throws {
+        let encrypted = try encryptor.encrypt(with: ASLPlainText(polynomialString: "3"))
+        let switched = try evaluator.modSwitchToNext(encrypted)
+        _ = try evaluator.negate(switched)
+
+        let firstLevel = context.firstContextData.chainIndex
+        let modSwitch = try XCTUnwrap(statistics("modSwitchToNext:error:"))
+        XCTAssertEqual(modSwitch.level, firstLevel)
+        XCTAssertEqual(modSwitch.outputLevelCounts, [NSNumber(value: firstLevel - 1): 1])
+
+        let negate = try XCTUnwrap(statistics("negate:error:"))
+        XCTAssertEqual(negate.level, firstLevel - 1)
+
+        let encrypt = try XCTUnwrap(statistics("encryptWithPlainText:error:"))
+        XCTAssertEqual(encrypt.componentName, "ASLEncryptor")
+        XCTAssertEqual(encrypt.level, -1)
+        XCTAssertEqual(encrypt.outputLevelCounts, [NSNumber(value: firstLevel): 1])
+    }
+
+    func testRecordsDecryption() throws {
+        let encrypted = try encryptor.encrypt(with: ASLPlainText(polynomialString: "3"))
+        _ = try decryptor.decrypt(encrypted)
+        _ = try decryptor.invariantNoiseBudget(encrypted)
+
+        let decrypt = try XCTUnwrap(statistics("decrypt:error:"))
+        XCTAssertEqual(decrypt.componentName, "ASLDecryptor")
+        XCTAssertEqual(decrypt.callCount, 1)
+        XCTAssertEqual(decrypt.averageInputSize, 2)
+
+        let budget = try XCTUnwrap(statistics("invariantNoiseBudget:error:"))
+        XCTAssertEqual(budget.failureCount, 0)
+        XCTAssertEqual(budget.outputLevelCounts, [NSNumber(value: -1): 1])
+    }
+
+    func testRecordsEvaluationGraphRuns() throws {
+        let encrypted = try encryptor.encrypt(with: ASLPlainText(polynomialString: "3"))
+        let graph = ASLEvaluationGraph(evaluator: evaluator)
+        let x = graph.input(encrypted)
+        _ = try graph.evaluate(graph.add(graph.negate(x), encrypted2: x))
+
+        let run = try XCTUnwrap(statistics("evaluateOutputs:error:"))
+        XCTAssertEqual(run.componentName, "ASLEvaluationGraph")
+        XCTAssertEqual(run.callCount, 1)
+        XCTAssertEqual(run.failureCount, 0)
+        XCTAssertNil(statistics("add:encrypted2:error:"))
+    }
+
+    func testResetClearsCounters() throws {
+        let encrypted = try encryptor.encrypt(with: ASLPlainText(polynomialString: "3"))
+        _ = try evaluator.add(encrypted, encrypted2: encrypted)
+
+        instrumentation.reset()
+
+        XCTAssertTrue(instrumentation.snapshot().isEmpty)
+        _ = try evaluator.add(encrypted, encrypted2: encrypted)
+        XCTAssertEqual(statistics("add:encrypted2:error:")?.callCount, 1)
+    }
+
+    func testDisabledRecordsNothing() throws {
+        instrumentation.isEnabled = false
+        let encrypted = try encryptor.encrypt(with: ASLPlainText(polynomialString: "3"))
+        _ = try evaluator.add(encrypted, encrypted2: encrypted)
+
+        XCTAssertTrue(instrumentation.snapshot().isEmpty)
+    }
+
+    func testReports() throws {
+        let encrypted = try encryptor.encrypt(with: ASLPlainText(polynomialString: "3"))
+        _ = try evaluator.add(encrypted, encrypted2: encrypted)
+
+        XCTAssertTrue(instrumentation.textReport().contains("add:encrypted2:error:"))
+
+        let report = try JSONSerialization.jsonObject(with: instrumentation.jsonReport()) as? [[String: Any]]
+        XCTAssertEqual(report?.count, 2)
+        XCTAssertEqual(Set(report?.compactMap { $0["operation"] as? String } ?? []),
+                       ["encryptWithPlainText:error:", "add:encrypted2:error:"])
+    }
+
+    // MARK: - Helpers
+
+    private func statistics(_ operation: String) -> ASLOperationStatistics? {
+        return instrumentation.snapshot().first { $0.operation == operation }
+    }
+}
@@ -0,0 +1,78 @@
+//
+//  ASLPlainMatrixTests.swift
+//  AppleSealTests
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+import AppleSeal
+import XCTest
+
+class ASLPlainMatrixTests: XCTestCase {
+
+    var context: ASLSealContext!
+
+    override func setUp() {
+        super.setUp()
+        let parms = ASLEncryptionParameters(schemeType: .CKKS)
+        let polyModulusDegree = 4096
+        try! parms.setPolynomialModulusDegree(polyModulusDegree)
+        try! parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        context = try! ASLSealContext(parms)
+    }
+
+    override func tearDown() {
+        super.tearDown()
+        context = nil
+    }
+
+    func testProperties() throws {
+        let rows: [[NSNumber]] = [[1, 2, 0, 0],
+                                  [0, 3, 4, 0],
+                                  [0, 0, 5, 6],
+                                  [7, 0, 0, 8]]
+        let matrix = try ASLPlainMatrix(rows: rows,
+                                        ckksEncoder: ASLCKKSEncoder(context: context),
+                                        parametersId: context.firstParameterIds,
+                                        scale: pow(2.0, 30))
+        XCTAssertEqual(matrix.dimension, 4)
+        XCTAssertEqual(matrix.babyStepCount, 2)
+        XCTAssertEqual(matrix.giantStepCount, 2)
+        XCTAssertEqual(matrix.diagonalCount, 3)
+        XCTAssertEqual(matrix.galoisSteps, [1, 2])
+    }
+
+    func testRaggedRowsThrows() throws {
+        let rows: [[NSNumber]] = [[1, 2], [3]]
+        XCTAssertThrowsError(try ASLPlainMatrix(rows: rows,
+                                                ckksEncoder: ASLCKKSEncoder(context: context),
+                                                parametersId: context.firstParameterIds,
+                                                scale: pow(2.0, 30)))
+    }
+
+    func testDimensionNotDividingSlotsThrows() throws {
+        let rows: [[NSNumber]] = [[1, 2, 3], [4, 5, 6], [7, 8, 9]]
+        XCTAssertThrowsError(try ASLPlainMatrix(rows: rows,
+                                                ckksEncoder: ASLCKKSEncoder(context: context),
+                                                parametersId: context.firstParameterIds,
+                                                scale: pow(2.0, 30)))
+    }
+
+    func testBatchEncodedMatrix() throws {
+        let parms = ASLEncryptionParameters(schemeType: .BFV)
+        let polyModulusDegree = 8192
+        try parms.setPolynomialModulusDegree(polyModulusDegree)
+        try parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        try parms.setPlainModulus(ASLPlainModulus.batching(polyModulusDegree, bitSize: 20))
+        context = try ASLSealContext(parms)
+
+        let rows: [[NSNumber]] = [[1, 0], [0, 1]]
+        let matrix = try ASLPlainMatrix(rows: rows,
+                                        batchEncoder: ASLBatchEncoder(context: context),
+                                        evaluator: ASLEvaluator(context),
+                                        parametersId: context.firstParameterIds)
+        XCTAssertEqual(matrix.dimension, 2)
+        XCTAssertEqual(matrix.diagonalCount, 1)
+    }
+}
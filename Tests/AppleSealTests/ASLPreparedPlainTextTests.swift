@@ -0,0 +1,110 @@
+//
+//  ASLPreparedPlainTextTests.swift
+//  AppleSealTests
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+import AppleSeal
+import XCTest
+
+class ASLPreparedPlainTextTests: XCTestCase {
+
+    func testBfvMultiplyAndAdd() throws {
+        let context = try bfvContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let encoder = try ASLIntegerEncoder(context: context)
+        let evaluator = try ASLEvaluator(context)
+        let prepared = try ASLPreparedPlainText(plainText: encoder.encodeInt64Value(3), evaluator: evaluator)
+        let encrypted = try encryptor.encrypt(with: encoder.encodeInt64Value(5))
+
+        let product = try evaluator.multiplyPlain(encrypted, prepared: prepared)
+        let sum = try evaluator.addPlain(encrypted, prepared: prepared)
+
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(product)), 15)
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(sum)), 8)
+        XCTAssertEqual(prepared.preparedLevelCount, 1)
+    }
+
+    func testBfvPreparesEachLevelOnce() throws {
+        let context = try bfvContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let encoder = try ASLIntegerEncoder(context: context)
+        let evaluator = try ASLEvaluator(context)
+        let prepared = try ASLPreparedPlainText(plainText: encoder.encodeInt64Value(2), evaluator: evaluator)
+        let encrypted = try evaluator.modSwitchToNext(try encryptor.encrypt(with: encoder.encodeInt64Value(7)))
+
+        for _ in 0..<3 {
+            try evaluator.multiplyPlainInplace(encrypted, prepared: prepared)
+        }
+
+        XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(encrypted)), 56)
+        XCTAssertEqual(prepared.preparedLevelCount, 2)
+    }
+
+    func testCkksSwitchesToLowerLevel() throws {
+        let parms = ASLEncryptionParameters(schemeType: .CKKS)
+        try parms.setPolynomialModulusDegree(8192)
+        try parms.setCoefficientModulus(ASLCoefficientModulus.create(8192, bitSizes: [60, 40, 40, 60]))
+        let context = try ASLSealContext(parms)
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = try ASLEvaluator(context)
+        let prepared = try ASLPreparedPlainText(plainText: ckksEncoder.encode(withDoubleValue: 0.5, scale: pow(2.0, 40)),
+                                                evaluator: evaluator)
+        let encrypted = try evaluator.modSwitchToNext(try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValue: 3, scale: pow(2.0, 40))))
+
+        let sum = try evaluator.addPlain(encrypted, prepared: prepared)
+        let product = try evaluator.multiplyPlain(encrypted, prepared: prepared)
+
+        XCTAssertEqual(try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(sum))[0].doubleValue, 3.5, accuracy: 0.001)
+        XCTAssertEqual(try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(product))[0].doubleValue, 1.5, accuracy: 0.001)
+        XCTAssertEqual(prepared.preparedLevelCount, 2)
+    }
+
+    func testConcurrentUse() throws {
+        let context = try bfvContext()
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let encoder = try ASLIntegerEncoder(context: context)
+        let evaluator = try ASLEvaluator(context)
+        let prepared = try ASLPreparedPlainText(plainText: encoder.encodeInt64Value(4), evaluator: evaluator)
+        let encrypteds = try (0..<8).map { try encryptor.encrypt(with: encoder.encodeInt64Value(Int64($0))) }
+        let products = try encrypteds.map { try evaluator.modSwitchToNext($0) }
+
+        DispatchQueue.concurrentPerform(iterations: products.count) { index in
+            try! evaluator.multiplyPlainInplace(products[index], prepared: prepared)
+        }
+
+        for (index, product) in products.enumerated() {
+            XCTAssertEqual(try encoder.decodeInt32(withPlain: decryptor.decrypt(product)).intValue, 4 * index)
+        }
+        XCTAssertEqual(prepared.preparedLevelCount, 2)
+    }
+
+    func testBfvNttPlainTextThrows() throws {
+        let context = try bfvContext()
+        let encoder = try ASLIntegerEncoder(context: context)
+        let evaluator = try ASLEvaluator(context)
+        let plain = encoder.encodeInt64Value(3)
+        _ = try evaluator.transform(toNttInplace: plain, parametersId: context.firstParameterIds)
+        XCTAssertThrowsError(try ASLPreparedPlainText(plainText: plain, evaluator: evaluator))
+    }
+
+    private func bfvContext() throws -> ASLSealContext {
+        let parms = ASLEncryptionParameters(schemeType: .BFV)
+        let polyModulusDegree = 4096
+        try parms.setPolynomialModulusDegree(polyModulusDegree)
+        try parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        try parms.setPlainModulus(ASLModulus(value: 512))
+        return try ASLSealContext(parms)
+    }
+}
@@ -0,0 +1,91 @@
+//
+//  ASLProductAccumulatorTests.swift
+//  AppleSealTests
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+import AppleSeal
+import XCTest
+
+class ASLProductAccumulatorTests: XCTestCase {
+
+    var context: ASLSealContext!
+    var keyGenerator: ASLKeyGenerator!
+    var encryptor: ASLEncryptor!
+    var decryptor: ASLDecryptor!
+    var encoder: ASLIntegerEncoder!
+    var evaluator: ASLEvaluator!
+
+    override func setUp() {
+        super.setUp()
+        let parms = ASLEncryptionParameters(schemeType: .BFV)
+        let polyModulusDegree = 4096
+        try! parms.setPolynomialModulusDegree(polyModulusDegree)
+        try! parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        try! parms.setPlainModulus(ASLModulus(value: 512))
+        context = try! ASLSealContext(parms)
+        keyGenerator = try! ASLKeyGenerator(context: context)
+        encryptor = try! ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        decryptor = try! ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        encoder = try! ASLIntegerEncoder(context: context)
+        evaluator = try! ASLEvaluator(context)
+    }
+
+    override func tearDown() {
+        super.tearDown()
+        context = nil
+        keyGenerator = nil
+        encryptor = nil
+        decryptor = nil
+        encoder = nil
+        evaluator = nil
+    }
+
+    func testDotProduct() throws {
+        let accumulator = ASLProductAccumulator(evaluator: evaluator)
+        for (a, b) in [(2, 3), (4, 5), (6, 7)] {
+            try accumulator.multiply(try encrypt(Int64(a)), encrypted2: try encrypt(Int64(b)))
+        }
+        XCTAssertEqual(accumulator.termCount, 3)
+
+        let sum = try accumulator.relinearizedSum(withRelinearizationKeys: keyGenerator.relinearizationKeysLocal())
+        XCTAssertEqual(sum.size, 2)
+        XCTAssertEqual(try decrypt(sum), 2 * 3 + 4 * 5 + 6 * 7)
+        XCTAssertEqual(accumulator.termCount, 0)
+    }
+
+    func testAddMixesProductsAndCipherTexts() throws {
+        let accumulator = ASLProductAccumulator(evaluator: evaluator)
+        try accumulator.add(try encrypt(10))
+        try accumulator.multiply(try encrypt(3), encrypted2: try encrypt(3))
+
+        let sum = try accumulator.relinearizedSum(withRelinearizationKeys: keyGenerator.relinearizationKeysLocal())
+        XCTAssertEqual(try decrypt(sum), 19)
+    }
+
+    func testReset() throws {
+        let accumulator = ASLProductAccumulator(evaluator: evaluator)
+        try accumulator.multiply(try encrypt(3), encrypted2: try encrypt(3))
+        accumulator.reset()
+        try accumulator.multiply(try encrypt(2), encrypted2: try encrypt(4))
+
+        let sum = try accumulator.relinearizedSum(withRelinearizationKeys: keyGenerator.relinearizationKeysLocal())
+        XCTAssertEqual(try decrypt(sum), 8)
+    }
+
+    func testEmptySumThrows() throws {
+        let accumulator = ASLProductAccumulator(evaluator: evaluator)
+        XCTAssertThrowsError(try accumulator.relinearizedSum(withRelinearizationKeys: keyGenerator.relinearizationKeysLocal()))
+    }
+
+    private func encrypt(_ value: Int64) throws -> ASLCipherText {
+        try encryptor.encrypt(with: encoder.encodeInt64Value(value))
+    }
+
+    private func decrypt(_ encrypted: ASLCipherText) throws -> Int32 {
+        let decrypted = try decryptor.decrypt(encrypted)
+        return try encoder.decodeInt32(withPlain: decrypted).int32Value
+    }
+}
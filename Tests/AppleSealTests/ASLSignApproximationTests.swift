@@ -0,0 +1,71 @@
+//
+//  ASLSignApproximationTests.swift
+//  AppleSealTests
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+import AppleSeal
+import XCTest
+
+class ASLSignApproximationTests: XCTestCase {
+
+    func testProperties() throws {
+        let approximation = try ASLSignApproximation(degree: 5, acceleratedIterations: 2, iterations: 3)
+        XCTAssertEqual(approximation.degree, 5)
+        XCTAssertEqual(approximation.acceleratedIterations, 2)
+        XCTAssertEqual(approximation.iterations, 3)
+        XCTAssertEqual(approximation.depth, 15)
+        XCTAssertEqual(approximation.multiplicationCount, 20)
+    }
+
+    func testInvalidDegreeThrows() throws {
+        XCTAssertThrowsError(try ASLSignApproximation(degree: 4, acceleratedIterations: 0, iterations: 1))
+    }
+
+    func testNoIterationsThrows() throws {
+        XCTAssertThrowsError(try ASLSignApproximation(degree: 3, acceleratedIterations: 0, iterations: 0))
+    }
+
+    func testErrorShrinksWithIterations() throws {
+        let coarse = try ASLSignApproximation(degree: 3, acceleratedIterations: 0, iterations: 2)
+        let fine = try ASLSignApproximation(degree: 3, acceleratedIterations: 0, iterations: 4)
+        XCTAssertLessThan(fine.maximumError(forInputGap: 0.25), coarse.maximumError(forInputGap: 0.25))
+    }
+
+    func testMaximumErrorBoundsEveryInput() throws {
+        let approximation = try ASLSignApproximation(degree: 3, acceleratedIterations: 0, iterations: 3)
+        let gap = 0.125
+        let bound = approximation.maximumError(forInputGap: gap)
+
+        // f_1(x) = (3x - x^3) / 2, evaluated directly at many more inputs than the bound sees
+        var largestError = 0.0
+        for step in 0...100_000 {
+            var value = gap + (1 - gap) * Double(step) / 100_000
+            for _ in 0..<3 {
+                value = (3 * value - value * value * value) / 2
+            }
+            largestError = max(largestError, abs(1 - value))
+        }
+        XCTAssertGreaterThanOrEqual(bound, largestError)
+        XCTAssertLessThanOrEqual(bound, largestError * (1 + 1.0 / 32))
+    }
+
+    func testCheapestApproximation() throws {
+        let approximation = try XCTUnwrap(ASLSignApproximation.cheapestApproximation(forInputGap: pow(2.0, -4), maximumError: pow(2.0, -8)))
+        XCTAssertEqual(approximation.degree, 5)
+        XCTAssertEqual(approximation.acceleratedIterations, 2)
+        XCTAssertEqual(approximation.iterations, 2)
+        XCTAssertLessThanOrEqual(approximation.maximumError(forInputGap: pow(2.0, -4)), pow(2.0, -8))
+    }
+
+    func testApproximationTableImprovesWithDepth() throws {
+        let table = ASLSignApproximation.approximations(forInputGap: pow(2.0, -4), maximumDepth: 16)
+        XCTAssertFalse(table.isEmpty)
+        for (shallower, deeper) in zip(table, table.dropFirst()) {
+            XCTAssertLessThan(shallower.depth, deeper.depth)
+            XCTAssertLessThan(deeper.maximumError(forInputGap: pow(2.0, -4)), shallower.maximumError(forInputGap: pow(2.0, -4)))
+        }
+    }
+}
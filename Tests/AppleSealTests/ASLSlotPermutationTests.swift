@@ -0,0 +1,118 @@
+//
+//  ASLSlotPermutationTests.swift
+//  AppleSealTests
+//
+//  Created by agent on 2026-10-17.
+//  Copyright © 2026 agent. All rights reserved.
+//
+
+import AppleSeal
+import XCTest
+
+class ASLSlotPermutationTests: XCTestCase {
+
+    var context: ASLSealContext!
+
+    override func setUp() {
+        super.setUp()
+        let parms = ASLEncryptionParameters(schemeType: .CKKS)
+        let polyModulusDegree = 4096
+        try! parms.setPolynomialModulusDegree(polyModulusDegree)
+        try! parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        context = try! ASLSealContext(parms)
+    }
+
+    override func tearDown() {
+        super.tearDown()
+        context = nil
+    }
+
+    func testAdjacentSwapProperties() throws {
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let indices = (0..<ckksEncoder.slotCount).map { NSNumber(value: $0 ^ 1) }
+        let permutation = try ASLSlotPermutation(indices: indices,
+                                                 ckksEncoder: ckksEncoder,
+                                                 parametersId: context.firstParameterIds,
+                                                 scale: pow(2.0, 30))
+        XCTAssertEqual(permutation.slotCount, ckksEncoder.slotCount)
+        XCTAssertEqual(permutation.maskCount, 2)
+        XCTAssertEqual(permutation.rotationCount, 2)
+        XCTAssertEqual(permutation.galoisSteps.count, 2)
+    }
+
+    func testBlockTranspose() throws {
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let evaluator = try ASLEvaluator(context)
+        // Transposes every consecutive 8-by-8 block of slots.
+        let indices = (0..<ckksEncoder.slotCount).map { slot -> NSNumber in
+            let block = slot / 64, row = slot % 64 / 8, column = slot % 8
+            return NSNumber(value: block * 64 + column * 8 + row)
+        }
+        let permutation = try ASLSlotPermutation(indices: indices,
+                                                 ckksEncoder: ckksEncoder,
+                                                 parametersId: context.firstParameterIds,
+                                                 scale: pow(2.0, 30))
+        XCTAssertEqual(permutation.maskCount, 15)
+        XCTAssertLessThan(permutation.rotationCount, permutation.maskCount)
+        let galoisKeys = try keyGenerator.galoisKeysLocal(withSteps: permutation.galoisSteps)
+        let values = (0..<ckksEncoder.slotCount).map { NSNumber(value: Double($0 % 64)) }
+        let encrypted = try encryptor.encrypt(with: ckksEncoder.encode(withDoubleValues: values, scale: pow(2.0, 30)))
+
+        let permuted = try evaluator.permuteSlots(encrypted, permutation: permutation, galoisKey: galoisKeys)
+
+        let decoded = try ckksEncoder.decodeDoubleValues(try decryptor.decrypt(permuted))
+        for slot in 0..<128 {
+            XCTAssertEqual(decoded[slot].doubleValue, Double(indices[slot].intValue % 64), accuracy: 0.01)
+        }
+    }
+
+    func testBatchEncodedPermutationAcrossRows() throws {
+        let parms = ASLEncryptionParameters(schemeType: .BFV)
+        let polyModulusDegree = 8192
+        try parms.setPolynomialModulusDegree(polyModulusDegree)
+        try parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        try parms.setPlainModulus(ASLPlainModulus.batching(polyModulusDegree, bitSize: 20))
+        context = try ASLSealContext(parms)
+        let keyGenerator = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keyGenerator.publicKey)
+        let decryptor = try ASLDecryptor(context: context, secretKey: keyGenerator.secretKey)
+        let batchEncoder = try ASLBatchEncoder(context: context)
+        let evaluator = try ASLEvaluator(context)
+        let slotCount = batchEncoder.slotCount
+        let indices = (0..<slotCount).map { NSNumber(value: ($0 + slotCount / 2 + 1) % slotCount) }
+        let permutation = try ASLSlotPermutation(indices: indices,
+                                                 batchEncoder: batchEncoder,
+                                                 evaluator: evaluator,
+                                                 parametersId: context.firstParameterIds)
+        XCTAssertTrue(permutation.galoisSteps.contains(0))
+        let galoisKeys = try keyGenerator.galoisKeysLocal(withSteps: permutation.galoisSteps)
+        let values = (0..<slotCount).map { NSNumber(value: $0 % 1000) }
+        let encrypted = try encryptor.encrypt(with: batchEncoder.encode(withSignedValues: values))
+
+        let permuted = try evaluator.permuteSlots(encrypted, permutation: permutation, galoisKey: galoisKeys)
+
+        let decoded = try batchEncoder.decodeSignedValues(with: decryptor.decrypt(permuted))
+        for slot in 0..<slotCount {
+            XCTAssertEqual(decoded[slot], values[indices[slot].intValue])
+        }
+    }
+
+    func testIndexOutOfRangeThrows() throws {
+        let ckksEncoder = try ASLCKKSEncoder(context: context)
+        let indices = (0..<ckksEncoder.slotCount).map { NSNumber(value: $0 + 1) }
+        XCTAssertThrowsError(try ASLSlotPermutation(indices: indices,
+                                                    ckksEncoder: ckksEncoder,
+                                                    parametersId: context.firstParameterIds,
+                                                    scale: pow(2.0, 30)))
+    }
+
+    func testWrongIndexCountThrows() throws {
+        XCTAssertThrowsError(try ASLSlotPermutation(indices: [1, 0],
+                                                    ckksEncoder: ASLCKKSEncoder(context: context),
+                                                    parametersId: context.firstParameterIds,
+                                                    scale: pow(2.0, 30)))
+    }
+}
@@ -292,7 +292,7 @@ class BFVBasics: XCTestCase {
         print()
         print("Compute encryptedResult (4(x^2+1)(x+1)^2).")
         let plainFour = try ASLPlainText(polynomialString: "4")
-        xPlusOneSq = try evaluator.multiplyPlainInplace(xSqPlusOne, plain: plainFour)
+        xPlusOneSq = try evaluator.multiplyPlainInplace(xPlusOneSq, plain: plainFour)
         var encryptedResult = try evaluator.multiply(xSqPlusOne, encrypted2: xPlusOneSq)
         print("    + size of encrypted_result: {\(encryptedResult.size)}")
         print("    + noise budget in encrypted_result: {\(try decryptor.invariantNoiseBudget(encryptedResult)))} bits")
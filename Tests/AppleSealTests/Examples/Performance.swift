@@ -64,6 +64,384 @@ class Performance: XCTestCase {
 //        try ckksTest(context)
     }
     
+    func testInplacePerformance4096() throws {
+        let context = try bfvContext(4096)
+        let (evaluator, encrypted) = try inplaceFixture(context)
+        
+        /*
+         In-place operations write straight into the ciphertext they are given,
+         so every iteration below saves a full copy of the ciphertext data plus
+         a new ASLCipherText wrapper compared to the out-of-place variant.
+         */
+        let operations = 100
+        printSavedBytes(encrypted, operations: operations)
+        
+        measure {
+            for _ in 0..<operations {
+                _ = try! evaluator.negateInplace(encrypted)
+            }
+        }
+    }
+    
+    func testOutOfPlacePerformance4096() throws {
+        let context = try bfvContext(4096)
+        let (evaluator, encrypted) = try inplaceFixture(context)
+        
+        let operations = 100
+        var result = encrypted
+        measure {
+            for _ in 0..<operations {
+                result = try! evaluator.negate(result)
+            }
+        }
+    }
+    
+    func testRotationPerformance4096() throws {
+        let context = try bfvContext(4096)
+        let (evaluator, encrypted, galoisKeys) = try rotationFixture(context)
+        
+        /*
+         Rotations reach the Galois keys by reference, so neither latency nor
+         peak memory should grow with the number of rotations performed. Every
+         Galois key holds at least one ciphertext's worth of data, so a single
+         copy of the keys would raise the peak by more than the bound below.
+         */
+        let rotations = 20
+        let keyBytesLowerBound = galoisKeys.size * encrypted.size * encrypted.polynomialModulusDegree * encrypted.coefficientModulusSize * MemoryLayout<UInt64>.size
+        let peakBefore = peakResidentSetSize()
+        measure {
+            for _ in 0..<rotations {
+                _ = try! evaluator.rotateRowsInplace(encrypted, steps: 1, galoisKey: galoisKeys)
+            }
+        }
+        XCTAssertLessThan(peakResidentSetSize() - peakBefore, keyBytesLowerBound)
+    }
+    
+    func testSerialMultiplyPlainPerformance4096() throws {
+        let (evaluator, encrypteds, plain) = try batchFixture(4096, count: 256)
+        measure {
+            for encrypted in encrypteds {
+                _ = try! evaluator.multiplyPlain(encrypted, plain: plain)
+            }
+        }
+    }
+
+    func testBatchMultiplyPlainPerformance4096() throws {
+        /*
+         Batches are split across every active processor, so this should run
+         close to activeProcessorCount times faster than the serial test above.
+         */
+        let (evaluator, encrypteds, plain) = try batchFixture(4096, count: 256)
+        print("Batch concurrency: \(evaluator.batchConcurrency)")
+        measure {
+            _ = try! evaluator.multiplyPlainBatch(encrypteds, plains: [plain])
+        }
+    }
+
+    func testMultiplyPreparedPlainPerformance4096() throws {
+        /*
+         Same work as the serial test above, but the plaintext is transformed
+         to NTT form once instead of on every multiplication.
+         */
+        let (evaluator, encrypteds, plain) = try batchFixture(4096, count: 256)
+        let prepared = try ASLPreparedPlainText(plainText: plain, evaluator: evaluator)
+        measure {
+            for encrypted in encrypteds {
+                _ = try! evaluator.multiplyPlain(encrypted, prepared: prepared)
+            }
+        }
+    }
+
+    func testMultiplyScalarPerformance4096() throws {
+        /*
+         Compare with the serial plain multiplication: the constant is
+         multiplied into each prime of the coefficient modulus directly, with
+         no plaintext to transform to NTT form.
+         */
+        let (evaluator, encrypteds, _) = try batchFixture(4096, count: 256)
+        measure {
+            for encrypted in encrypteds {
+                _ = try! evaluator.multiplyScalar(encrypted, integerValue: 3)
+            }
+        }
+    }
+
+    func testAddManyPerformance4096() throws {
+        /*
+         The inputs are summed by reference, one contiguous run per worker,
+         instead of being copied and added on a single thread.
+         */
+        let (evaluator, encrypteds, _) = try batchFixture(4096, count: 1024)
+        measure {
+            _ = try! evaluator.addMany(encrypteds)
+        }
+    }
+
+    func testRelinearizeEachProductPerformance4096() throws {
+        let (evaluator, encrypteds, relinKeys) = try dotProductFixture(4096, count: 64)
+        measure {
+            let products = encrypteds.map {
+                try! evaluator.relinearize(evaluator.multiply($0, encrypted2: $0), relinearizationKeys: relinKeys)
+            }
+            _ = try! evaluator.addMany(products)
+        }
+    }
+
+    func testMultiplyAccumulatePerformance4096() throws {
+        /*
+         The products are added at size 3 and relinearized once, so the sum
+         pays one key switch instead of one per product.
+         */
+        let (evaluator, encrypteds, relinKeys) = try dotProductFixture(4096, count: 64)
+        measure {
+            _ = try! evaluator.multiplyAccumulate(encrypteds, encrypted2: encrypteds, relinearizationKeys: relinKeys)
+        }
+    }
+
+    func testIsMemberPerformance4096() throws {
+        /*
+         The differences from the set members are multiplied as a tree across
+         batchConcurrency workers and the product is raised to the power 786432
+         once, with nineteen squarings and one product, instead of running an
+         equality test per member.
+         */
+        let (evaluator, encrypteds, relinKeys) = try dotProductFixture(4096, count: 16)
+        measure {
+            _ = try! evaluator.isMember(encrypteds[0], ofSet: encrypteds, relinearizationKeys: relinKeys)
+        }
+    }
+
+    func testRotationLoopPerformance4096() throws {
+        let (evaluator, encrypted, galoisKeys) = try rotationFixture(4096)
+        measure {
+            for step in 1...32 {
+                _ = try! evaluator.rotateVector(encrypted, steps: Int32(step), galoisKey: galoisKeys)
+            }
+        }
+    }
+
+    func testRotationByStepsPerformance4096() throws {
+        /*
+         With power-of-two Galois keys the loop above pays one key switch per
+         non-zero digit of each step, while rotating by all steps at once reuses
+         earlier results so every step costs a single key switch.
+         */
+        let (evaluator, encrypted, galoisKeys) = try rotationFixture(4096)
+        let steps = (1...32).map { NSNumber(value: $0) }
+        measure {
+            _ = try! evaluator.rotateVector(encrypted, bySteps: steps, galoisKey: galoisKeys)
+        }
+    }
+
+    func testBatchEncodeArrayPerformance8192() throws {
+        let batchEncoder = try ASLBatchEncoder(context: bfvContext(8192))
+        let values = (0..<batchEncoder.slotCount).map { NSNumber(value: $0) }
+        measure {
+            for _ in 0..<16 {
+                _ = try! batchEncoder.encode(withUnsignedValues: values)
+            }
+        }
+    }
+
+    func testBatchEncodeBufferPerformance8192() throws {
+        /*
+         The buffer entry point reads the slots in place and reduces each one
+         as it is scattered into the plaintext, where the array entry point
+         unboxes every NSNumber into an intermediate vector first.
+         */
+        let batchEncoder = try ASLBatchEncoder(context: bfvContext(8192))
+        let values = (0..<UInt64(batchEncoder.slotCount)).map { $0 }
+        measure {
+            for _ in 0..<16 {
+                _ = try! batchEncoder.encodeUInt64Buffer(values, count: values.count)
+            }
+        }
+    }
+
+    func testBatchEncodeColumnSeriallyPerformance8192() throws {
+        let batchEncoder = try ASLBatchEncoder(context: bfvContext(8192))
+        let column = (0..<UInt64(64 * batchEncoder.slotCount)).map { $0 }
+        measure {
+            column.withUnsafeBufferPointer { buffer in
+                for begin in stride(from: 0, to: buffer.count, by: batchEncoder.slotCount) {
+                    _ = try! batchEncoder.encodeUInt64Buffer(buffer.baseAddress! + begin, count: batchEncoder.slotCount)
+                }
+            }
+        }
+    }
+
+    func testBatchEncodeColumnPerformance8192() throws {
+        /*
+         encodeBatch splits the column into slot-sized chunks and encodes them
+         on one worker per core, so ingest throughput scales with the number
+         of cores.
+         */
+        let batchEncoder = try ASLBatchEncoder(context: bfvContext(8192))
+        let column = (0..<UInt64(64 * batchEncoder.slotCount)).map { $0 }
+        measure {
+            _ = try! batchEncoder.encodeBatchUInt64Buffer(column, count: column.count)
+        }
+    }
+
+    func testEncodeThenEncryptPerformance8192() throws {
+        let (encryptor, batchEncoder) = try encryptFixture(8192)
+        let values = (0..<batchEncoder.slotCount).map { NSNumber(value: $0) }
+        measure {
+            for _ in 0..<16 {
+                _ = try! encryptor.encrypt(with: batchEncoder.encode(withUnsignedValues: values))
+            }
+        }
+    }
+
+    func testEncryptBufferPerformance8192() throws {
+        /*
+         The fused path encodes the raw buffer into a scratch plaintext the
+         encryptor reuses and encrypts into one caller-owned ciphertext, so
+         no NSNumber, plaintext or ciphertext is allocated per record.
+         */
+        let (encryptor, batchEncoder) = try encryptFixture(8192)
+        let values = (0..<UInt64(batchEncoder.slotCount)).map { $0 }
+        let destination = ASLCipherText()
+        measure {
+            for _ in 0..<16 {
+                try! encryptor.encryptUInt64Buffer(values, count: values.count, encoder: batchEncoder, into: destination)
+            }
+        }
+    }
+
+    func testCkksDecodeArrayPerformance8192() throws {
+        let (encoder, plain) = try ckksEncodeFixture(8192)
+        measure {
+            for _ in 0..<16 {
+                _ = try! encoder.decodeDoubleValues(plain)
+            }
+        }
+    }
+
+    func testCkksDecodeBufferPerformance8192() throws {
+        /*
+         The buffer entry points copy the slots straight between the caller's
+         memory and the vector SEAL works on, where the array entry points
+         allocate an NSNumber for every one of the 4096 slots.
+         */
+        let (encoder, plain) = try ckksEncodeFixture(8192)
+        var values = [Double](repeating: 0, count: encoder.slotCount)
+        measure {
+            for _ in 0..<16 {
+                try! encoder.decodeDoubles(plain, into: &values, capacity: values.count)
+            }
+        }
+    }
+
+    func testCkksEncodeConstantPerformance8192() throws {
+        let (encoder, plain) = try ckksEncodeFixture(8192)
+        let weights = (0..<encoder.slotCount).map { NSNumber(value: Double($0) / 3) }
+        measure {
+            for _ in 0..<16 {
+                _ = try! encoder.encode(withDoubleValues: weights, parametersId: plain.parametersId, scale: plain.scale)
+            }
+        }
+    }
+
+    func testCkksPreparedConstantPerformance8192() throws {
+        /*
+         After the first request the weights are a cache hit: hashing and
+         comparing 4096 doubles replaces the inverse FFT and the forward NTT
+         over every prime at the level.
+         */
+        let (encoder, plain) = try ckksEncodeFixture(8192)
+        let weights = (0..<encoder.slotCount).map { Double($0) / 3 }
+        measure {
+            for _ in 0..<16 {
+                _ = try! encoder.preparedPlain(forDoubles: weights, count: weights.count, scale: plain.scale, parametersId: plain.parametersId)
+            }
+        }
+    }
+
+    private func encryptFixture(_ polyModulusDegree: Int) throws -> (ASLEncryptor, ASLBatchEncoder) {
+        let context = try bfvContext(polyModulusDegree)
+        let keygen = try ASLKeyGenerator(context: context)
+        return (try ASLEncryptor(context: context, publicKey: keygen.publicKey), try ASLBatchEncoder(context: context))
+    }
+
+    private func ckksEncodeFixture(_ polyModulusDegree: Int) throws -> (ASLCKKSEncoder, ASLPlainText) {
+        let parms = ASLEncryptionParameters(schemeType: .CKKS)
+        try parms.setPolynomialModulusDegree(polyModulusDegree)
+        try parms.setCoefficientModulus(ASLCoefficientModulus.create(polyModulusDegree, bitSizes: [60, 40, 40, 60]))
+        let encoder = try ASLCKKSEncoder(context: ASLSealContext(parms))
+        let values = (0..<encoder.slotCount).map { Double($0) / 7 }
+        return (encoder, try encoder.encodeDoubles(values, count: values.count, scale: pow(2.0, 40)))
+    }
+
+    private func rotationFixture(_ polyModulusDegree: Int) throws -> (ASLEvaluator, ASLCipherText, ASLGaloisKeys) {
+        let parms = ASLEncryptionParameters(schemeType: .CKKS)
+        try parms.setPolynomialModulusDegree(polyModulusDegree)
+        try parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        let context = try ASLSealContext(parms)
+        let keygen = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keygen.publicKey)
+        let encoder = try ASLCKKSEncoder(context: context)
+        let encrypted = try encryptor.encrypt(with: encoder.encode(withDoubleValue: 1.5, scale: pow(2.0, 30)))
+        return (try ASLEvaluator(context), encrypted, try keygen.galoisKeysLocal())
+    }
+
+    private func batchFixture(_ polyModulusDegree: Int, count: Int) throws -> (ASLEvaluator, [ASLCipherText], ASLPlainText) {
+        let context = try bfvContext(polyModulusDegree)
+        let keygen = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keygen.publicKey)
+        let encoder = try ASLIntegerEncoder(context: context)
+        let encrypted = try encryptor.encrypt(with: encoder.encodeInt32Value(2))
+        let encrypteds = (0..<count).map { _ in encrypted.copy() as! ASLCipherText }
+        return (try ASLEvaluator(context), encrypteds, encoder.encodeInt32Value(3))
+    }
+
+    private func dotProductFixture(_ polyModulusDegree: Int, count: Int) throws -> (ASLEvaluator, [ASLCipherText], ASLRelinearizationKeys) {
+        let context = try bfvContext(polyModulusDegree)
+        let keygen = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keygen.publicKey)
+        let encoder = try ASLIntegerEncoder(context: context)
+        let encrypted = try encryptor.encrypt(with: encoder.encodeInt32Value(2))
+        let encrypteds = (0..<count).map { _ in encrypted.copy() as! ASLCipherText }
+        return (try ASLEvaluator(context), encrypteds, try keygen.relinearizationKeysLocal())
+    }
+
+    /// The peak resident set size in bytes, which is the unit of ru_maxrss on Darwin
+    private func peakResidentSetSize() -> Int {
+        var usage = rusage()
+        getrusage(RUSAGE_SELF, &usage)
+        return usage.ru_maxrss
+    }
+    
+    private func bfvContext(_ polyModulusDegree: Int) throws -> ASLSealContext {
+        let parms = ASLEncryptionParameters(schemeType: .BFV)
+        try parms.setPolynomialModulusDegree(polyModulusDegree)
+        try parms.setCoefficientModulus(ASLCoefficientModulus.bfvDefault(polyModulusDegree))
+        try parms.setPlainModulusWithInteger(786433)
+        return try ASLSealContext(parms)
+    }
+    
+    private func inplaceFixture(_ context: ASLSealContext) throws -> (ASLEvaluator, ASLCipherText) {
+        let keygen = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keygen.publicKey)
+        let encoder = try ASLIntegerEncoder(context: context)
+        let encrypted = try encryptor.encrypt(with: encoder.encodeInt32Value(2))
+        return (try ASLEvaluator(context), encrypted)
+    }
+    
+    private func rotationFixture(_ context: ASLSealContext) throws -> (ASLEvaluator, ASLCipherText, ASLGaloisKeys) {
+        let keygen = try ASLKeyGenerator(context: context)
+        let encryptor = try ASLEncryptor(context: context, publicKey: keygen.publicKey)
+        let encoder = try ASLIntegerEncoder(context: context)
+        let encrypted = try encryptor.encrypt(with: encoder.encodeInt32Value(2))
+        return (try ASLEvaluator(context), encrypted, try keygen.galoisKeysLocal())
+    }
+    
+    private func printSavedBytes(_ encrypted: ASLCipherText, operations: Int) {
+        let bytesPerOperation = encrypted.size * encrypted.polynomialModulusDegree * encrypted.coefficientModulusSize * MemoryLayout<UInt64>.size
+        print("Bytes not copied per in-place operation: \(bytesPerOperation)")
+        print("Bytes not copied across \(operations) operations: \(bytesPerOperation * operations)")
+    }
+    
     private func ckksTest(_ context: ASLSealContext) throws {
         let parms = context.firstContextData.encryptionParameters
         let keygen = try ASLKeyGenerator(context: context)